@@ -6,40 +6,942 @@
 /*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/09 04:18:07 by lakdogan          #+#    #+#             */
-/*   Updated: 2025/05/10 03:43:49 by lakdogan         ###   ########.fr       */
+/*   Updated: 2026/10/19 15:39:20 by lakdogan         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef PIPEX_BONUS_H
 # define PIPEX_BONUS_H
 
+# ifndef _GNU_SOURCE
+#  define _GNU_SOURCE
+# endif
+
 # include "../../libft/inc/libft.h"
 # include <sys/wait.h>
+# include <sys/ioctl.h>
+# include <limits.h>
+# include <poll.h>
+# include <time.h>
+# include <sys/resource.h>
+# include <sys/stat.h>
+# include <sys/uio.h>
+# include <errno.h>
+# include <string.h>
+# include <ctype.h>
+# include <signal.h>
+# include <stdint.h>
+# include <pthread.h>
+# include <sched.h>
 
-typedef struct s_pipex
+# define SAMPLE_BUCKETS 6
+# define DEFAULT_PIPE_SIZE 65536
+# define MAX_SAMPLE_MS 1000
+# define REAP_ERROR -1
+# define REAP_NONE -2
+# define IO_CHUNK 65536
+# define IO_FALLBACK 1
+# define DEFAULT_HEAD_LINES 10
+# define WC_BUFSIZE 262144
+# define WC_NUMBER_WIDTH 7
+# define TR_BUFSIZE 262144
+# define TR_MAX_REPEAT 65536
+# define HEAD_BUFSIZE 262144
+
+# define WC_LINES 1
+# define WC_WORDS 2
+# define WC_BYTES 4
+
+# define RW_DROP_CAT 1
+# define RW_MERGE_GREP 2
+# define RW_HOIST_FILTER 4
+# define RW_SORT_UNIQ 8
+# define RW_TOPK 16
+# define RW_DISTINCT 32
+# define RW_ALL 63
+
+# define GREP_INVERT 1
+# define GREP_FIXED 2
+# define GREP_EXTENDED 4
+# define GREP_ICASE 8
+# define GREP_WORD 16
+# define GREP_LINE 32
+# define GREP_COUNT 64
+# define GREP_BASIC 128
+
+# define TR_COMPLEMENT 1
+# define TR_DELETE 2
+# define TR_SQUEEZE 4
+# define TR_TRUNCATE 8
+
+# define TR_PLAIN 0
+# define TR_LOWER 1
+# define TR_UPPER 2
+# define TR_CLASS 3
+# define TR_EQUIV 4
+
+# define CTYPE_C 0
+# define CTYPE_UTF8 1
+# define CTYPE_OTHER 2
+
+# define SORT_REVERSE 1
+# define SORT_UNIQUE 2
+# define SORT_KEYED 4
+# define SORT_STABLE 8
+# define SORT_FAILURE 2
+# define SORT_CHUNK 16777216
+# define SORT_MIN_BUDGET 1048576
+# define SORT_MAX_THREADS 8
+# define SORT_TASKS 4
+# define SORT_INSERTION 16
+# define SORT_MAX_RUNS 64
+# define MERGE_MAX_INPUTS 1024
+# define MERGE_BLOCK 1048576
+
+# define SK_BLANK_START 1
+# define SK_BLANK_END 2
+# define SK_NUMERIC 4
+# define SK_REVERSE 8
+# define SK_NONE SIZE_MAX
+
+# define DIST_COUNT 1
+# define DIST_PARTS 64
+# define DIST_SLOTS 4096
+
+# define CUT_FIELDS 1
+# define CUT_DELIM 2
+# define CUT_SUPPRESS 4
+# define CUT_COMPLEMENT 8
+# define CUT_OUTDELIM 16
+
+# define SED_QUIET 1
+# define SED_GLOBAL 2
+# define SED_PRINT 4
+# define SED_ADDRESS 8
+# define SED_FAILURE 4
+# define GATHER_IOV 512
+
+# define AWK_PRINT 0
+# define AWK_SUM 1
+# define AWK_FILTER 2
+# define AWK_COUNT 3
+# define AWK_NUMERIC 1
+# define AWK_NOT 2
+# define AWK_SHAPE 32
+# define AWK_NAMES 8
+# define AWK_NUMBUF 32
+# define AWK_MAX_FIELD 32767
+# define AWK_FAILURE 2
+# define BATCH_MAX_THREADS 64
+# define GROUP_COUNT 0
+# define GROUP_SUM 1
+# define GROUP_MIN 2
+# define GROUP_MAX 3
+# define GROUP_SORT 1
+# define GROUP_RANK 2
+# define GROUP_DELIM 4
+# define GROUP_VALUES 8
+# define GROUP_MAX_AGGS 8
+# define GROUP_BATCH 16777216
+# define GROUP_MIN_SPLIT 1048576
+# define GROUP_MAX_THREADS 8
+# define JOIN_ANTI 1
+# define JOIN_DELIM 2
+# define JOIN_PAYLOAD 4
+# define JOIN_BATCH 16777216
+# define JOIN_MIN_SPLIT 1048576
+# define JOIN_MAX_THREADS 8
+# define JOIN_BLOOM_MIN 65536
+# define RING_FD_BASE 1000000
+# define RING_MAX 64
+# define RING_SLOTS 8
+# define RING_QUEUE 16
+# define RING_BUF 65536
+# define RING_SPINS 64
+# define RING_YIELDS 256
+# define RING_SLEEP_US 50
+# define FUSE_BYTES 0
+# define FUSE_LINES 1
+# define FUSE_RECORDS 2
+# define FUSE_BUFSIZE 131072
+# define STEAL_MAX 64
+# define STEAL_DEQUE 256
+# define STEAL_WINDOW 4
+# define STEAL_BLOCK_MAX 524288
+# define SHARD_MAX 256
+# define SHARD_COPY 1073741824
+# define PARALLEL_MAX 64
+# define PARALLEL_CHUNK 1048576
+# define FANOUT_MAX 8
+# define FANOUT_CHUNK 1048576
+# define FANOUT_BRANCH 1
+# define FANOUT_TAP 2
+# define TAP_BLOCK 1
+# define TAP_DROP 2
+# define TAP_BUFFER 1048576
+
+# ifdef __APPLE__
+#  define MAXRSS_UNIT 1
+# else
+#  define MAXRSS_UNIT 1024
+# endif
+
+# ifndef F_GETPIPE_SZ
+#  define F_GETPIPE_SZ -1
+# endif
+
+# ifndef F_SETPIPE_SZ
+#  define F_SETPIPE_SZ -1
+# endif
+
+typedef struct s_opts
+{
+	int			sample_ms;
+	const char	*metrics_file;
+	const char	*pipeline_name;
+	int			report_json;
+	const char	*report_file;
+	int			no_builtins;
+	int			rewrites;
+	int			explain;
+	int			unordered;
+	int			threaded;
+	int			fuse;
+	int			steal;
+	int			shards;
+	int			parallel_stage;
+	int			replicas;
+	int			inputs;
+	const char	*fanout_specs[FANOUT_MAX];
+	int			fanout_count;
+	int			tap_mask;
+	int			tap_drop;
+}				t_opts;
+
+typedef struct s_buf
+{
+	char	*data;
+	size_t	len;
+	size_t	cap;
+	int		failed;
+}			t_buf;
+
+typedef struct s_option
+{
+	const char	*name;
+	int			takes_value;
+	int			(*apply)(t_opts *opts, const char *value);
+}				t_option;
+
+typedef struct s_out
+{
+	int		fd;
+	size_t	len;
+	int		(*sink)(void *ctx, const char *p, size_t len);
+	void	*ctx;
+	char	data[IO_CHUNK];
+}			t_out;
+
+typedef struct s_reader
+{
+	int		fd;
+	char	*buf;
+	size_t	cap;
+	size_t	start;
+	size_t	end;
+	int		eof;
+}			t_reader;
+
+typedef struct s_line
+{
+	char	*data;
+	size_t	len;
+}			t_line;
+
+typedef struct s_wc
+{
+	long	lines;
+	long	words;
+	long	bytes;
+	int		in_word;
+}			t_wc;
+
+typedef struct s_grep_args
+{
+	int		flags;
+	char	**patterns;
+	int		count;
+}			t_grep_args;
+
+typedef struct s_ac
+{
+	int				*delta;
+	unsigned char	*accept;
+	int				states;
+	int				classes;
+	unsigned short	cls[256];
+}					t_ac;
+
+typedef struct s_grep
+{
+	int				flags;
+	long			max_count;
+	int				utf8;
+	int				sources;
+	t_buf			text;
+	t_line			*patterns;
+	int				count;
+	int				any_empty;
+	t_ac			ac;
+	unsigned char	fold[256];
+}					t_grep;
+
+typedef struct s_grep_run
+{
+	t_grep	*grep;
+	t_out	out;
+	long	selected;
+	int		binary;
+	int		notice;
+	int		stop;
+}			t_grep_run;
+
+typedef struct s_tr
+{
+	int				flags;
+	int				dirty;
+	unsigned char	map[256];
+	unsigned char	del[256];
+	unsigned char	squeeze[256];
+	unsigned char	del_bits[32];
+	unsigned char	squeeze_bits[32];
+}					t_tr;
+
+typedef struct s_tr_set
+{
+	t_buf	chars;
+	t_buf	kinds;
+	long	fill_at;
+	int		fill_char;
+	int		is_set2;
+}			t_tr_set;
+
+typedef struct s_head
+{
+	long	count;
+	int		bytes;
+}			t_head;
+
+typedef struct s_sort_key
+{
+	size_t	sword;
+	size_t	schar;
+	size_t	eword;
+	size_t	echar;
+	int		flags;
+}			t_sort_key;
+
+typedef struct s_sort
+{
+	int			flags;
+	int			tab;
+	t_sort_key	global;
+	t_sort_key	*keys;
+	int			nkeys;
+	size_t		budget;
+	int			threads;
+	char		*tmpdir;
+}				t_sort;
+
+typedef struct s_merge
+{
+	t_sort	sort;
+	char	**files;
+	int		nfiles;
+}			t_merge;
+
+typedef struct s_sort_rec
+{
+	t_line		line;
+	t_line		key;
+	uint64_t	prefix;
+}				t_sort_rec;
+
+typedef struct s_topk_rec
+{
+	t_sort_rec	rec;
+	size_t		seq;
+}				t_topk_rec;
+
+typedef struct s_topk
+{
+	t_sort		sort;
+	t_topk_rec	*recs;
+	size_t		len;
+	size_t		cap;
+	size_t		k;
+	size_t		seq;
+}				t_topk;
+
+typedef struct s_num
+{
+	const char	*digits;
+	size_t		int_len;
+	const char	*frac;
+	size_t		frac_len;
+	int			neg;
+}				t_num;
+
+typedef struct s_sort_batch
+{
+	t_sort_rec	*recs;
+	size_t		n;
+	size_t		cap;
+	char		**chunks;
+	size_t		nchunks;
+	size_t		chunks_cap;
+	size_t		bytes;
+}				t_sort_batch;
+
+typedef struct s_sort_run
+{
+	const t_sort	*sort;
+	t_sort_batch	batch;
+	int				fd;
+	char			*buf;
+	size_t			size;
+	size_t			used;
+	size_t			start;
+	int				eof;
+	t_reader		*runs;
+	int				nruns;
+	size_t			*bounds;
+	int				tasks;
+	int				threads;
+	size_t			budget;
+	size_t			chunk;
+}					t_sort_run;
+
+typedef struct s_sort_src
+{
+	t_sort_rec	*rec;
+	t_sort_rec	*end;
+	t_reader	*reader;
+	t_line		line;
+	int			done;
+}				t_sort_src;
+
+typedef struct s_sort_merge
+{
+	const t_sort	*sort;
+	t_sort_src		*srcs;
+	int				*tree;
+	int				k;
+	t_line			prev;
+	t_buf			last;
+	int				has_last;
+	t_out			out;
+}					t_sort_merge;
+
+typedef struct s_sort_pool	t_sort_pool;
+
+typedef struct s_sort_worker
+{
+	t_sort_pool		*pool;
+	unsigned long	range;
+	int				started;
+	pthread_t		thread;
+}					t_sort_worker;
+
+struct s_sort_pool
+{
+	const t_sort	*sort;
+	t_sort_rec		*recs;
+	t_sort_rec		*tmp;
+	size_t			*bounds;
+	t_sort_worker	*workers;
+	int				count;
+};
+
+typedef struct s_dist_entry
+{
+	uint64_t	hash;
+	size_t		off;
+	size_t		len;
+	long		count;
+}				t_dist_entry;
+
+typedef struct s_distinct
+{
+	int				flags;
+	size_t			budget;
+	t_buf			arena;
+	t_dist_entry	*entries;
+	size_t			n;
+	size_t			cap;
+	uint64_t		*slots;
+	size_t			mask;
+	int				*parts;
+	t_out			*outs;
+}					t_distinct;
+
+typedef struct s_cut_range
+{
+	size_t	lo;
+	size_t	hi;
+}			t_cut_range;
+
+typedef struct s_cut
+{
+	int			flags;
+	char		delim;
+	const char	*list;
+	const char	*outdelim;
+	size_t		outlen;
+	t_cut_range	*ranges;
+	size_t		n;
+}				t_cut;
+
+typedef struct s_cut_run
+{
+	const t_cut	*cut;
+	const char	*start;
+	const char	*field;
+	size_t		index;
+	size_t		range;
+	int			printed;
+	int			split;
+	t_out		out;
+}				t_cut_run;
+
+typedef struct s_gather
+{
+	int				fd;
+	int				n;
+	int				(*sink)(void *ctx, const char *p, size_t len);
+	void			*ctx;
+	struct iovec	iov[GATHER_IOV];
+}					t_gather;
+
+typedef struct s_sed
+{
+	int			flags;
+	int			cmd;
+	const char	*script;
+	t_grep		addr;
+	t_grep		pat;
+	t_buf		repl;
+}				t_sed;
+
+typedef struct s_sed_run
+{
+	const t_sed		*sed;
+	const t_grep	*key;
+	const char		*line;
+	size_t			len;
+	long			first;
+	int				nl;
+	int				pending;
+	t_gather		out;
+}					t_sed_run;
+
+typedef struct s_awk
+{
+	int			kind;
+	int			flags;
+	int			field;
+	double		num;
+	const char	*text;
+	size_t		len;
+	char		buf[AWK_NUMBUF];
+}				t_awk;
+
+typedef struct s_awk_shape
+{
+	const char	*shape;
+	const char	*names;
+	int			kind;
+	int			flags;
+}				t_awk_shape;
+
+typedef struct s_awk_lex
+{
+	const char	*s;
+	size_t		i;
+	char		shape[AWK_SHAPE];
+	int			n;
+	const char	*names[AWK_NAMES];
+	size_t		lens[AWK_NAMES];
+	int			names_n;
+}				t_awk_lex;
+
+typedef struct s_awk_run
+{
+	const t_awk	*awk;
+	const char	*field;
+	size_t		len;
+	double		sum;
+	size_t		records;
+	t_distinct	table;
+	t_out		out;
+}				t_awk_run;
+
+typedef struct s_group
+{
+	int		flags;
+	char	delim;
+	int		key;
+	int		value;
+	int		aggs[GROUP_MAX_AGGS];
+	int		naggs;
+	int		threads;
+}			t_group;
+
+typedef struct s_group_acc
+{
+	double	sum;
+	double	min;
+	double	max;
+}			t_group_acc;
+
+typedef struct s_group_part
+{
+	const t_group	*group;
+	const char		*p;
+	const char		*end;
+	const char		*eol;
+	t_distinct		table;
+	t_group_acc		*acc;
+	size_t			cap;
+	int				failed;
+	int				started;
+	pthread_t		thread;
+}					t_group_part;
+
+typedef struct s_join_pay
+{
+	size_t	off;
+	size_t	len;
+}			t_join_pay;
+
+typedef struct s_join
+{
+	int			flags;
+	char		delim;
+	int			key;
+	int			threads;
+	const char	*name;
+	const char	*file;
+	t_distinct	keys;
+	t_buf		payload;
+	t_buf		pays;
+	uint64_t	*bloom;
+	size_t		bloom_mask;
+}				t_join;
+
+typedef struct s_join_part
+{
+	const t_join	*join;
+	const char		*p;
+	const char		*end;
+	t_buf			out;
+	int				out_fd;
+	int				started;
+	pthread_t		thread;
+}					t_join_part;
+
+typedef struct s_ring_buf
+{
+	size_t	len;
+	char	data[RING_BUF];
+}			t_ring_buf;
+
+typedef struct s_spsc
+{
+	size_t		head;
+	t_ring_buf	*items[RING_QUEUE];
+	size_t		tail;
+}				t_spsc;
+
+typedef struct s_ring
+{
+	t_spsc		full;
+	t_spsc		empty;
+	t_ring_buf	*bufs;
+	t_ring_buf	*reading;
+	size_t		read_off;
+	t_ring_buf	*writing;
+	int			closed;
+	int			abandoned;
+	int			upstream;
+}				t_ring;
+
+typedef struct s_metric
+{
+	const char	*name;
+	const char	*help;
+	int			is_ns;
+}				t_metric;
+
+typedef struct s_sampler
+{
+	int	*hist;
+	int	*capacity;
+	int	samples;
+}		t_sampler;
+
+typedef struct s_stage	t_stage;
+
+typedef struct s_builtin
+{
+	const char	*name;
+	int			(*match)(t_stage *stage);
+	int			(*run)(t_stage *stage, int in_fd, int out_fd);
+	void		(*free_state)(void *state);
+	int			stops_upstream;
+}				t_builtin;
+
+struct s_stage
+{
+	char			*cmd_str;
+	char			*label;
+	char			**argv;
+	char			*path;
+	pid_t			pid;
+	int				host;
+	int				fused;
+	int				replicas;
+	int				fanout;
+	int				cache_hit;
+	const t_builtin	*builtin;
+	void			*state;
+	int				probe[2];
+	int				reaped;
+	int				raw_status;
+	long			fork_ns;
+	long			exec_ns;
+	long			exit_ns;
+	struct rusage	usage;
+};
+
+typedef struct s_stage_thread
 {
-	char	*infile_path;
-	char	*outfile_path;
+	t_stage					*stage;
+	int						in_fd;
+	int						out_fd;
+	struct s_stage_thread	*first;
+	int						index;
+	int						count;
+	struct s_steal_pool		*pool;
+	int						started;
+	pthread_t				thread;
+}							t_stage_thread;
 
-	int		*pipes;
-	int		cmd_count;
-	int		pipe_count;
+typedef struct s_fuse_op	t_fuse_op;
+
+typedef struct s_fuse_kind
+{
+	const char	*name;
+	int			(*accept)(t_stage *stage);
+	int			(*start)(t_fuse_op *op);
+	int			(*block)(t_fuse_op *op, const char *p, size_t len);
+	int			(*finish)(t_fuse_op *op);
+	int			lines;
+	int			terminal;
+	int			(*parallel)(t_stage *stage);
+	void		(*merge)(t_fuse_op *into, t_fuse_op *from);
+}				t_fuse_kind;
+
+struct s_fuse_op
+{
+	t_stage				*stage;
+	const t_fuse_kind	*kind;
+	void				*run;
+	t_out				*out;
+	t_buf				carry;
+	t_buf				scratch;
+	t_fuse_op			*next;
+	int					out_fd;
+	long				arg;
+	int					stop;
+};
+
+typedef struct s_steal_task	t_steal_task;
+
+struct s_steal_task
+{
+	void	(*run)(t_steal_task *task, int worker);
+	void	*ctx;
+	t_buf	in;
+	t_buf	out;
+	int		fallback;
+	int		done;
+};
+
+typedef struct s_steal_deque
+{
+	pthread_mutex_t	lock;
+	t_steal_task	*tasks[STEAL_DEQUE];
+	unsigned int	head;
+	unsigned int	tail;
+}					t_steal_deque;
+
+typedef struct s_steal_pool	t_steal_pool;
+
+typedef struct s_steal_worker
+{
+	t_steal_pool	*pool;
+	t_steal_deque	deque;
+	int				index;
+	int				started;
+	pthread_t		thread;
+}					t_steal_worker;
+
+struct s_steal_pool
+{
+	t_steal_worker	*workers;
+	int				count;
+	unsigned int	next;
+	long			pending;
+	int				shutdown;
+	pthread_mutex_t	lock;
+	pthread_cond_t	wake;
+};
+
+typedef struct s_steal_seg
+{
+	t_steal_pool	*pool;
+	t_stage			*stages;
+	int				count;
+	int				prefix;
+	t_fuse_op		*ops;
+	t_fuse_op		**inst;
+	t_steal_task	*window;
+	int				slots;
+	t_buf			carry;
+	char			*rbuf;
+	int				in_fd;
+	int				out_fd;
+	int				eof;
+	int				serial;
+	pthread_mutex_t	lock;
+	pthread_cond_t	done;
+}					t_steal_seg;
+
+typedef struct s_shard
+{
+	off_t	start;
+	off_t	end;
+	int		fd;
+	pid_t	pid;
+	int		status;
+}			t_shard;
+
+typedef struct s_fanout
+{
+	int		stage;
+	char	**cmds;
+	int		ncmds;
+	char	*outfile;
+	int		tap;
+	int		source;
+	int		sink;
+	int		branch;
+	int		branch_in;
+	pid_t	pid;
+	pid_t	driver;
+	int		status;
+	int		driver_status;
+}			t_fanout;
+
+typedef struct s_replica
+{
+	pid_t	pid;
+	long	seq;
 	int		in_fd;
 	int		out_fd;
+	t_buf	input;
+	size_t	sent;
+	t_buf	output;
+}			t_replica;
+
+typedef struct s_run_stats
+{
+	long	start_ns;
+	long	end_ns;
+	long	start_epoch_ns;
+	long	parsed_ns;
+	long	spawned_ns;
+	long	execed_ns;
+	long	heredoc_ns;
+	long	heredoc_bytes;
+	long	out_size_before;
+	long	bytes_in;
+	long	bytes_out;
+	int		cache_hits;
+	int		cache_misses;
+	int		elided;
+	int		rewrites;
+	int		exit_code;
+}			t_run_stats;
+
+typedef struct s_pipex
+{
+	char		*infile_path;
+	char		*outfile_path;
+	char		**infile_paths;
+	int			infile_count;
 
-	char	**env_vars;
-	char	**args;
-	char	**paths;
+	int			*pipes;
+	int			cmd_count;
+	int			pipe_count;
+	int			in_fd;
+	int			out_fd;
 
-	int		is_heredoc;
-	char	*limiter;
+	char		**env_vars;
+	char		**args;
+	char		**paths;
 
-	int		is_child;
-	int		cleaned;
+	int			is_heredoc;
+	char		*limiter;
 
-	char	*cmd_path;
-	int		input_missing;
-}			t_pipex;
+	int			is_child;
+	int			cleaned;
+
+	char		*cmd_path;
+	int			input_missing;
+
+	char		**cmd_strs;
+	t_opts		opts;
+	t_sampler	sampler;
+	t_stage		*stages;
+	t_fanout	*fanouts;
+	t_run_stats	stats;
+}				t_pipex;
+
+typedef struct s_parallel
+{
+	t_pipex			*context;
+	int				stage;
+	t_replica		*slots;
+	int				count;
+	struct pollfd	*fds;
+	int				nfds;
+	t_buf			pending;
+	int				in_eof;
+	long			next_seq;
+	long			emit;
+	int				ran;
+	int				ones;
+	int				failed;
+}					t_parallel;
+
+typedef struct s_rule
+{
+	const char	*name;
+	int			bit;
+	int			(*apply)(t_pipex *context, int i);
+}				t_rule;
 
 typedef struct s_token_bounds
 {
@@ -69,13 +971,383 @@ void		try_exec_in_dirs(char **paths, char **args, char **envp);
 char		*check_direct_command(char *cmd);
 
 // bonus
-t_pipex		*init_context(int argc, char **argv, char **envp);
+int			print_usage(int exit_code);
+t_pipex		*init_context(int argc, char **argv, char **envp, int inputs);
 void		handle_heredoc(t_pipex *context);
-int			handle_processes(t_pipex *context, char **argv);
+int			handle_processes(t_pipex *context);
 void		launch_command_bonus(t_pipex *context, char *cmd_str, char **envp);
 int			wait_children(t_pipex *context, pid_t *pids);
 void		setup_stdin_stdout(t_pipex *context, int i);
 void		close_all_pipe_fds(t_pipex *context);
-void		execute_command(t_pipex *context, char **argv, int i);
+void		execute_command(t_pipex *context, int i);
+int			pipeline_exit_code(t_pipex *context, int last_raw_status);
+
+// options
+int			parse_options(t_opts *opts, int argc, char **argv);
+int			parse_count(const char *value, int max, int *out);
+int			opt_sample_ms(t_opts *opts, const char *value);
+int			opt_metrics_file(t_opts *opts, const char *value);
+int			opt_pipeline_name(t_opts *opts, const char *value);
+int			opt_report(t_opts *opts, const char *value);
+int			opt_report_file(t_opts *opts, const char *value);
+int			opt_no_builtins(t_opts *opts, const char *value);
+int			opt_no_rewrite(t_opts *opts, const char *value);
+int			opt_explain(t_opts *opts, const char *value);
+int			opt_unordered(t_opts *opts, const char *value);
+int			opt_threaded(t_opts *opts, const char *value);
+int			opt_fuse(t_opts *opts, const char *value);
+int			opt_steal(t_opts *opts, const char *value);
+int			opt_shards(t_opts *opts, const char *value);
+int			opt_parallel(t_opts *opts, const char *value);
+int			opt_inputs(t_opts *opts, const char *value);
+int			opt_fanout(t_opts *opts, const char *value);
+int			opt_tap(t_opts *opts, const char *value);
+int			opt_tap_policy(t_opts *opts, const char *value);
+
+// stages
+void		init_stages(t_pipex *context);
+void		free_stages(t_pipex *context);
+void		clear_stage(t_stage *stage);
+void		resolve_stage(t_pipex *context, int i);
+long		now_ns(clockid_t clock);
+int			status_exit_code(int raw_status);
+int			reap_stage(t_pipex *context, pid_t *pids, int options);
+void		stop_upstream(t_pipex *context, int i);
+void		open_exec_probe(t_pipex *context, int i);
+void		close_exec_probe(t_pipex *context, int i, pid_t pid);
+void		wait_exec_probes(t_pipex *context);
+void		begin_run_stats(t_pipex *context);
+void		end_run_stats(t_pipex *context, int exit_code);
+void		plan_thread_groups(t_pipex *context);
+int			group_first(t_pipex *context, int host);
+int			group_size(t_pipex *context, int host);
+void		reap_members(t_pipex *context, int host);
+const char	*stage_tag(t_pipex *context, int i);
+int			run_thread_group(t_pipex *context, int host);
+t_steal_pool	*steal_start(t_pipex *context);
+void		steal_stop(t_steal_pool *pool);
+int			steal_submit(t_steal_pool *pool, t_steal_task *task);
+t_steal_task	*steal_take(t_steal_pool *pool, int worker);
+int			steal_stage(t_pipex *context, int i);
+int			steal_prefix(t_stage *stages, int count);
+int			steal_segment(t_stage_thread *t);
+t_steal_seg	*steal_open(t_stage_thread *t, int prefix);
+void		steal_close(t_steal_seg *seg);
+void		steal_block(t_steal_task *task, int worker);
+ssize_t		steal_read(t_steal_seg *seg);
+int			steal_fill(t_steal_seg *seg, t_steal_task *task);
+int			steal_rest(t_steal_seg *seg);
+int			parallel_stage(t_pipex *context, int i);
+int			run_parallel(t_pipex *context, int i);
+void		parallel_schedule(t_parallel *par);
+int			parallel_serve(t_parallel *par);
+int			parallel_advance(t_parallel *par);
+int			parallel_status(t_parallel *par);
+
+// shards
+int			run_shards(t_pipex *context);
+t_shard		*plan_shards(t_pipex *context, int *count);
+void		start_shard_reader(t_pipex *context, t_shard *shard);
+void		explain_shards(t_pipex *context, t_shard *shards, int count);
+int			collect_shards(t_pipex *context, t_shard *shards, int count);
+
+// fanout
+void		init_fanouts(t_pipex *context);
+void		free_fanouts(t_pipex *context);
+void		start_fanouts(t_pipex *context);
+void		close_fanout_fds(t_pipex *context);
+void		fanout_reaped(t_pipex *context, pid_t pid, int status);
+int			fanout_exit_code(t_pipex *context, int exit_code);
+int			group_break(t_pipex *context, int j);
+int			parse_branch(t_fanout *f, const char *spec);
+int			parse_tap(t_fanout *f, const char *file);
+int			fan_copy(int in, int out, int branch, int tap);
+size_t		fan_move(int in, int out, size_t len);
+int			tap_copy(int fds[3], int stage);
+ssize_t		dup_pipe(int in_fd, int out_fd, size_t len, int nonblock);
+
+// optimizer
+void		optimize_pipeline(t_pipex *context);
+int			rewrite_bit(const char *name);
+void		remove_stage(t_pipex *context, int i);
+void		set_stage_argv(t_pipex *context, int i, char **argv);
+char		**new_argv(t_pipex *context, char **src, int extra);
+void		push_arg(t_pipex *context, char **argv, const char *arg);
+void		drop_stage(t_pipex *context, int i);
+void		explain_plan(t_pipex *context, const char *step);
+int			argv_is(t_stage *stage, const char *cmd);
+int			parse_grep(char **argv, t_grep_args *args);
+int			parse_sort(char **argv);
+int			parse_head(char **argv, int *count);
+int			bytewise_collation(t_pipex *context);
+int			rule_drop_cat(t_pipex *context, int i);
+int			rule_merge_grep(t_pipex *context, int i);
+int			rule_hoist_filter(t_pipex *context, int i);
+int			rule_sort_uniq(t_pipex *context, int i);
+int			rule_topk(t_pipex *context, int i);
+int			rule_distinct(t_pipex *context, int i);
+
+// builtins
+int			match_builtin(t_stage *stage);
+void		free_builtin_state(t_stage *stage);
+int			builtin_error(const char *name, const char *what);
+int			write_all(int fd, const char *data, size_t len);
+int			copy_fd(int in_fd, int out_fd);
+int			fd_is_fifo(int fd);
+ssize_t		move_pipe(int in_fd, int out_fd, size_t len);
+ssize_t		copy_range(int in_fd, int out_fd, size_t len);
+int			match_cat(t_stage *stage);
+int			run_cat(t_stage *stage, int in_fd, int out_fd);
+void		out_init(t_out *out, int fd);
+int			out_write(t_out *out, const char *data, size_t len);
+int			out_flush(t_out *out);
+int			reader_init(t_reader *reader, int fd);
+int			reader_fill(t_reader *r);
+int			next_line(t_reader *reader, char **line, size_t *len);
+void		reader_free(t_reader *reader);
+int			reader_batch(t_reader *r, size_t cap);
+void		batch_bounds(const char *p, size_t len, int count,
+				const char **bounds);
+int			line_cmp(const t_line *a, const t_line *b);
+int			parse_topk(char **argv, t_topk *topk);
+int			topk_offer(t_topk *topk, const char *line, size_t len);
+void		topk_sift_down(t_topk *topk, size_t i, size_t n);
+int			parse_wc(char **argv);
+int			count_width(int flags, struct stat *st);
+int			print_counts(t_wc *wc, int flags, int width, int out_fd);
+int			match_wc(t_stage *stage);
+int			run_wc(t_stage *stage, int in_fd, int out_fd);
+void		wc_scan(t_wc *wc, const unsigned char *p, size_t len, int flags);
+void		wc_lines_scalar(t_wc *wc, const unsigned char *p, size_t len);
+void		wc_words_scalar(t_wc *wc, const unsigned char *p, size_t len);
+void		wc_lines_sse2(t_wc *wc, const unsigned char *p, size_t len);
+void		wc_words_sse2(t_wc *wc, const unsigned char *p, size_t len);
+void		wc_lines_avx2(t_wc *wc, const unsigned char *p, size_t len);
+void		wc_words_avx2(t_wc *wc, const unsigned char *p, size_t len);
+int			match_topk(t_stage *stage);
+int			run_topk(t_stage *stage, int in_fd, int out_fd);
+void		free_topk(void *state);
+int			simd_level(void);
+int			ctype_locale(void);
+int			utf8_valid(const char *p, size_t len);
+int			parse_grep_argv(char **argv, t_grep *grep);
+int			grep_add_text(t_grep *grep, const char *text, size_t len);
+int			grep_read_file(t_grep *grep, const char *path);
+int			grep_compile(t_grep *grep);
+int			ac_build(t_grep *grep);
+long		ac_search(const t_ac *ac, const unsigned char *p, size_t len);
+int			grep_verify(const t_grep *grep, const unsigned char *p);
+long		grep_search_scalar(const t_grep *grep, const unsigned char *p,
+				size_t len);
+long		grep_search_avx2(const t_grep *grep, const unsigned char *p,
+				size_t len);
+long		grep_search(const t_grep *grep, const unsigned char *p, size_t len);
+int			grep_block(t_grep_run *run, const char *p, size_t len);
+int			match_grep(t_stage *stage);
+int			run_grep(t_stage *stage, int in_fd, int out_fd);
+void		free_grep(void *state);
+void		tr_push(t_tr_set *set, int c, char kind);
+int			tr_byte(const char *s, size_t *i);
+int			tr_bracket(t_tr_set *set, const char *s, size_t *i);
+int			tr_expand(t_tr_set *set, const char *s);
+int			parse_tr(char **argv, int *flags, char **sets);
+void		tr_members(t_tr *tr, t_tr_set *s, int two);
+int			tr_compile(t_tr *tr, char **sets);
+size_t		tr_block(const t_tr *tr, unsigned char *p, size_t len, int *last);
+void		tr_translate_scalar(const t_tr *tr, unsigned char *p, size_t len);
+void		tr_translate_avx2(const t_tr *tr, unsigned char *p, size_t len);
+size_t		tr_filter_scalar(const t_tr *tr, unsigned char *p, size_t len,
+				int *last);
+size_t		tr_filter_avx2(const t_tr *tr, unsigned char *p, size_t len,
+				int *last);
+int			match_tr(t_stage *stage);
+int			run_tr(t_stage *stage, int in_fd, int out_fd);
+int			parse_head_argv(char **argv, t_head *head);
+size_t		head_take(const t_head *head, const char *buf, size_t len,
+				long *left);
+int			match_head(t_stage *stage);
+int			run_head(t_stage *stage, int in_fd, int out_fd);
+int			locale_is_c(const char *category);
+int			sort_add_key(t_sort *sort, const char *spec);
+int			sort_inherit(t_sort *sort);
+int			parse_size(const char *value, size_t *budget);
+int			parse_sort_option(t_sort *sort, char **argv, int i);
+int			parse_sort_argv(char **argv, t_sort *sort);
+char		*key_begin(const t_sort *sort, const t_sort_key *key,
+				const t_line *line);
+char		*key_limit(const t_sort *sort, const t_sort_key *key,
+				const t_line *line);
+int			sort_numcmp(const t_line *a, const t_line *b);
+void		key_span(const t_sort *sort, const t_sort_key *key,
+				const t_line *line, t_line *span);
+int			key_cmp(const t_sort_key *key, const t_line *x, const t_line *y);
+int			sort_compare_from(const t_sort *sort, const t_line *a,
+				const t_line *b, int first);
+int			sort_compare(const t_sort *sort, const t_line *a,
+				const t_line *b);
+uint64_t	sort_prefix(const char *data, size_t len);
+void		sort_rec_init(const t_sort *sort, t_sort_rec *rec, char *data,
+				size_t len);
+int			sort_rec_cmp(const t_sort *sort, const t_sort_rec *a,
+				const t_sort_rec *b);
+void		sort_chunk(const t_sort *sort, t_sort_rec *a, t_sort_rec *tmp,
+				size_t n);
+int			sort_parallel(t_sort_run *run);
+int			sort_read(t_sort_run *run);
+int			sort_batch(t_sort_run *run);
+void		sort_reset(t_sort_run *run);
+t_sort_src	*sort_sources(t_sort_run *run, int with_runs, int *k);
+void		sort_release(t_sort_run *run);
+int			src_next(t_sort_src *src);
+void		loser_init(t_sort_merge *m);
+void		loser_replay(t_sort_merge *m, int leaf);
+int			sort_merge(const t_sort *sort, t_sort_src *srcs, int k, int fd);
+int			open_tmpfile(const char *dir);
+int			sort_spill(t_sort_run *run);
+int			sort_finish(t_sort_run *run, int out_fd);
+int			match_sort(t_stage *stage);
+int			run_sort(t_stage *stage, int in_fd, int out_fd);
+void		free_sort(void *state);
+uint64_t	dist_hash(const char *p, size_t len);
+size_t		dist_find(const t_distinct *d, uint64_t h, const char *data,
+				size_t len);
+long		dist_add(t_distinct *d, const char *data, size_t len, long count);
+void		dist_clear(t_distinct *d);
+int			dist_spill(t_distinct *d);
+int			dist_drain(t_distinct *d, int out_fd);
+int			dist_emit(const t_distinct *d, int out_fd);
+int			match_distinct(t_stage *stage);
+int			run_distinct(t_stage *stage, int in_fd, int out_fd);
+int			parse_cut_list(const char *list, t_cut *cut);
+int			parse_cut_argv(char **argv, t_cut *cut);
+uint64_t	cut_mask_scalar(const unsigned char *p, size_t len, int delim);
+uint64_t	cut_mask_avx2(const unsigned char *p, int delim);
+uint64_t	cut_mask(const unsigned char *p, size_t len, int delim);
+int			cut_bytes(t_cut_run *run, const char *p, size_t len);
+int			cut_fields(t_cut_run *run, const char *p, size_t len);
+int			cut_block(t_cut_run *run, const char *p, size_t len);
+int			match_cut(t_stage *stage);
+int			run_cut(t_stage *stage, int in_fd, int out_fd);
+void		free_cut(void *state);
+int			gather_add(t_gather *out, const char *data, size_t len);
+int			gather_flush(t_gather *out);
+int			parse_sed_script(const char *script, t_sed *sed);
+int			parse_sed_argv(char **argv, t_sed *sed);
+int			sed_block(t_sed_run *run, const char *p, size_t len);
+int			match_sed(t_stage *stage);
+int			run_sed(t_stage *stage, int in_fd, int out_fd);
+void		free_sed(void *state);
+int			awk_push(t_awk_lex *lex, char c);
+int			awk_lex_op(t_awk_lex *lex);
+int			awk_lex(const char *prog, t_awk_lex *lex, t_awk *awk);
+int			parse_awk_program(const char *prog, t_awk *awk);
+uint64_t	awk_mask_scalar(const unsigned char *p, size_t len, uint64_t *nl);
+uint64_t	awk_mask_avx2(const unsigned char *p, uint64_t *nl);
+uint64_t	awk_mask(const unsigned char *p, size_t len, uint64_t *nl);
+const char	*awk_field(const char *p, const char *end, int n, size_t *len);
+const char	*awk_record(t_awk_run *run, const char *p, const char *end);
+double		awk_tonum(const char *p, size_t len);
+int			awk_match(const t_awk *awk, const char *p, size_t len);
+size_t		awk_format(char *buf, double d);
+int			awk_block(t_awk_run *run, const char *p, size_t len);
+int			awk_end(t_awk_run *run);
+int			match_awk(t_stage *stage);
+int			run_awk(t_stage *stage, int in_fd, int out_fd);
+int			parse_groupby(char **argv, t_group *group);
+void		*group_worker(void *arg);
+int			group_reserve(t_group_part *part, long idx);
+double		group_number(const char *p, size_t len);
+int			group_merge(t_group_part *parts, int count);
+int			group_input(t_group_part *parts, int count, int fd);
+int			group_emit(t_group_part *part, int out_fd);
+int			match_groupby(t_stage *stage);
+int			run_groupby(t_stage *stage, int in_fd, int out_fd);
+int			join_load(t_join *join);
+void		*join_worker(void *arg);
+int			match_join(t_stage *stage);
+int			run_join(t_stage *stage, int in_fd, int out_fd);
+void		free_join(void *state);
+int			match_merge(t_stage *stage);
+int			run_merge(t_stage *stage, int in_fd, int out_fd);
+void		free_merge(void *state);
+void		merge_inputs(t_pipex *context);
+int			ring_open(int upstream);
+t_ring		*ring_get(int fd);
+void		ring_free(int fd);
+int			ring_fds_usable(void);
+void		spsc_push(t_spsc *q, t_ring_buf *buf);
+t_ring_buf	*spsc_pop(t_spsc *q);
+void		ring_backoff(int *spins);
+ssize_t		ring_read(t_ring *r, void *buf, size_t len);
+ssize_t		ring_write(t_ring *r, const void *buf, size_t len);
+void		ring_close(int fd);
+void		ring_abandon(int fd);
+ssize_t		io_read(int fd, void *buf, size_t len);
+ssize_t		io_write(int fd, const void *buf, size_t len);
+ssize_t		io_writev(int fd, const struct iovec *iov, int count);
+void		io_close(int fd);
+const t_fuse_kind	*fuse_kind(t_stage *stage);
+int			fuse_next(t_pipex *context, int i);
+int			fuse_emit(t_fuse_op *op, const char *p, size_t len);
+int			fuse_sink(void *ctx, const char *p, size_t len);
+void		fuse_out(t_fuse_op *op, t_out *out);
+int			fuse_push(t_fuse_op *op, const char *p, size_t len);
+int			fuse_end(t_fuse_op *op);
+void		fuse_free(t_fuse_op *ops, int count);
+int			fuse_run(t_stage *stages, int count, int in_fd, int out_fd);
+int			run_segment(t_stage *stage, int count, int in_fd, int out_fd);
+int			fuse_open(t_fuse_op *ops, t_stage *stages, int count, int out_fd);
+int			fuse_stopped(const t_fuse_op *ops, int count);
+int			fuse_stateless(t_stage *stage);
+int			fuse_tr_parallel(t_stage *stage);
+int			fuse_grep_parallel(t_stage *stage);
+void		fuse_grep_merge(t_fuse_op *into, t_fuse_op *from);
+void		fuse_wc_merge(t_fuse_op *into, t_fuse_op *from);
+int			fuse_tr_start(t_fuse_op *op);
+int			fuse_tr_block(t_fuse_op *op, const char *p, size_t len);
+int			fuse_head_start(t_fuse_op *op);
+int			fuse_head_block(t_fuse_op *op, const char *p, size_t len);
+int			fuse_wc_start(t_fuse_op *op);
+int			fuse_wc_block(t_fuse_op *op, const char *p, size_t len);
+int			fuse_wc_finish(t_fuse_op *op);
+int			fuse_grep_accept(t_stage *stage);
+int			fuse_grep_start(t_fuse_op *op);
+int			fuse_grep_block(t_fuse_op *op, const char *p, size_t len);
+int			fuse_grep_finish(t_fuse_op *op);
+int			fuse_cut_start(t_fuse_op *op);
+int			fuse_cut_block(t_fuse_op *op, const char *p, size_t len);
+int			fuse_sed_start(t_fuse_op *op);
+int			fuse_sed_block(t_fuse_op *op, const char *p, size_t len);
+int			fuse_awk_start(t_fuse_op *op);
+int			fuse_awk_block(t_fuse_op *op, const char *p, size_t len);
+int			fuse_awk_finish(t_fuse_op *op);
+
+// metrics
+void		write_metrics(t_pipex *context);
+void		write_pipeline_series(t_pipex *context, int fd);
+void		write_stage_series(t_pipex *context, int fd);
+void		put_metric_header(const t_metric *metric, int fd);
+void		put_long_fd(long n, int fd);
+void		put_seconds_fd(long ns, int fd);
+void		put_label_fd(const char *value, int fd);
+
+// json report
+void		buf_append(t_buf *buf, const char *data, size_t len);
+void		buf_puts(t_buf *buf, const char *str);
+void		buf_long(t_buf *buf, long n);
+void		json_string(t_buf *buf, const char *str);
+void		json_str(t_buf *buf, const char *key, const char *str);
+void		json_long(t_buf *buf, const char *key, long n);
+void		json_bool(t_buf *buf, const char *key, int value);
+void		write_report(t_pipex *context);
+void		report_stages(t_pipex *context, t_buf *buf);
+long		epoch_ns(t_pipex *context, long mono_ns);
+
+// sampler
+void		init_sampler(t_pipex *context);
+int			sample_pipes(t_pipex *context, pid_t *pids);
+void		take_sample(t_pipex *context);
+void		print_backpressure(t_pipex *context);
+void		free_sampler(t_sampler *sampler);
 
 #endif
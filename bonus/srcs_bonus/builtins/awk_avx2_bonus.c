@@ -0,0 +1,68 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   awk_avx2_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:15:49 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:15:49 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+
+# include <immintrin.h>
+
+/**
+ * @brief Marks the field separators of a 64 byte block (AVX2)
+ *
+ * With the default FS, fields are separated by runs of spaces and tabs,
+ * and the newline ends the record.
+ *
+ * @param p Start of the block, 64 readable bytes
+ * @param nl Receives the bitmask of the newlines
+ * @return Bitmask of the spaces, tabs and newlines, bit k standing for
+ * p[k]
+ */
+__attribute__((target("avx2")))
+uint64_t	awk_mask_avx2(const unsigned char *p, uint64_t *nl)
+{
+	__m256i		lo;
+	__m256i		hi;
+	__m256i		lo_nl;
+	__m256i		hi_nl;
+
+	lo = _mm256_loadu_si256((const __m256i *)p);
+	hi = _mm256_loadu_si256((const __m256i *)(p + 32));
+	lo_nl = _mm256_cmpeq_epi8(lo, _mm256_set1_epi8('\n'));
+	hi_nl = _mm256_cmpeq_epi8(hi, _mm256_set1_epi8('\n'));
+	*nl = (uint64_t)(uint32_t)_mm256_movemask_epi8(lo_nl)
+		| (uint64_t)(uint32_t)_mm256_movemask_epi8(hi_nl) << 32;
+	lo = _mm256_or_si256(_mm256_or_si256(lo_nl,
+				_mm256_cmpeq_epi8(lo, _mm256_set1_epi8(' '))),
+			_mm256_cmpeq_epi8(lo, _mm256_set1_epi8('\t')));
+	hi = _mm256_or_si256(_mm256_or_si256(hi_nl,
+				_mm256_cmpeq_epi8(hi, _mm256_set1_epi8(' '))),
+			_mm256_cmpeq_epi8(hi, _mm256_set1_epi8('\t')));
+	return ((uint64_t)(uint32_t)_mm256_movemask_epi8(lo)
+		| (uint64_t)(uint32_t)_mm256_movemask_epi8(hi) << 32);
+}
+
+#else
+
+/**
+ * @brief AVX2 is x86 only; builds the mask with the scalar loop
+ *
+ * @param p Start of the block, 64 readable bytes
+ * @param nl Receives the bitmask of the newlines
+ * @return Bitmask of the spaces, tabs and newlines
+ */
+uint64_t	awk_mask_avx2(const unsigned char *p, uint64_t *nl)
+{
+	return (awk_mask_scalar(p, 64, nl));
+}
+
+#endif
@@ -0,0 +1,193 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   awk_parse_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:15:49 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:15:49 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Tells whether a name is an awk keyword, builtin function or
+ * builtin variable other than the four the shapes use
+ *
+ * @param s Name
+ * @param len Length of the name
+ * @return 1 if reserved, 0 for a plain variable name
+ */
+static int	awk_reserved(const char *s, size_t len)
+{
+	static const char	*words[] = {"BEGIN", "function", "func", "getline",
+		"printf", "if", "else", "while", "do", "break", "continue", "next",
+		"nextfile", "exit", "return", "delete", "length", "substr", "index",
+		"split", "sub", "gsub", "match", "sprintf", "sin", "cos", "atan2",
+		"exp", "log", "sqrt", "int", "rand", "srand", "tolower", "toupper",
+		"system", "close", "fflush", "NR", "NF", "FNR", "FS", "OFS", "ORS",
+		"RS", "FILENAME", "SUBSEP", "RSTART", "RLENGTH", "CONVFMT", "OFMT",
+		"ENVIRON", "ARGC", "ARGV", NULL};
+	int					i;
+
+	i = 0;
+	while (words[i])
+	{
+		if (ft_strlen(words[i]) == len && ft_strncmp(words[i], s, len) == 0)
+			return (1);
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Lexes a name: print, END, for and in become P, E, F and I, any
+ * other variable becomes v and is remembered
+ *
+ * @param lex Lexer
+ * @return 0 on success, -1 for a reserved name or too many names
+ */
+static int	awk_lex_word(t_awk_lex *lex)
+{
+	static const char	*keys[] = {"print", "END", "for", "in", NULL};
+	const char			*s;
+	size_t				len;
+	int					k;
+
+	s = lex->s + lex->i;
+	len = 0;
+	while (ft_isalnum(s[len]) || s[len] == '_')
+		len++;
+	lex->i += len;
+	k = 0;
+	while (keys[k] && !(ft_strlen(keys[k]) == len
+			&& ft_strncmp(keys[k], s, len) == 0))
+		k++;
+	if (keys[k])
+		return (awk_push(lex, "PEFI"[k]));
+	if (awk_reserved(s, len) || lex->names_n == AWK_NAMES)
+		return (-1);
+	lex->names[lex->names_n] = s;
+	lex->lens[lex->names_n++] = len;
+	return (awk_push(lex, 'v'));
+}
+
+/**
+ * @brief Lexes a decimal constant, with the sign when it follows == or
+ * !=, into awk->num
+ *
+ * Hexadecimal and out of range constants are declined (strtod() must
+ * stop where the decimal syntax does); the string form
+ * used for string comparisons is formatted as awk's CONVFMT would.
+ *
+ * @param lex Lexer
+ * @param awk Program being recognized
+ * @return 0 on success, -1 otherwise
+ */
+static int	awk_lex_number(t_awk_lex *lex, t_awk *awk)
+{
+	const char	*s;
+	char		*end;
+	size_t		len;
+
+	s = lex->s + lex->i;
+	len = (s[0] == '-');
+	while (ft_isdigit(s[len]))
+		len++;
+	len += (s[len] == '.');
+	while (ft_isdigit(s[len]))
+		len++;
+	if ((s[len] == 'e' || s[len] == 'E') && (ft_isdigit(s[len + 1])
+			|| ((s[len + 1] == '+' || s[len + 1] == '-')
+				&& ft_isdigit(s[len + 2]))))
+		len += 2;
+	while (ft_isdigit(s[len]))
+		len++;
+	errno = 0;
+	awk->num = strtod(s, &end);
+	if (end != s + len || errno == ERANGE)
+		return (-1);
+	awk->len = awk_format(awk->buf, awk->num);
+	awk->text = awk->buf;
+	lex->i += len;
+	return (awk_push(lex, 'n'));
+}
+
+/**
+ * @brief Lexes a field reference $N into awk->field, or a string
+ * constant without escapes into awk->text
+ *
+ * @param lex Lexer
+ * @param awk Program being recognized
+ * @return 0 on success, -1 otherwise
+ */
+static int	awk_lex_operand(t_awk_lex *lex, t_awk *awk)
+{
+	const char	*s;
+	size_t		len;
+	long		n;
+
+	s = lex->s + lex->i;
+	len = 1;
+	if (s[0] == '"')
+	{
+		while (s[len] && !ft_strchr("\"\\\n", s[len]))
+			len++;
+		if (s[len] != '"')
+			return (-1);
+		awk->text = s + 1;
+		awk->len = len - 1;
+		lex->i += len + 1;
+		return (awk_push(lex, 's'));
+	}
+	n = 0;
+	while (ft_isdigit(s[len]) && n <= AWK_MAX_FIELD)
+		n = n * 10 + s[len++] - '0';
+	if (len == 1 || n > AWK_MAX_FIELD)
+		return (-1);
+	awk->field = n;
+	lex->i += len;
+	return (awk_push(lex, 'f'));
+}
+
+/**
+ * @brief Turns an awk program into a shape string, one character per
+ * token, collecting the field, the constant and the variable names
+ *
+ * Blanks are skipped; newlines and semicolons become ';', which
+ * awk_push() drops wherever they only separate items.
+ *
+ * @param prog Program text
+ * @param lex Lexer, filled with the shape
+ * @param awk Program being recognized
+ * @return 0 on success, -1 on anything the shapes do not use
+ */
+int	awk_lex(const char *prog, t_awk_lex *lex, t_awk *awk)
+{
+	char	c;
+	int		err;
+
+	ft_memset(lex, 0, sizeof(t_awk_lex));
+	lex->s = prog;
+	err = 0;
+	while (!err && prog[lex->i])
+	{
+		c = prog[lex->i];
+		if (c == '\n' && lex->n > 0)
+			err = awk_push(lex, ';');
+		if (c == ' ' || c == '\t' || c == '\n')
+			lex->i++;
+		else if (ft_isalpha(c) || c == '_')
+			err = awk_lex_word(lex);
+		else if (ft_isdigit(c) || c == '.' || (c == '-' && lex->n > 0
+				&& ft_strchr("QX", lex->shape[lex->n - 1])))
+			err = awk_lex_number(lex, awk);
+		else if (c == '$' || c == '"')
+			err = awk_lex_operand(lex, awk);
+		else
+			err = awk_lex_op(lex);
+	}
+	return (err);
+}
@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   awk_run_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:15:49 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:15:49 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Runs {print $N} over a block of records
+ *
+ * @param run Awk in progress
+ * @param p Block
+ * @param end End of the block, which ends with a newline
+ * @return 0 on success, -1 on write error
+ */
+static int	awk_print(t_awk_run *run, const char *p, const char *end)
+{
+	while (p < end)
+	{
+		p = awk_record(run, p, end) + 1;
+		if (run->field[run->len] == '\n')
+		{
+			if (out_write(&run->out, run->field, run->len + 1) < 0)
+				return (-1);
+		}
+		else if (out_write(&run->out, run->field, run->len) < 0
+			|| out_write(&run->out, "\n", 1) < 0)
+			return (-1);
+	}
+	return (0);
+}
+
+/**
+ * @brief Runs {s+=$N} over a block of records, the END rule printing the
+ * sum
+ *
+ * @param run Awk in progress
+ * @param p Block
+ * @param end End of the block, which ends with a newline
+ */
+static void	awk_sum(t_awk_run *run, const char *p, const char *end)
+{
+	while (p < end)
+	{
+		p = awk_record(run, p, end) + 1;
+		run->sum += awk_tonum(run->field, run->len);
+		run->records++;
+	}
+}
+
+/**
+ * @brief Runs $N==X or $N!=X over a block of records, printing the
+ * records selected
+ *
+ * @param run Awk in progress
+ * @param p Block
+ * @param end End of the block, which ends with a newline
+ * @return 0 on success, -1 on write error
+ */
+static int	awk_filter(t_awk_run *run, const char *p, const char *end)
+{
+	const char	*eol;
+
+	while (p < end)
+	{
+		eol = awk_record(run, p, end);
+		if (awk_match(run->awk, run->field, run->len)
+			&& out_write(&run->out, p, eol + 1 - p) < 0)
+			return (-1);
+		p = eol + 1;
+	}
+	return (0);
+}
+
+/**
+ * @brief Runs {c[$N]++} over a block of records
+ *
+ * The counts live in the hash table of @distinct, which keeps the keys
+ * in their order of first appearance for the END rule.
+ *
+ * @param run Awk in progress
+ * @param p Block
+ * @param end End of the block, which ends with a newline
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	awk_count(t_awk_run *run, const char *p, const char *end)
+{
+	while (p < end)
+	{
+		p = awk_record(run, p, end) + 1;
+		if (dist_add(&run->table, run->field, run->len, 1) < 0)
+			return (-1);
+	}
+	return (0);
+}
+
+/**
+ * @brief Runs the main rule of the program over a block of records
+ *
+ * @param run Awk in progress
+ * @param p Block, ending with a newline
+ * @param len Size of the block
+ * @return 0 on success, -2 on write error, -3 on allocation failure
+ */
+int	awk_block(t_awk_run *run, const char *p, size_t len)
+{
+	if (run->awk->kind == AWK_PRINT)
+		return (2 * awk_print(run, p, p + len));
+	if (run->awk->kind == AWK_FILTER)
+		return (2 * awk_filter(run, p, p + len));
+	if (run->awk->kind == AWK_COUNT)
+		return (3 * awk_count(run, p, p + len));
+	awk_sum(run, p, p + len);
+	return (0);
+}
@@ -0,0 +1,160 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   awk_shape_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:15:49 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:15:49 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Appends a token to the shape string
+ *
+ * A ';' right after '{', '}' or another ';' separates nothing and is
+ * dropped, as are the ';' closing the last statement of a block.
+ *
+ * @param lex Lexer
+ * @param c Token character
+ * @return 0 on success, -1 if the program is too long for any shape
+ */
+int	awk_push(t_awk_lex *lex, char c)
+{
+	if (c == ';' && lex->n > 0 && ft_strchr("{};", lex->shape[lex->n - 1]))
+		return (0);
+	while (c == '}' && lex->n > 0 && lex->shape[lex->n - 1] == ';')
+		lex->n--;
+	if (lex->n + 1 >= AWK_SHAPE)
+		return (-1);
+	lex->shape[lex->n++] = c;
+	lex->shape[lex->n] = '\0';
+	return (0);
+}
+
+/**
+ * @brief Lexes an operator or a punctuation character
+ *
+ * +=, ++, == and != become A, U, Q and X; the characters the shapes use
+ * stand for themselves.
+ *
+ * @param lex Lexer
+ * @return 0 on success, -1 for any other character
+ */
+int	awk_lex_op(t_awk_lex *lex)
+{
+	static const char	*ops[] = {"+=", "++", "==", "!=", NULL};
+	const char			*s;
+	int					k;
+
+	s = lex->s + lex->i;
+	k = 0;
+	while (ops[k] && ft_strncmp(ops[k], s, 2) != 0)
+		k++;
+	if (ops[k])
+	{
+		lex->i += 2;
+		return (awk_push(lex, "AUQX"[k]));
+	}
+	if (!ft_strchr("{}[](),;", s[0]))
+		return (-1);
+	lex->i++;
+	return (awk_push(lex, s[0]));
+}
+
+/**
+ * @brief Checks the variable names against the classes of a shape
+ *
+ * Two names must be the same exactly when their class letters are, so
+ * "ababab" wants an array and a key variable used three times each.
+ *
+ * @param lex Lexed program
+ * @param classes One class letter per name, in order
+ * @return 1 if the names fit, 0 otherwise
+ */
+static int	awk_names(const t_awk_lex *lex, const char *classes)
+{
+	int	i;
+	int	j;
+	int	same;
+
+	if (lex->names_n != (int)ft_strlen(classes))
+		return (0);
+	i = 0;
+	while (i < lex->names_n)
+	{
+		j = 0;
+		while (j < i)
+		{
+			same = (lex->lens[i] == lex->lens[j] && ft_strncmp(lex->names[i],
+						lex->names[j], lex->lens[i]) == 0);
+			if (same != (classes[i] == classes[j]))
+				return (0);
+			j++;
+		}
+		i++;
+	}
+	return (1);
+}
+
+/**
+ * @brief Returns the shapes the builtin runs natively
+ *
+ * Shape strings use f for $N, n and s for constants, v for variables,
+ * P, E, F and I for print, END, for and in.
+ *
+ * @return Table ending with a NULL shape
+ */
+static const t_awk_shape	*awk_shapes(void)
+{
+	static const t_awk_shape	shapes[] = {
+	{"{Pf}", "", AWK_PRINT, 0},
+	{"{vAf}E{Pv}", "aa", AWK_SUM, AWK_NUMERIC},
+	{"fQn", "", AWK_FILTER, AWK_NUMERIC},
+	{"fXn", "", AWK_FILTER, AWK_NUMERIC | AWK_NOT},
+	{"fQs", "", AWK_FILTER, 0},
+	{"fXs", "", AWK_FILTER, AWK_NOT},
+	{"{v[f]U}E{F(vIv)Pv,v[v]}", "ababab", AWK_COUNT, 0},
+	{"{v[f]U}E{F(vIv){Pv,v[v]}}", "ababab", AWK_COUNT, 0},
+	{NULL, NULL, 0, 0}
+	};
+
+	return (shapes);
+}
+
+/**
+ * @brief Recognizes the awk programs the builtin runs natively
+ *
+ * The program is lexed into a shape string and looked up in the table:
+ * {print $N}, {s+=$N} END{print s}, $N==X, $N!=X and
+ * {c[$N]++} END{for(k in c) print k, c[k]}.
+ *
+ * @param prog Program text
+ * @param awk Receives the kind, the field and the constant
+ * @return 0 if the program has one of the shapes, -1 otherwise
+ */
+int	parse_awk_program(const char *prog, t_awk *awk)
+{
+	const t_awk_shape	*shapes;
+	t_awk_lex			lex;
+	int					k;
+
+	if (awk_lex(prog, &lex, awk) < 0)
+		return (-1);
+	while (lex.n > 0 && lex.shape[lex.n - 1] == ';')
+		lex.n--;
+	lex.shape[lex.n] = '\0';
+	shapes = awk_shapes();
+	k = 0;
+	while (shapes[k].shape && !(ft_strncmp(shapes[k].shape, lex.shape,
+				AWK_SHAPE) == 0 && awk_names(&lex, shapes[k].names)))
+		k++;
+	if (!shapes[k].shape)
+		return (-1);
+	awk->kind = shapes[k].kind;
+	awk->flags = shapes[k].flags;
+	return (0);
+}
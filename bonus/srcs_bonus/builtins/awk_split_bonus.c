@@ -0,0 +1,155 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   awk_split_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:15:49 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:15:49 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Marks the field separators of up to 64 bytes
+ *
+ * @param p Start of the block
+ * @param len Size of the block, at most 64
+ * @param nl Receives the bitmask of the newlines
+ * @return Bitmask of the spaces, tabs and newlines, bit k standing for
+ * p[k]
+ */
+uint64_t	awk_mask_scalar(const unsigned char *p, size_t len, uint64_t *nl)
+{
+	uint64_t	mask;
+
+	mask = 0;
+	*nl = 0;
+	while (len > 0)
+	{
+		len--;
+		*nl = *nl << 1 | (p[len] == '\n');
+		mask = mask << 1 | (p[len] == ' ' || p[len] == '\t'
+				|| p[len] == '\n');
+	}
+	return (mask);
+}
+
+/**
+ * @brief Marks the field separators of the next 64 bytes with the widest
+ * kernel the CPU supports
+ *
+ * @param p Start of the block
+ * @param len Bytes left from p (only the first 64 are looked at)
+ * @param nl Receives the bitmask of the newlines
+ * @return Bitmask of the spaces, tabs and newlines
+ */
+uint64_t	awk_mask(const unsigned char *p, size_t len, uint64_t *nl)
+{
+	int	level;
+
+	level = simd_level();
+	if (len >= 64 && level == 2)
+		return (awk_mask_avx2(p, nl));
+	if (len > 64)
+		len = 64;
+	return (awk_mask_scalar(p, len, nl));
+}
+
+/**
+ * @brief Finds the end of the field starting at p
+ *
+ * @param p Start of the field
+ * @param end End of the block, which ends with a newline
+ * @return First space, tab or newline from p
+ */
+static const char	*awk_field_end(const char *p, const char *end)
+{
+	uint64_t	sep;
+	uint64_t	nl;
+
+	sep = awk_mask((const unsigned char *)p, end - p, &nl);
+	while (!sep)
+	{
+		p += 64;
+		sep = awk_mask((const unsigned char *)p, end - p, &nl);
+	}
+	return (p + __builtin_ctzll(sep));
+}
+
+/**
+ * @brief Finds field n (1 based) of the record starting at p, splitting
+ * on runs of blanks as the default FS does
+ *
+ * A field starts at a byte that is not a separator and follows one (or
+ * the start of the record). Those starts are counted 64 bytes at a time
+ * with a popcount, so the fields before n are skipped without looking at
+ * them one by one.
+ *
+ * @param p Start of the record
+ * @param end End of the block, which ends with a newline
+ * @param n Field number, at least 1
+ * @param len Receives the length of the field
+ * @return Start of the field, or NULL if the record has fewer fields
+ */
+const char	*awk_field(const char *p, const char *end, int n, size_t *len)
+{
+	uint64_t	sep;
+	uint64_t	nl;
+	uint64_t	starts;
+	uint64_t	carry;
+
+	carry = 1;
+	while (1)
+	{
+		sep = awk_mask((const unsigned char *)p, end - p, &nl);
+		starts = ~sep & (sep << 1 | carry);
+		if (nl)
+			starts &= (nl & -nl) - 1;
+		if (__builtin_popcountll(starts) >= n)
+			break ;
+		if (nl)
+			return (NULL);
+		n -= __builtin_popcountll(starts);
+		carry = sep >> 63;
+		p += 64;
+	}
+	while (n-- > 1)
+		starts &= starts - 1;
+	p += __builtin_ctzll(starts);
+	*len = awk_field_end(p, end) - p;
+	return (p);
+}
+
+/**
+ * @brief Splits the record starting at p and keeps the field the program
+ * looks at in run->field and run->len
+ *
+ * $0 is the whole record; a field past the last one is empty.
+ *
+ * @param run Awk in progress
+ * @param p Start of the record
+ * @param end End of the block, which ends with a newline
+ * @return Newline ending the record
+ */
+const char	*awk_record(t_awk_run *run, const char *p, const char *end)
+{
+	const char	*eol;
+
+	run->field = p;
+	run->len = 0;
+	if (run->awk->field > 0)
+		run->field = awk_field(p, end, run->awk->field, &run->len);
+	if (!run->field)
+	{
+		run->field = "";
+		return (memchr(p, '\n', end - p));
+	}
+	eol = memchr(run->field + run->len, '\n',
+			end - (run->field + run->len));
+	if (run->awk->field == 0)
+		run->len = eol - p;
+	return (eol);
+}
@@ -0,0 +1,175 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   awk_value_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:15:49 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:15:49 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Converts a plain decimal field of up to 15 digits without
+ * strtod()
+ *
+ * The digits make an integer that a double holds exactly, and so does
+ * the power of ten it is divided by; IEEE division then rounds once, to
+ * the same value strtod() returns.
+ *
+ * @param p Field
+ * @param len Length of the field
+ * @param d Receives the value
+ * @return 1 if the field was [-]digits[.digits], 0 otherwise
+ */
+static int	awk_digits(const char *p, size_t len, double *d)
+{
+	static const double	scale[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+		1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15};
+	long				n;
+	size_t				i;
+	size_t				dot;
+
+	if (len == 0 || len > 17)
+		return (0);
+	n = 0;
+	i = (p[0] == '-');
+	dot = 0;
+	while (i < len && (ft_isdigit(p[i]) || (p[i] == '.' && !dot)))
+	{
+		if (p[i] == '.')
+			dot = i + 1;
+		else
+			n = n * 10 + p[i] - '0';
+		i++;
+	}
+	if (i < len || len - (p[0] == '-') - (dot > 0) - 1 >= 15)
+		return (0);
+	*d = (double)n / scale[(len - dot) * (dot > 0)];
+	if (p[0] == '-')
+		*d = -*d;
+	return (1);
+}
+
+/**
+ * @brief Converts a field to a number the way awk does, with the longest
+ * prefix strtod() accepts
+ *
+ * A field ends at a separator, where strtod() stops anyway. The
+ * whitespace other than separators that strtod() would skip is skipped
+ * here so that it never runs past the newline of the record.
+ *
+ * @param p Field
+ * @param len Length of the field
+ * @return Value of the field, 0 if it has no numeric prefix
+ */
+double	awk_tonum(const char *p, size_t len)
+{
+	double	d;
+
+	if (awk_digits(p, len, &d))
+		return (d);
+	while (len > 0 && *p && ft_strchr(" \t\n\v\f\r", *p))
+	{
+		p++;
+		len--;
+	}
+	if (len == 0)
+		return (0);
+	return (strtod(p, NULL));
+}
+
+/**
+ * @brief Tells whether a field looks numeric, in which case awk compares
+ * it to a numeric constant as a number
+ *
+ * As in mawk, once blanks are trimmed it must start with a sign, a dot
+ * or a digit and strtod() must take all of it.
+ *
+ * @param p Field
+ * @param len Length of the field
+ * @param d Receives the value
+ * @return 1 if the field is a numeric string, 0 otherwise
+ */
+static int	awk_strnum(const char *p, size_t len, double *d)
+{
+	char	*end;
+
+	if (awk_digits(p, len, d))
+		return (1);
+	while (len > 0 && (*p == ' ' || *p == '\t'))
+	{
+		p++;
+		len--;
+	}
+	while (len > 0 && (p[len - 1] == ' ' || p[len - 1] == '\t'))
+		len--;
+	if (len == 0 || !(ft_isdigit(*p) || *p == '+' || *p == '-' || *p == '.'))
+		return (0);
+	*d = strtod(p, &end);
+	return (end == p + len);
+}
+
+/**
+ * @brief Evaluates $N==X or $N!=X on a field
+ *
+ * A numeric string against a numeric constant compares as numbers (NaN
+ * equals nothing). Anything else compares the bytes with the string form
+ * of the constant.
+ *
+ * @param awk Recognized program
+ * @param p Field
+ * @param len Length of the field
+ * @return 1 if the record is selected, 0 otherwise
+ */
+int	awk_match(const t_awk *awk, const char *p, size_t len)
+{
+	double	d;
+	int		eq;
+
+	if ((awk->flags & AWK_NUMERIC) && awk_strnum(p, len, &d))
+		eq = (d == awk->num);
+	else
+		eq = (len == awk->len && ft_memcmp(p, awk->text, len) == 0);
+	return (eq != ((awk->flags & AWK_NOT) != 0));
+}
+
+/**
+ * @brief Formats a number the way mawk prints it
+ *
+ * Integral values in the range of an int print as integers, everything
+ * else with OFMT ("%.6g").
+ *
+ * @param buf Receives the text, AWK_NUMBUF bytes
+ * @param d Value
+ * @return Length of the text
+ */
+size_t	awk_format(char *buf, double d)
+{
+	char	digits[12];
+	long	n;
+	size_t	len;
+	int		k;
+
+	if (!(d >= -INT_MAX && d <= INT_MAX && d == (int)d))
+		return (snprintf(buf, AWK_NUMBUF, "%.6g", d));
+	n = (int)d;
+	len = 0;
+	if (n < 0)
+		buf[len++] = '-';
+	if (n < 0)
+		n = -n;
+	k = 0;
+	digits[k++] = '0' + n % 10;
+	while (n >= 10)
+	{
+		n /= 10;
+		digits[k++] = '0' + n % 10;
+	}
+	while (k > 0)
+		buf[len++] = digits[--k];
+	return (len);
+}
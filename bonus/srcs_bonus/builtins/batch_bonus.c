@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   batch_bonus.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:33:21 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:45:04 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Moves the unfinished line to the front and reads until the batch
+ * is full or the input ends
+ *
+ * The buffer is allocated cap bytes on first use and only grows when a
+ * single line fills it.
+ *
+ * @param r Reader, zeroed apart from its fd before the first call
+ * @param cap Batch size
+ * @return 0 on success (r->eof is set at end of input), -1 on read or
+ * allocation failure
+ */
+int	reader_batch(t_reader *r, size_t cap)
+{
+	ssize_t	n;
+
+	if (!r->buf)
+		r->cap = cap;
+	if (!r->buf)
+		r->buf = malloc(r->cap);
+	if (!r->buf)
+		return (-1);
+	memmove(r->buf, r->buf + r->start, r->end - r->start);
+	r->end -= r->start;
+	r->start = 0;
+	if (r->end == r->cap)
+		return (reader_fill(r));
+	while (!r->eof && r->end < r->cap)
+	{
+		n = io_read(r->fd, r->buf + r->end, r->cap - r->end);
+		if (n < 0 && errno == EINTR)
+			continue ;
+		if (n < 0)
+			return (-1);
+		r->eof = (n == 0);
+		r->end += n;
+	}
+	return (0);
+}
+
+/**
+ * @brief Cuts a batch of whole lines into count ranges at the first
+ * newlines after equal offsets
+ *
+ * Range k runs from bounds[k] to bounds[k + 1]; a line longer than a
+ * range leaves the next ones empty.
+ *
+ * @param p Batch, ending with a newline
+ * @param len Length of the batch
+ * @param count Number of ranges, at most BATCH_MAX_THREADS
+ * @param bounds Receives count + 1 range limits
+ */
+void	batch_bounds(const char *p, size_t len, int count, const char **bounds)
+{
+	const char	*q;
+	int			k;
+
+	bounds[0] = p;
+	bounds[count] = p + len;
+	k = 1;
+	while (k < count)
+	{
+		q = p + len * k / count;
+		bounds[k] = bounds[k - 1];
+		if (q > bounds[k - 1])
+			bounds[k] = (const char *)memchr(q - 1, '\n', p + len - q + 1) + 1;
+		k++;
+	}
+}
@@ -0,0 +1,154 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_awk_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:15:49 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:54:29 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Accepts awk stages whose program is one of the shapes the native
+ * kernels run
+ *
+ * The program is recognized here, once; the child inherits the kind, the
+ * field and the constant. The shapes that convert numbers are declined
+ * when LC_NUMERIC may use another decimal point.
+ *
+ * @param stage Stage whose argv is examined
+ * @return 1 on match, 0 otherwise
+ */
+int	match_awk(t_stage *stage)
+{
+	t_awk	*awk;
+
+	if (!stage->argv[1] || stage->argv[2] || stage->argv[1][0] == '-')
+		return (0);
+	awk = ft_calloc(1, sizeof(t_awk));
+	if (!awk)
+		return (0);
+	if (parse_awk_program(stage->argv[1], awk) < 0
+		|| ((awk->flags & AWK_NUMERIC) && !locale_is_c("LC_NUMERIC")))
+	{
+		free(awk);
+		return (0);
+	}
+	stage->state = awk;
+	return (1);
+}
+
+/**
+ * @brief Feeds the input to the program in blocks of whole records
+ *
+ * A last record without a newline gets one, which awk prints anyway, so
+ * that every block ends with a newline.
+ *
+ * @param run Awk in progress
+ * @param fd Source file descriptor
+ * @return 0 on success, -1 on read error, -2 on write error, -3 on
+ * allocation failure
+ */
+static int	awk_input(t_awk_run *run, int fd)
+{
+	t_reader	reader;
+	char		*nl;
+	size_t		len;
+	int			status;
+
+	if (reader_init(&reader, fd) < 0)
+		return (-3);
+	status = 0;
+	while (status == 0 && !(reader.eof && reader.start == reader.end))
+	{
+		len = reader.end - reader.start;
+		nl = memrchr(reader.buf + reader.start, '\n', len);
+		if (!nl && (!reader.eof || reader.end == reader.cap))
+			status = -(reader_fill(&reader) < 0);
+		else if (!nl)
+			reader.buf[reader.end++] = '\n';
+		else
+		{
+			len = nl + 1 - (reader.buf + reader.start);
+			status = awk_block(run, reader.buf + reader.start, len);
+			reader.start += len;
+		}
+	}
+	reader_free(&reader);
+	return (status);
+}
+
+/**
+ * @brief Runs the END rule: prints the sum, or every key with its count
+ *
+ * An empty input leaves the sum uninitialized, which prints as an empty
+ * line. Keys come out in their order of first appearance, one of the
+ * orders for (k in c) may take.
+ *
+ * @param run Awk in progress
+ * @return 0 on success, -1 on write error
+ */
+int	awk_end(t_awk_run *run)
+{
+	const t_dist_entry	*e;
+	char				num[AWK_NUMBUF + 1];
+	size_t				len;
+	size_t				j;
+
+	if (run->awk->kind == AWK_SUM)
+	{
+		len = 0;
+		if (run->records)
+			len = awk_format(num, run->sum);
+		num[len] = '\n';
+		return (out_write(&run->out, num, len + 1));
+	}
+	j = 0;
+	while (run->awk->kind == AWK_COUNT && j < run->table.n)
+	{
+		e = &run->table.entries[j++];
+		len = awk_format(num + 1, e->count);
+		num[0] = ' ';
+		num[len + 1] = '\n';
+		if (out_write(&run->out, run->table.arena.data + e->off, e->len) < 0
+			|| out_write(&run->out, num, len + 2) < 0)
+			return (-1);
+	}
+	return (0);
+}
+
+/**
+ * @brief Runs a recognized awk program over stdin without exec'ing awk
+ *
+ * @param stage Stage holding the recognized program
+ * @param in_fd Source file descriptor
+ * @param out_fd Destination file descriptor
+ * @return 0 on success, AWK_FAILURE (awk's status for fatal errors) on
+ * error
+ */
+int	run_awk(t_stage *stage, int in_fd, int out_fd)
+{
+	t_awk_run	run;
+	int			status;
+
+	ft_memset(&run, 0, sizeof(t_awk_run));
+	run.awk = stage->state;
+	out_init(&run.out, out_fd);
+	status = awk_input(&run, in_fd);
+	if (status == 0 && (awk_end(&run) < 0 || out_flush(&run.out) < 0))
+		status = -2;
+	free(run.table.arena.data);
+	free(run.table.entries);
+	free(run.table.slots);
+	if (status == -1)
+		return (builtin_error("awk", "read error") - 1 + AWK_FAILURE);
+	if (status == -3)
+		return (builtin_error("awk", "out of memory") - 1 + AWK_FAILURE);
+	if (status < 0)
+		return (builtin_error("awk", "write failure") - 1 + AWK_FAILURE);
+	return (0);
+}
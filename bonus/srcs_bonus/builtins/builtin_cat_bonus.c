@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_cat_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:27:56 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:27:56 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Accepts only a plain "cat" with no options or file operands
+ *
+ * @param stage Stage whose argv is examined
+ * @return 1 if the stage is a bare cat, 0 otherwise
+ */
+int	match_cat(t_stage *stage)
+{
+	return (stage->argv[1] == NULL);
+}
+
+/**
+ * @brief Tells whether a zero-copy call failed for a reason worth retrying
+ * with plain read/write (unsupported file type, O_APPEND, old kernel...)
+ *
+ * @param err errno left by the failed call
+ * @return 1 if the copy should fall back, 0 for a real I/O error
+ */
+static int	should_fall_back(int err)
+{
+	return (err == EINVAL || err == ENOSYS || err == EXDEV
+		|| err == EOPNOTSUPP || err == EBADF);
+}
+
+/**
+ * @brief Drives move_pipe() or copy_range() until EOF
+ *
+ * @param in_fd Source file descriptor
+ * @param out_fd Destination file descriptor
+ * @param use_splice 1 to use splice (a pipe is involved), 0 for
+ * copy_file_range
+ * @return 0 at EOF, IO_FALLBACK if the kernel refused, -1 on error
+ */
+static int	zero_copy(int in_fd, int out_fd, int use_splice)
+{
+	ssize_t	n;
+
+	while (1)
+	{
+		if (use_splice)
+			n = move_pipe(in_fd, out_fd, IO_CHUNK);
+		else
+			n = copy_range(in_fd, out_fd, IO_CHUNK);
+		if (n == 0)
+			return (0);
+		if (n < 0 && should_fall_back(errno))
+			return (IO_FALLBACK);
+		if (n < 0 && errno != EINTR)
+			return (-1);
+	}
+}
+
+/**
+ * @brief Copies stdin to stdout without exec'ing /bin/cat
+ *
+ * A pipe on either side is served with splice(); file to file goes
+ * through copy_file_range(). Whatever the kernel refuses (or what is left
+ * after a partial transfer) is finished with read/write, since all three
+ * paths advance the same file offsets.
+ *
+ * @param stage Unused, a bare cat has no state
+ * @param in_fd Source file descriptor
+ * @param out_fd Destination file descriptor
+ * @return 0 on success, 1 on I/O error
+ */
+int	run_cat(t_stage *stage, int in_fd, int out_fd)
+{
+	int	ret;
+
+	(void)stage;
+	ret = zero_copy(in_fd, out_fd, fd_is_fifo(in_fd) || fd_is_fifo(out_fd));
+	if (ret == IO_FALLBACK)
+		ret = copy_fd(in_fd, out_fd);
+	if (ret < 0)
+		return (builtin_error("cat", "copy failed"));
+	return (0);
+}
@@ -0,0 +1,133 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_cut_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:54:45 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:54:29 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Frees the builtin cut state attached to a stage
+ *
+ * @param state t_cut built by match_cut()
+ */
+void	free_cut(void *state)
+{
+	t_cut	*cut;
+
+	cut = state;
+	free(cut->ranges);
+	free(cut);
+}
+
+/**
+ * @brief Accepts cut stages reading stdin with -b, -c or -f
+ *
+ * The list is parsed here, once, into sorted ranges that the child
+ * inherits. Fields are joined by the input delimiter unless
+ * --output-delimiter is given.
+ *
+ * @param stage Stage whose argv is examined
+ * @return 1 on match, 0 otherwise
+ */
+int	match_cut(t_stage *stage)
+{
+	t_cut	*cut;
+
+	cut = malloc(sizeof(t_cut));
+	if (!cut)
+		return (0);
+	if (parse_cut_argv(stage->argv, cut) < 0)
+	{
+		free_cut(cut);
+		return (0);
+	}
+	if (!(cut->flags & CUT_OUTDELIM))
+	{
+		cut->outdelim = &cut->delim;
+		cut->outlen = 1;
+	}
+	stage->state = cut;
+	return (1);
+}
+
+/**
+ * @brief Cuts a block of whole lines with the kernel of the mode
+ *
+ * @param run Cut in progress
+ * @param p Block
+ * @param len Size of the block
+ * @return 0 on success, -1 on write error
+ */
+int	cut_block(t_cut_run *run, const char *p, size_t len)
+{
+	if (run->cut->flags & CUT_FIELDS)
+		return (cut_fields(run, p, len));
+	return (cut_bytes(run, p, len));
+}
+
+/**
+ * @brief Feeds the input to the cutter in blocks of whole lines
+ *
+ * @param run Cut in progress
+ * @param fd Source file descriptor
+ * @return 0 on success, -1 on read error, -2 on write error
+ */
+static int	cut_input(t_cut_run *run, int fd)
+{
+	t_reader	reader;
+	char		*nl;
+	size_t		len;
+	int			status;
+
+	if (reader_init(&reader, fd) < 0)
+		return (-1);
+	status = 0;
+	while (status == 0 && !(reader.eof && reader.start == reader.end))
+	{
+		len = reader.end - reader.start;
+		nl = memrchr(reader.buf + reader.start, '\n', len);
+		if (nl)
+			len = nl + 1 - (reader.buf + reader.start);
+		if (!nl && !reader.eof)
+			status = -(reader_fill(&reader) < 0);
+		else
+		{
+			status = -2 * (cut_block(run, reader.buf + reader.start, len) < 0);
+			reader.start += len;
+		}
+	}
+	reader_free(&reader);
+	return (status);
+}
+
+/**
+ * @brief Prints the selected bytes or fields of every line of stdin
+ * without exec'ing cut
+ *
+ * @param stage Stage holding the parsed selection
+ * @param in_fd Source file descriptor
+ * @param out_fd Destination file descriptor
+ * @return 0 on success, 1 on error
+ */
+int	run_cut(t_stage *stage, int in_fd, int out_fd)
+{
+	t_cut_run	run;
+	int			status;
+
+	ft_memset(&run, 0, sizeof(t_cut_run));
+	run.cut = stage->state;
+	run.index = 1;
+	out_init(&run.out, out_fd);
+	status = cut_input(&run, in_fd);
+	if (status == -1)
+		return (builtin_error("cut", "read error"));
+	if (status < 0 || out_flush(&run.out) < 0)
+		return (builtin_error("cut", "write error"));
+	return (0);
+}
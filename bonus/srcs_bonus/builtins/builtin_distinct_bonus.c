@@ -0,0 +1,136 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_distinct_bonus.c                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:45:48 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:23:02 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Parses "@distinct [-c] [-S SIZE]"
+ *
+ * @param argv Stage argument vector
+ * @param d Receives the flags and the memory budget (a quarter of RAM
+ * if not given)
+ * @return 0 on success, -1 on malformed arguments
+ */
+static int	parse_distinct(char **argv, t_distinct *d)
+{
+	int	i;
+
+	i = 1;
+	while (argv[i])
+	{
+		if (ft_strncmp(argv[i], "-c", 3) == 0)
+			d->flags |= DIST_COUNT;
+		else if (ft_strncmp(argv[i], "-S", 3) == 0 && argv[i + 1]
+			&& parse_size(argv[i + 1], &d->budget) == 0)
+			i++;
+		else if (ft_strncmp(argv[i], "-S", 2) != 0 || !argv[i][2]
+			|| parse_size(argv[i] + 2, &d->budget) < 0)
+			return (-1);
+		i++;
+	}
+	if (!d->budget && sysconf(_SC_PHYS_PAGES) > 0)
+		d->budget = sysconf(_SC_PHYS_PAGES) * sysconf(_SC_PAGESIZE) / 4;
+	return (0);
+}
+
+/**
+ * @brief Accepts a well formed @distinct stage
+ *
+ * @param stage Stage whose argv is examined
+ * @return 1 on match, 0 otherwise
+ */
+int	match_distinct(t_stage *stage)
+{
+	t_distinct	d;
+
+	ft_memset(&d, 0, sizeof(t_distinct));
+	return (parse_distinct(stage->argv, &d) == 0);
+}
+
+/**
+ * @brief Empties the table, keeping its allocations for reuse
+ *
+ * @param d Distinct table
+ */
+void	dist_clear(t_distinct *d)
+{
+	if (d->slots)
+		ft_bzero(d->slots, sizeof(uint64_t) * (d->mask + 1));
+	d->n = 0;
+	d->arena.len = 0;
+}
+
+/**
+ * @brief Frees the table and closes the partition files
+ *
+ * @param d Distinct table
+ */
+static void	dist_free(t_distinct *d)
+{
+	int	p;
+
+	p = 0;
+	while (d->parts && p < DIST_PARTS)
+	{
+		if (d->parts[p] >= 0)
+			close(d->parts[p]);
+		p++;
+	}
+	free(d->parts);
+	free(d->outs);
+	free(d->arena.data);
+	free(d->entries);
+	free(d->slots);
+}
+
+/**
+ * @brief Outputs each distinct input line once (sort -u), or with its
+ * number of occurrences under -c (sort | uniq -c), in no sorted order
+ *
+ * Lines are counted in a hash table in one pass instead of being sorted.
+ * Past the memory budget (-S, else a quarter of RAM) the table is moved
+ * out to partition files by hash, and each partition is counted on its
+ * own at the end.
+ *
+ * @param stage Stage holding the "@distinct" argv
+ * @param in_fd Source file descriptor
+ * @param out_fd Destination file descriptor
+ * @return 0 on success, 1 on error
+ */
+int	run_distinct(t_stage *stage, int in_fd, int out_fd)
+{
+	t_distinct	d;
+	t_reader	reader;
+	char		*line;
+	size_t		len;
+	int			ret;
+
+	ft_memset(&d, 0, sizeof(t_distinct));
+	if (parse_distinct(stage->argv, &d) < 0 || reader_init(&reader, in_fd) < 0)
+		return (builtin_error("@distinct", "setup failed"));
+	ret = next_line(&reader, &line, &len);
+	while (ret > 0 && dist_add(&d, line, len, 1) >= 0)
+	{
+		if (d.arena.len + d.n * (sizeof(t_dist_entry) + 16) > d.budget
+			&& dist_spill(&d) < 0)
+			ret = -1;
+		else
+			ret = next_line(&reader, &line, &len);
+	}
+	reader_free(&reader);
+	if (ret == 0)
+		ret = dist_drain(&d, out_fd);
+	else if (ret > 0)
+		builtin_error("@distinct", "memory exhausted");
+	dist_free(&d);
+	return (ret != 0);
+}
@@ -0,0 +1,165 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_grep_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:50:49 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:50:49 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Frees the builtin grep state attached to a stage
+ *
+ * @param state t_grep built by match_grep()
+ */
+void	free_grep(void *state)
+{
+	t_grep	*grep;
+
+	grep = state;
+	free(grep->text.data);
+	free(grep->patterns);
+	free(grep->ac.delta);
+	free(grep->ac.accept);
+	free(grep);
+}
+
+/**
+ * @brief Accepts grep stages searching stdin for fixed strings
+ *
+ * Supported: -F/-G/-E with patterns free of regular expression operators,
+ * -e, -f, -v, -c, -i (C locale only) and -m. The patterns are compiled
+ * here, once, and the child inherits them.
+ *
+ * @param stage Stage whose argv is examined
+ * @return 1 on match, 0 otherwise
+ */
+int	match_grep(t_stage *stage)
+{
+	t_grep	*grep;
+	int		kind;
+
+	grep = ft_calloc(1, sizeof(t_grep));
+	if (!grep)
+		return (0);
+	grep->max_count = -1;
+	kind = ctype_locale();
+	grep->utf8 = (kind == CTYPE_UTF8);
+	if (kind == CTYPE_OTHER || parse_grep_argv(stage->argv, grep) < 0
+		|| __builtin_popcount(grep->flags & (GREP_FIXED | GREP_EXTENDED
+				| GREP_BASIC)) > 1 || (grep->utf8 && grep->flags & GREP_ICASE)
+		|| grep_compile(grep) < 0)
+	{
+		free_grep(grep);
+		return (0);
+	}
+	stage->state = grep;
+	return (1);
+}
+
+/**
+ * @brief Reads more input, switching to binary mode on a NUL byte
+ *
+ * As in GNU grep, once a NUL is seen the unread part of the input is
+ * binary: NULs end lines and selected lines are no longer printed.
+ *
+ * @param run Search in progress
+ * @param reader Input buffer
+ * @return 0 on success, -1 on read or allocation error
+ */
+static int	grep_fill(t_grep_run *run, t_reader *reader)
+{
+	char	*nul;
+
+	if (reader_fill(reader) < 0)
+		return (-1);
+	if (!run->binary && memchr(reader->buf, '\0', reader->end))
+		run->binary = 1;
+	if (!run->binary)
+		return (0);
+	nul = memchr(reader->buf, '\0', reader->end);
+	while (nul)
+	{
+		*nul = '\n';
+		nul = memchr(nul + 1, '\0', reader->buf + reader->end - nul - 1);
+	}
+	return (0);
+}
+
+/**
+ * @brief Feeds the input to the matcher in blocks of whole lines
+ *
+ * @param run Search in progress
+ * @param fd Source file descriptor
+ * @return 0 on success, -1 on read error, -2 on write error
+ */
+static int	grep_input(t_grep_run *run, int fd)
+{
+	t_reader	reader;
+	char		*nl;
+	size_t		len;
+	int			status;
+
+	if (reader_init(&reader, fd) < 0)
+		return (-1);
+	status = 0;
+	while (!run->stop && status == 0
+		&& !(reader.eof && reader.start == reader.end))
+	{
+		len = reader.end - reader.start;
+		nl = memrchr(reader.buf + reader.start, '\n', len);
+		if (nl)
+			len = nl + 1 - (reader.buf + reader.start);
+		if (!nl && !reader.eof)
+			status = grep_fill(run, &reader);
+		else
+		{
+			status = -2 * (grep_block(run, reader.buf + reader.start, len) < 0);
+			reader.start += len;
+		}
+	}
+	reader_free(&reader);
+	return (status);
+}
+
+/**
+ * @brief Searches stdin like grep without exec'ing grep
+ *
+ * @param stage Stage holding the compiled patterns
+ * @param in_fd Source file descriptor
+ * @param out_fd Destination file descriptor
+ * @return GNU grep's status: 0 if a line was selected, 1 if none, 2 on
+ * error
+ */
+int	run_grep(t_stage *stage, int in_fd, int out_fd)
+{
+	t_grep_run	run;
+	int			status;
+
+	ft_memset(&run, 0, sizeof(t_grep_run));
+	run.grep = stage->state;
+	out_init(&run.out, out_fd);
+	status = 0;
+	if (run.grep->max_count != 0)
+		status = grep_input(&run, in_fd);
+	if (status == -1)
+		return (builtin_error("grep", "read error") + 1);
+	if (status == 0 && (run.grep->flags & GREP_COUNT)
+		&& run.grep->max_count != 0)
+	{
+		out_flush(&run.out);
+		put_long_fd(run.selected, out_fd);
+		write_all(out_fd, "\n", 1);
+	}
+	if (status < 0 || out_flush(&run.out) < 0)
+		return (builtin_error("grep", "write error") + 1);
+	if (run.notice)
+		ft_putstr_fd("grep: (standard input): binary file matches\n",
+			STDERR_FILENO);
+	return (run.selected == 0);
+}
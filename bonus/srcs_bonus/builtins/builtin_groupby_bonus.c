@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_groupby_bonus.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:23:02 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:23:02 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Claims @groupby stages whose arguments parse
+ *
+ * @param stage Stage to inspect; its state becomes the parsed t_group
+ * @return 1 if the stage is handled, 0 otherwise
+ */
+int	match_groupby(t_stage *stage)
+{
+	t_group	*group;
+
+	group = malloc(sizeof(t_group));
+	if (!group)
+		return (0);
+	if (parse_groupby(stage->argv, group) < 0)
+	{
+		free(group);
+		return (0);
+	}
+	stage->state = group;
+	return (1);
+}
+
+/**
+ * @brief Frees the tables of all workers
+ *
+ * @param parts Workers
+ * @param count Number of workers
+ */
+static void	group_free(t_group_part *parts, int count)
+{
+	int	k;
+
+	k = 0;
+	while (k < count)
+	{
+		free(parts[k].table.arena.data);
+		free(parts[k].table.entries);
+		free(parts[k].table.slots);
+		free(parts[k].acc);
+		k++;
+	}
+	free(parts);
+}
+
+/**
+ * @brief Runs @groupby: every worker groups its share of each batch into
+ * its own table, then the tables are merged and written once
+ *
+ * @param stage Stage whose state is the parsed t_group
+ * @param in_fd Input file descriptor
+ * @param out_fd Output file descriptor
+ * @return 0 on success, 1 on error
+ */
+int	run_groupby(t_stage *stage, int in_fd, int out_fd)
+{
+	t_group_part	*parts;
+	int				count;
+	int				status;
+	int				k;
+
+	count = ((t_group *)stage->state)->threads;
+	parts = ft_calloc(count, sizeof(t_group_part));
+	if (!parts)
+		return (builtin_error("@groupby", "out of memory"));
+	k = 0;
+	while (k < count)
+		parts[k++].group = stage->state;
+	status = group_input(parts, count, in_fd);
+	if (status == 0)
+		status = group_merge(parts, count);
+	if (status == 0)
+		status = group_emit(parts, out_fd);
+	group_free(parts, count);
+	if (status == -1)
+		return (builtin_error("@groupby", "read error"));
+	if (status == -3)
+		return (builtin_error("@groupby", "out of memory"));
+	if (status < 0)
+		return (builtin_error("@groupby", "write failure"));
+	return (0);
+}
@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_head_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:03:46 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:54:29 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Accepts head stages reading stdin with a plain -n or -c count
+ *
+ * @param stage Stage whose argv is examined
+ * @return 1 on match, 0 otherwise
+ */
+int	match_head(t_stage *stage)
+{
+	t_head	head;
+
+	return (parse_head_argv(stage->argv, &head) == 0);
+}
+
+/**
+ * @brief Tells how much of a block belongs to the head still due
+ *
+ * Newlines are counted with the wc kernel first, so blocks that end
+ * before the last wanted line are passed through whole; memchr() only
+ * walks the block holding it.
+ *
+ * @param head Count and mode
+ * @param buf Block just read
+ * @param len Size of the block
+ * @param left Lines or bytes still to print, updated
+ * @return Number of bytes of the block to write
+ */
+size_t	head_take(const t_head *head, const char *buf, size_t len,
+		long *left)
+{
+	t_wc		wc;
+	const char	*p;
+
+	if (head->bytes)
+	{
+		*left -= len;
+		return (len);
+	}
+	ft_bzero(&wc, sizeof(wc));
+	wc_scan(&wc, (const unsigned char *)buf, len, WC_LINES);
+	if (wc.lines < *left)
+	{
+		*left -= wc.lines;
+		return (len);
+	}
+	p = buf;
+	while (*left > 0)
+	{
+		p = (const char *)memchr(p, '\n', buf + len - p) + 1;
+		(*left)--;
+	}
+	return (p - buf);
+}
+
+/**
+ * @brief Copies the head of in_fd to out_fd and stops as soon as it is
+ * complete
+ *
+ * With -c only the bytes still due are read, so nothing past them is
+ * consumed from the input.
+ *
+ * @param in_fd Source file descriptor
+ * @param out_fd Destination file descriptor
+ * @param head Count and mode
+ * @param buf HEAD_BUFSIZE bytes buffer
+ * @return 0 on success, 1 on I/O error
+ */
+static int	head_copy(int in_fd, int out_fd, const t_head *head, char *buf)
+{
+	ssize_t	n;
+	size_t	want;
+	long	left;
+
+	left = head->count;
+	while (left > 0)
+	{
+		want = HEAD_BUFSIZE;
+		if (head->bytes && left < HEAD_BUFSIZE)
+			want = left;
+		n = io_read(in_fd, buf, want);
+		if (n == 0)
+			return (0);
+		if (n < 0 && errno != EINTR)
+			return (builtin_error("head", "read error"));
+		if (n < 0)
+			continue ;
+		want = head_take(head, buf, n, &left);
+		if (write_all(out_fd, buf, want) < 0)
+			return (builtin_error("head", "write error"));
+	}
+	return (0);
+}
+
+/**
+ * @brief Prints the first lines (or bytes) of stdin without exec'ing head
+ *
+ * The input is closed right after the last wanted byte is written and
+ * the stage exits; the parent then stops the upstream stages instead of
+ * leaving them to find out through SIGPIPE on their next write.
+ *
+ * @param stage Stage whose argv holds the count
+ * @param in_fd Source file descriptor
+ * @param out_fd Destination file descriptor
+ * @return 0 on success, 1 on error
+ */
+int	run_head(t_stage *stage, int in_fd, int out_fd)
+{
+	t_head	head;
+	char	*buf;
+	int		status;
+
+	parse_head_argv(stage->argv, &head);
+	status = 0;
+	if (head.count > 0)
+	{
+		buf = malloc(HEAD_BUFSIZE);
+		if (!buf)
+			return (builtin_error("head", "malloc"));
+		status = head_copy(in_fd, out_fd, &head, buf);
+		free(buf);
+	}
+	io_close(in_fd);
+	return (status);
+}
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_io_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:27:56 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:45:04 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Copies in_fd to out_fd through a user space buffer until EOF
+ *
+ * @param in_fd Source file descriptor
+ * @param out_fd Destination file descriptor
+ * @return 0 on success, -1 on read or write error (errno is set)
+ */
+int	copy_fd(int in_fd, int out_fd)
+{
+	char	buf[IO_CHUNK];
+	ssize_t	n;
+
+	while (1)
+	{
+		n = io_read(in_fd, buf, IO_CHUNK);
+		if (n == 0)
+			return (0);
+		if (n < 0 && errno != EINTR)
+			return (-1);
+		if (n > 0 && write_all(out_fd, buf, n) < 0)
+			return (-1);
+	}
+}
+
+/**
+ * @brief Tells whether a descriptor refers to a pipe or FIFO
+ *
+ * @param fd File descriptor to check
+ * @return 1 for a pipe or FIFO, 0 otherwise
+ */
+int	fd_is_fifo(int fd)
+{
+	struct stat	st;
+
+	if (fstat(fd, &st) < 0)
+		return (0);
+	return (S_ISFIFO(st.st_mode));
+}
+
+/**
+ * @brief Orders two lines byte by byte, like sort in the C locale
+ *
+ * @param a First line
+ * @param b Second line
+ * @return Negative, zero or positive as a sorts before, with or after b
+ */
+int	line_cmp(const t_line *a, const t_line *b)
+{
+	size_t	n;
+	int		c;
+
+	n = a->len;
+	if (b->len < n)
+		n = b->len;
+	c = memcmp(a->data, b->data, n);
+	if (c != 0 || a->len == b->len)
+		return (c);
+	if (a->len < b->len)
+		return (-1);
+	return (1);
+}
@@ -0,0 +1,173 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_join_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:33:21 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:33:21 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Splits a batch into one range per worker and starts every worker
+ * but the first on its own thread
+ *
+ * @param parts Workers
+ * @param count Number of workers used for this batch
+ * @param p Batch, ending with a newline
+ * @param len Length of the batch
+ */
+static void	join_split(t_join_part *parts, int count, const char *p,
+	size_t len)
+{
+	const char	*bounds[BATCH_MAX_THREADS + 1];
+	int			k;
+
+	batch_bounds(p, len, count, bounds);
+	k = 0;
+	while (k < count)
+	{
+		parts[k].p = bounds[k];
+		parts[k].end = bounds[k + 1];
+		parts[k].out.len = 0;
+		parts[k].started = (k > 0 && pthread_create(&parts[k].thread, NULL,
+					join_worker, &parts[k]) == 0);
+		k++;
+	}
+}
+
+/**
+ * @brief Filters a batch in parallel and writes the ranges in input order,
+ * the calling thread taking the first one
+ *
+ * Batches under JOIN_MIN_SPLIT bytes per worker use fewer workers.
+ *
+ * @param parts Workers
+ * @param count Number of workers
+ * @param p Batch, ending with a newline
+ * @param len Length of the batch
+ * @return 0 on success, -2 on write failure, -3 on allocation failure
+ */
+static int	join_batch(t_join_part *parts, int count, const char *p,
+	size_t len)
+{
+	int	status;
+	int	k;
+
+	if ((size_t)count > len / JOIN_MIN_SPLIT + 1)
+		count = len / JOIN_MIN_SPLIT + 1;
+	join_split(parts, count, p, len);
+	status = 0;
+	k = 0;
+	while (k < count)
+	{
+		if (parts[k].started)
+			pthread_join(parts[k].thread, NULL);
+		else
+			join_worker(&parts[k]);
+		if (status == 0 && parts[k].out.failed)
+			status = -3;
+		if (status == 0 && write_all(parts[k].out_fd, parts[k].out.data,
+				parts[k].out.len) < 0)
+			status = -2;
+		k++;
+	}
+	return (status);
+}
+
+/**
+ * @brief Reads the input in batches of whole lines and filters each one
+ *
+ * A last line without a newline gets one.
+ *
+ * @param parts Workers
+ * @param count Number of workers
+ * @param fd Input file descriptor
+ * @return 0 on success, -1 on read failure, -2 on write failure, -3 on
+ * allocation failure
+ */
+static int	join_input(t_join_part *parts, int count, int fd)
+{
+	t_reader	r;
+	const char	*nl;
+	size_t		len;
+	int			status;
+
+	ft_memset(&r, 0, sizeof(t_reader));
+	r.fd = fd;
+	status = reader_batch(&r, JOIN_BATCH);
+	while (status == 0 && !(r.eof && r.start == r.end))
+	{
+		nl = memrchr(r.buf + r.start, '\n', r.end - r.start);
+		if (!nl && (!r.eof || r.end == r.cap))
+			status = reader_batch(&r, JOIN_BATCH);
+		else if (!nl)
+			r.buf[r.end++] = '\n';
+		else
+		{
+			len = nl + 1 - (r.buf + r.start);
+			status = join_batch(parts, count, r.buf + r.start, len);
+			r.start += len;
+		}
+	}
+	free(r.buf);
+	return (status);
+}
+
+/**
+ * @brief Reports a failed run
+ *
+ * @param join Join stage
+ * @param status -1 on read failure, -2 on write failure, -3 on
+ * allocation failure
+ * @return 1
+ */
+static int	join_error(const t_join *join, int status)
+{
+	if (status == -1)
+		return (builtin_error(join->name, "read error"));
+	if (status == -3)
+		return (builtin_error(join->name, "out of memory"));
+	return (builtin_error(join->name, "write failure"));
+}
+
+/**
+ * @brief Runs @join or @semijoin: loads the key file into a hash set, then
+ * filters the input in parallel over batches, keeping its order
+ *
+ * @param stage Stage whose state is the parsed t_join
+ * @param in_fd Input file descriptor
+ * @param out_fd Output file descriptor
+ * @return 0 on success, 1 on error
+ */
+int	run_join(t_stage *stage, int in_fd, int out_fd)
+{
+	t_join		*join;
+	t_join_part	*parts;
+	int			status;
+	int			k;
+
+	join = stage->state;
+	status = join_load(join);
+	if (status == -1)
+		return (builtin_error(join->name, join->file));
+	parts = ft_calloc(join->threads, sizeof(t_join_part));
+	if (status < 0 || !parts)
+		return (join_error(join, -3));
+	k = -1;
+	while (++k < join->threads)
+	{
+		parts[k].join = join;
+		parts[k].out_fd = out_fd;
+	}
+	status = join_input(parts, join->threads, in_fd);
+	while (--k >= 0)
+		free(parts[k].out.data);
+	free(parts);
+	if (status < 0)
+		return (join_error(join, status));
+	return (0);
+}
@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_merge_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:18:35 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:18:35 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+#ifdef POSIX_FADV_WILLNEED
+
+/**
+ * @brief Asks the kernel to read the whole input ahead, in the background
+ *
+ * @param fd Input file descriptor
+ */
+static void	prefetch(int fd)
+{
+	posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+	posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+}
+
+#else
+
+/**
+ * @brief posix_fadvise() is missing; inputs rely on default readahead
+ *
+ * @param fd Unused
+ */
+static void	prefetch(int fd)
+{
+	(void)fd;
+}
+
+#endif
+
+/**
+ * @brief Opens one input and primes its source with the first line
+ *
+ * Each input is read through its own MERGE_BLOCK reader, so the k-way
+ * merge issues few large reads per input. "-" is the stage input.
+ *
+ * @param src Zeroed merge source
+ * @param reader Reader of the source
+ * @param file Path of the input
+ * @param in_fd Stage input descriptor
+ * @return 0 on success, -1 on error (reported)
+ */
+static int	open_source(t_sort_src *src, t_reader *reader, const char *file,
+		int in_fd)
+{
+	ft_memset(reader, 0, sizeof(t_reader));
+	reader->fd = in_fd;
+	if (ft_strncmp(file, "-", 2) != 0)
+		reader->fd = open(file, O_RDONLY);
+	if (reader->fd < 0)
+		return (-builtin_error("@merge", file));
+	prefetch(reader->fd);
+	reader->cap = MERGE_BLOCK;
+	reader->buf = malloc(reader->cap);
+	if (!reader->buf)
+		return (-builtin_error("@merge", "memory exhausted"));
+	src->reader = reader;
+	return (-(src_next(src) < 0));
+}
+
+/**
+ * @brief Closes the inputs opened by open_source() and frees the readers
+ *
+ * @param readers Readers of the sources
+ * @param count Number of readers open_source() was called on
+ * @param in_fd Stage input descriptor, left open
+ */
+static void	close_sources(t_reader *readers, int count, int in_fd)
+{
+	int	k;
+
+	k = 0;
+	while (k < count)
+	{
+		if (readers[k].fd >= 0 && readers[k].fd != in_fd)
+			close(readers[k].fd);
+		reader_free(&readers[k]);
+		k++;
+	}
+}
+
+/**
+ * @brief Runs @merge: a loser-tree k-way merge of pre-sorted inputs
+ *
+ * "-" (the default) stands for the stage input. The merge is the
+ * one of the sort builtin, with the same ordering options; equal lines
+ * come out in input order, as with "sort -m".
+ *
+ * @param stage Stage whose state is the parsed t_merge
+ * @param in_fd Input file descriptor
+ * @param out_fd Output file descriptor
+ * @return 0 on success, SORT_FAILURE on error
+ */
+int	run_merge(t_stage *stage, int in_fd, int out_fd)
+{
+	t_merge		*merge;
+	t_sort_src	*srcs;
+	t_reader	*readers;
+	int			k;
+	int			ret;
+
+	merge = stage->state;
+	srcs = ft_calloc(merge->nfiles, sizeof(t_sort_src));
+	readers = ft_calloc(merge->nfiles, sizeof(t_reader));
+	ret = -(!srcs || !readers);
+	k = 0;
+	while (ret == 0 && k < merge->nfiles)
+	{
+		ret = open_source(&srcs[k], &readers[k], merge->files[k], in_fd);
+		k++;
+	}
+	if (ret == 0)
+		ret = sort_merge(&merge->sort, srcs, merge->nfiles, out_fd);
+	if (readers)
+		close_sources(readers, k, in_fd);
+	free(srcs);
+	free(readers);
+	if (ret != 0)
+		return (SORT_FAILURE);
+	return (0);
+}
@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_sed_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:01:35 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:01:35 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Frees the builtin sed state attached to a stage
+ *
+ * @param state t_sed built by match_sed()
+ */
+void	free_sed(void *state)
+{
+	t_sed	*sed;
+
+	sed = state;
+	free(sed->addr.text.data);
+	free(sed->addr.patterns);
+	free(sed->pat.text.data);
+	free(sed->pat.patterns);
+	free(sed->repl.data);
+	free(sed);
+}
+
+/**
+ * @brief Accepts sed stages running one literal s, d or p command on
+ * stdin
+ *
+ * The address and the pattern are compiled here, once, as single
+ * fixed-string grep matchers, and the replacement is expanded. The
+ * child inherits all three. As for grep, a UTF-8 locale only takes
+ * ASCII literals; other multibyte locales are left to sed.
+ *
+ * @param stage Stage whose argv is examined
+ * @return 1 on match, 0 otherwise
+ */
+int	match_sed(t_stage *stage)
+{
+	t_sed	*sed;
+	int		kind;
+
+	sed = ft_calloc(1, sizeof(t_sed));
+	if (!sed)
+		return (0);
+	kind = ctype_locale();
+	sed->addr.flags = GREP_FIXED;
+	sed->addr.utf8 = (kind == CTYPE_UTF8);
+	sed->pat.flags = GREP_FIXED;
+	sed->pat.utf8 = (kind == CTYPE_UTF8);
+	if (kind == CTYPE_OTHER || parse_sed_argv(stage->argv, sed) < 0
+		|| (sed->cmd == 's' && grep_compile(&sed->pat) < 0)
+		|| ((sed->flags & SED_ADDRESS) && grep_compile(&sed->addr) < 0))
+	{
+		free_sed(sed);
+		return (0);
+	}
+	stage->state = sed;
+	return (1);
+}
+
+/**
+ * @brief Feeds the input to the editor in blocks of whole lines
+ *
+ * @param run Sed in progress
+ * @param fd Source file descriptor
+ * @return 0 on success, -1 on read error, -2 on write error
+ */
+static int	sed_input(t_sed_run *run, int fd)
+{
+	t_reader	reader;
+	char		*nl;
+	size_t		len;
+	int			status;
+
+	if (reader_init(&reader, fd) < 0)
+		return (-1);
+	status = 0;
+	while (status == 0 && !(reader.eof && reader.start == reader.end))
+	{
+		len = reader.end - reader.start;
+		nl = memrchr(reader.buf + reader.start, '\n', len);
+		if (nl)
+			len = nl + 1 - (reader.buf + reader.start);
+		if (!nl && !reader.eof)
+			status = -(reader_fill(&reader) < 0);
+		else
+		{
+			status = -2 * (sed_block(run, reader.buf + reader.start, len) < 0);
+			reader.start += len;
+		}
+	}
+	reader_free(&reader);
+	return (status);
+}
+
+/**
+ * @brief Edits stdin like sed without exec'ing sed
+ *
+ * @param stage Stage holding the compiled command
+ * @param in_fd Source file descriptor
+ * @param out_fd Destination file descriptor
+ * @return 0 on success, SED_FAILURE (sed's status for I/O errors) on
+ * error
+ */
+int	run_sed(t_stage *stage, int in_fd, int out_fd)
+{
+	t_sed_run	run;
+	int			status;
+
+	ft_memset(&run, 0, sizeof(t_sed_run));
+	run.sed = stage->state;
+	run.key = &run.sed->pat;
+	if (run.sed->flags & SED_ADDRESS)
+		run.key = &run.sed->addr;
+	run.out.fd = out_fd;
+	status = sed_input(&run, in_fd);
+	if (status == -1)
+		return (builtin_error("sed", "read error") - 1 + SED_FAILURE);
+	if (status < 0)
+		return (builtin_error("sed", "couldn't write") - 1 + SED_FAILURE);
+	return (0);
+}
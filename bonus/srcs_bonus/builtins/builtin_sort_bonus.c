@@ -0,0 +1,166 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_sort_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:40:35 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 13:40:35 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Frees the options built by match_sort()
+ *
+ * @param state t_sort to free
+ */
+void	free_sort(void *state)
+{
+	t_sort	*sort;
+
+	sort = state;
+	free(sort->keys);
+	free(sort->tmpdir);
+	free(sort);
+}
+
+/**
+ * @brief Recognizes a sort stage reading stdin and writing stdout
+ *
+ * Supported: -b, -n, -r, -s, -u, -k, -t, and the tuning options -S, -T
+ * and --parallel, in clusters or long form. Files, -o, -m, -c and any
+ * other ordering are left to the real sort.
+ *
+ * @param argv Stage argument vector
+ * @param sort Receives the options (zeroed by the caller)
+ * @return 0 on success, -1 if the stage is not such a sort
+ */
+int	parse_sort_argv(char **argv, t_sort *sort)
+{
+	int	used;
+	int	i;
+
+	if (!argv || !argv[0] || ft_strncmp(argv[0], "sort", 5) != 0)
+		return (-1);
+	sort->tab = -1;
+	sort->global.eword = SK_NONE;
+	i = 1;
+	while (argv[i] && ft_strncmp(argv[i], "--", 3) != 0)
+	{
+		if (argv[i][0] != '-' || !argv[i][1])
+			return (-1);
+		used = parse_sort_option(sort, argv, i);
+		if (used <= 0)
+			return (-1);
+		i += used;
+	}
+	if (argv[i] && argv[i + 1])
+		return (-1);
+	return (sort_inherit(sort));
+}
+
+/**
+ * @brief Accepts sort stages whose ordering can be reproduced bytewise
+ *
+ * The stage must run in the C (or C.UTF-8) collation, where sort compares
+ * bytes, and with a decimal point numbers parse the same way.
+ *
+ * @param stage Stage whose argv is examined
+ * @return 1 on match, 0 otherwise
+ */
+int	match_sort(t_stage *stage)
+{
+	t_sort	*sort;
+
+	if (!locale_is_c("LC_COLLATE") || !locale_is_c("LC_NUMERIC")
+		|| ctype_locale() == CTYPE_OTHER)
+		return (0);
+	sort = ft_calloc(1, sizeof(t_sort));
+	if (!sort)
+		return (0);
+	if (parse_sort_argv(stage->argv, sort) < 0)
+	{
+		free_sort(sort);
+		return (0);
+	}
+	stage->state = sort;
+	return (1);
+}
+
+/**
+ * @brief Sizes the run from the options and the machine
+ *
+ * Without -S the batch may use a quarter of physical memory; without
+ * --parallel one thread per online CPU, up to SORT_MAX_THREADS.
+ *
+ * @param run Zeroed run to set up
+ * @param sort Sort options
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	sort_setup(t_sort_run *run, const t_sort *sort)
+{
+	long	mem;
+
+	run->threads = sort->threads;
+	if (!run->threads)
+		run->threads = sysconf(_SC_NPROCESSORS_ONLN);
+	if (!sort->threads && run->threads > SORT_MAX_THREADS)
+		run->threads = SORT_MAX_THREADS;
+	if (run->threads < 1)
+		run->threads = 1;
+	run->budget = sort->budget;
+	mem = sysconf(_SC_PHYS_PAGES);
+	if (!run->budget && mem > 0)
+		run->budget = (size_t)mem * sysconf(_SC_PAGESIZE) / 4;
+	if (run->budget < SORT_MIN_BUDGET)
+		run->budget = SORT_MIN_BUDGET;
+	run->chunk = run->budget / 8;
+	if (run->chunk < IO_CHUNK)
+		run->chunk = IO_CHUNK;
+	if (run->chunk > SORT_CHUNK)
+		run->chunk = SORT_CHUNK;
+	run->runs = malloc(sizeof(t_reader) * SORT_MAX_RUNS);
+	if (!run->runs)
+		return (-builtin_error("sort", "memory exhausted"));
+	return (0);
+}
+
+/**
+ * @brief Sorts the input like sort(1), spilling to disk when it is large
+ *
+ * Input is read in large blocks until the memory budget is reached; the
+ * batch is then sorted on all threads and written out as a run. At end
+ * of input the last batch and the runs are merged into out_fd.
+ *
+ * @param stage Stage whose state holds the options
+ * @param in_fd Source file descriptor
+ * @param out_fd Destination file descriptor
+ * @return 0 on success, SORT_FAILURE on error, as sort exits
+ */
+int	run_sort(t_stage *stage, int in_fd, int out_fd)
+{
+	t_sort_run	run;
+	int			ret;
+
+	ft_memset(&run, 0, sizeof(t_sort_run));
+	run.sort = stage->state;
+	run.fd = in_fd;
+	if (sort_setup(&run, run.sort) < 0)
+		return (SORT_FAILURE);
+	ret = sort_read(&run);
+	while (ret == 1)
+	{
+		ret = sort_spill(&run);
+		if (ret == 0)
+			ret = sort_read(&run);
+	}
+	if (ret == 0)
+		ret = sort_finish(&run, out_fd);
+	sort_release(&run);
+	if (ret < 0)
+		return (SORT_FAILURE);
+	return (0);
+}
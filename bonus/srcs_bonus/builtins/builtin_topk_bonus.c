@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_topk_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:34:44 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:27:30 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Heap-sorts the kept lines into output order
+ *
+ * @param topk Heap, left as an array sorted like sort(1) would
+ */
+static void	topk_sort(t_topk *topk)
+{
+	t_topk_rec	tmp;
+	size_t	n;
+
+	n = topk->len;
+	while (n > 1)
+	{
+		n--;
+		tmp = topk->recs[0];
+		topk->recs[0] = topk->recs[n];
+		topk->recs[n] = tmp;
+		topk_sift_down(topk, 0, n);
+	}
+}
+
+/**
+ * @brief Writes the kept lines, one per line, and frees them
+ *
+ * @param topk Heap
+ * @param out_fd Destination file descriptor
+ * @return 0 on success, 1 on write error
+ */
+static int	topk_emit(t_topk *topk, int out_fd)
+{
+	t_out	out;
+	t_line	*line;
+	size_t	i;
+	int		ret;
+
+	topk_sort(topk);
+	out_init(&out, out_fd);
+	ret = 0;
+	i = 0;
+	while (i < topk->len)
+	{
+		line = &topk->recs[i].rec.line;
+		line->data[line->len] = '\n';
+		if (ret == 0 && out_write(&out, line->data, line->len + 1) < 0)
+			ret = builtin_error("@topk", "write error");
+		free(line->data);
+		i++;
+	}
+	if (ret == 0 && out_flush(&out) < 0)
+		ret = builtin_error("@topk", "write error");
+	free(topk->recs);
+	topk->recs = NULL;
+	return (ret);
+}
+
+/**
+ * @brief Outputs the first K lines of the sorted input (sort | head -n K)
+ *
+ * Only K lines are ever kept in memory, whatever the input size. Ties
+ * come out as sort(1) would order them, input order included under -s.
+ *
+ * @param stage Stage whose state is the t_topk built by match_topk()
+ * @param in_fd Source file descriptor
+ * @param out_fd Destination file descriptor
+ * @return 0 on success, 1 on error
+ */
+int	run_topk(t_stage *stage, int in_fd, int out_fd)
+{
+	t_topk		*topk;
+	t_reader	reader;
+	char		*line;
+	size_t		len;
+	int			ret;
+
+	topk = stage->state;
+	if (reader_init(&reader, in_fd) < 0)
+		return (builtin_error("@topk", "setup failed"));
+	ret = next_line(&reader, &line, &len);
+	while (ret > 0 && topk_offer(topk, line, len) == 0)
+		ret = next_line(&reader, &line, &len);
+	reader_free(&reader);
+	if (ret != 0)
+	{
+		topk->len = 0;
+		topk_emit(topk, out_fd);
+		return (builtin_error("@topk", "input"));
+	}
+	return (topk_emit(topk, out_fd));
+}
@@ -0,0 +1,170 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_tr_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:58:52 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:54:29 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Accepts tr stages whose sets compile to byte tables
+ *
+ * Everything tr supports is taken (ranges, escapes, classes, [=c=],
+ * [c*n], -c, -d, -s, -t) except in single byte locales other than C,
+ * where classes could hold bytes past 0x7F. Sets tr would reject are
+ * left to tr and its diagnostics.
+ *
+ * @param stage Stage whose argv is examined
+ * @return 1 on match, 0 otherwise
+ */
+int	match_tr(t_stage *stage)
+{
+	t_tr	*tr;
+	char	*sets[2];
+
+	if (ctype_locale() == CTYPE_OTHER)
+		return (0);
+	tr = ft_calloc(1, sizeof(t_tr));
+	if (!tr)
+		return (0);
+	if (parse_tr(stage->argv, &tr->flags, sets) < 0
+		|| tr_compile(tr, sets) < 0)
+	{
+		free(tr);
+		return (0);
+	}
+	stage->state = tr;
+	return (1);
+}
+
+/**
+ * @brief Translates a block in place with the table, byte by byte
+ *
+ * @param tr Compiled tr
+ * @param p Block
+ * @param len Size of the block
+ */
+void	tr_translate_scalar(const t_tr *tr, unsigned char *p, size_t len)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < len)
+	{
+		p[i] = tr->map[p[i]];
+		i++;
+	}
+}
+
+/**
+ * @brief Deletes, translates and squeezes a block in place
+ *
+ * Branch free: every byte is stored and the output position only
+ * advances for the bytes kept.
+ *
+ * @param tr Compiled tr
+ * @param p Block
+ * @param len Size of the block
+ * @param last Last byte written so far (-1 before any), updated
+ * @return Size of the output left at the start of the block
+ */
+size_t	tr_filter_scalar(const t_tr *tr, unsigned char *p, size_t len,
+		int *last)
+{
+	size_t	i;
+	size_t	j;
+	int		c;
+	int		keep;
+	int		prev;
+
+	i = 0;
+	j = 0;
+	prev = *last;
+	while (i < len)
+	{
+		c = tr->map[p[i]];
+		keep = !tr->del[p[i++]] & !(tr->squeeze[c] & (c == prev));
+		p[j] = c;
+		j += keep;
+		prev ^= (prev ^ c) & -keep;
+	}
+	*last = prev;
+	return (j);
+}
+
+/**
+ * @brief Processes one block with the fastest kernel that applies
+ *
+ * Plain translation uses the AVX2 shuffle kernel when available and skips
+ * the block entirely for an identity table; -d alone and -s alone
+ * without translation use the AVX2 membership kernel.
+ *
+ * @param tr Compiled tr
+ * @param p Block
+ * @param len Size of the block
+ * @param last Squeeze state, see tr_filter_scalar()
+ * @return Size of the output left at the start of the block
+ */
+size_t	tr_block(const t_tr *tr, unsigned char *p, size_t len,
+		int *last)
+{
+	int	level;
+	int	mode;
+
+	level = simd_level();
+	mode = tr->flags & (TR_DELETE | TR_SQUEEZE);
+	if (level == 2 && (mode == TR_DELETE || (mode == TR_SQUEEZE
+				&& !tr->dirty)))
+		return (tr_filter_avx2(tr, p, len, last));
+	if (mode)
+		return (tr_filter_scalar(tr, p, len, last));
+	if (tr->dirty && level == 2)
+		tr_translate_avx2(tr, p, len);
+	else if (tr->dirty)
+		tr_translate_scalar(tr, p, len);
+	return (len);
+}
+
+/**
+ * @brief Runs tr over stdin without exec'ing tr
+ *
+ * Each block read is processed in place and written back with a single
+ * write.
+ *
+ * @param stage Stage holding the compiled tables
+ * @param in_fd Source file descriptor
+ * @param out_fd Destination file descriptor
+ * @return 0 on success, 1 on error
+ */
+int	run_tr(t_stage *stage, int in_fd, int out_fd)
+{
+	unsigned char	*buf;
+	ssize_t			n;
+	int				last;
+	int				status;
+
+	buf = malloc(TR_BUFSIZE);
+	if (!buf)
+		return (builtin_error("tr", "malloc"));
+	last = -1;
+	status = 0;
+	n = io_read(in_fd, buf, TR_BUFSIZE);
+	while (n != 0 && status == 0)
+	{
+		if (n < 0 && errno != EINTR)
+			status = builtin_error("tr", "read error");
+		else if (n > 0 && write_all(out_fd, (char *)buf,
+				tr_block(stage->state, buf, n, &last)) < 0)
+			status = builtin_error("tr", "write error");
+		if (status == 0)
+			n = io_read(in_fd, buf, TR_BUFSIZE);
+	}
+	free(buf);
+	return (status);
+}
@@ -0,0 +1,165 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_wc_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:39:44 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:54:29 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Appends one right aligned count to the output line
+ *
+ * @param line Output line being built
+ * @param len Current length of the line
+ * @param n Count to append
+ * @param width Minimum field width
+ * @return New length of the line
+ */
+static size_t	put_count(char *line, size_t len, long n, int width)
+{
+	char	digits[24];
+	int		d;
+
+	if (len > 0)
+		line[len++] = ' ';
+	d = 0;
+	digits[d++] = '0' + n % 10;
+	n /= 10;
+	while (n > 0)
+	{
+		digits[d++] = '0' + n % 10;
+		n /= 10;
+	}
+	while (width-- > d)
+		line[len++] = ' ';
+	while (d > 0)
+		line[len++] = digits[--d];
+	return (len);
+}
+
+/**
+ * @brief Computes the field width coreutils wc uses for stdin
+ *
+ * A single count is not padded. Otherwise the width is the number of
+ * digits of the file size for a regular file, and 7 for anything else.
+ *
+ * @param flags WC_* bits to print
+ * @param st fstat() of stdin, st_mode 0 if it failed
+ * @return Field width
+ */
+int	count_width(int flags, struct stat *st)
+{
+	long	size;
+	int		width;
+
+	if (flags == WC_LINES || flags == WC_WORDS || flags == WC_BYTES)
+		return (1);
+	if (!S_ISREG(st->st_mode))
+		return (WC_NUMBER_WIDTH);
+	width = 1;
+	size = st->st_size;
+	while (size >= 10)
+	{
+		width++;
+		size /= 10;
+	}
+	return (width);
+}
+
+/**
+ * @brief Prints the requested counts in wc order: lines, words, bytes
+ *
+ * @param wc Counts
+ * @param flags WC_* bits to print
+ * @param width Field width
+ * @param out_fd Destination file descriptor
+ * @return 0 on success, 1 on write error
+ */
+int	print_counts(t_wc *wc, int flags, int width, int out_fd)
+{
+	char	line[96];
+	size_t	len;
+
+	len = 0;
+	if (flags & WC_LINES)
+		len = put_count(line, len, wc->lines, width);
+	if (flags & WC_WORDS)
+		len = put_count(line, len, wc->words, width);
+	if (flags & WC_BYTES)
+		len = put_count(line, len, wc->bytes, width);
+	line[len++] = '\n';
+	if (write_all(out_fd, line, len) < 0)
+		return (builtin_error("wc", "write error"));
+	return (0);
+}
+
+/**
+ * @brief Reads the whole input, counting it block by block
+ *
+ * @param wc Counts to update
+ * @param fd Source file descriptor
+ * @param flags WC_* bits to count
+ * @return 0 on success, -1 on read or allocation error
+ */
+static int	scan_input(t_wc *wc, int fd, int flags)
+{
+	unsigned char	*buf;
+	ssize_t			n;
+
+	buf = malloc(WC_BUFSIZE);
+	if (!buf)
+		return (-1);
+	n = io_read(fd, buf, WC_BUFSIZE);
+	while (n != 0)
+	{
+		if (n < 0 && errno != EINTR)
+			break ;
+		if (n > 0)
+		{
+			wc->bytes += n;
+			wc_scan(wc, buf, n, flags);
+		}
+		n = io_read(fd, buf, WC_BUFSIZE);
+	}
+	free(buf);
+	return (-(n < 0));
+}
+
+/**
+ * @brief Counts stdin like "wc [-lwc]" without exec'ing wc
+ *
+ * A byte count alone on a regular file comes from fstat() and the file
+ * offset, without reading the data.
+ *
+ * @param stage Stage holding the wc argv
+ * @param in_fd Source file descriptor
+ * @param out_fd Destination file descriptor
+ * @return 0 on success, 1 on error
+ */
+int	run_wc(t_stage *stage, int in_fd, int out_fd)
+{
+	t_wc		wc;
+	struct stat	st;
+	off_t		pos;
+	int			flags;
+
+	flags = parse_wc(stage->argv);
+	ft_memset(&wc, 0, sizeof(t_wc));
+	ft_memset(&st, 0, sizeof(struct stat));
+	if (fstat(in_fd, &st) < 0)
+		st.st_mode = 0;
+	pos = -1;
+	if (flags == WC_BYTES && S_ISREG(st.st_mode) && st.st_size > 0)
+		pos = lseek(in_fd, 0, SEEK_CUR);
+	if (pos >= 0 && pos < st.st_size)
+		wc.bytes = st.st_size - pos;
+	else if (pos < 0 && scan_input(&wc, in_fd, flags) < 0)
+		return (builtin_error("wc", "read error"));
+	return (print_counts(&wc, flags, count_width(flags, &st), out_fd));
+}
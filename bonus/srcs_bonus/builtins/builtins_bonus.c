@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtins_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:27:56 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:18:35 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Returns the builtin table, in the order the names are tried
+ *
+ * @return NULL terminated array of builtins
+ */
+static const t_builtin	*builtin_table(void)
+{
+	static const t_builtin	builtins[] = {
+	{"cat", match_cat, run_cat, NULL, 0},
+	{"@topk", match_topk, run_topk, free_topk, 0},
+	{"wc", match_wc, run_wc, NULL, 0},
+	{"grep", match_grep, run_grep, free_grep, 0},
+	{"tr", match_tr, run_tr, free, 0},
+	{"head", match_head, run_head, NULL, 1},
+	{"sort", match_sort, run_sort, free_sort, 0},
+	{"@distinct", match_distinct, run_distinct, NULL, 0},
+	{"@groupby", match_groupby, run_groupby, free, 0},
+	{"@join", match_join, run_join, free_join, 0},
+	{"@semijoin", match_join, run_join, free_join, 0},
+	{"@merge", match_merge, run_merge, free_merge, 0},
+	{"cut", match_cut, run_cut, free_cut, 0},
+	{"sed", match_sed, run_sed, free_sed, 0},
+	{"awk", match_awk, run_awk, free, 0},
+	{NULL, NULL, NULL, NULL, 0}
+	};
+
+	return (builtins);
+}
+
+/**
+ * @brief Binds a stage to an in-process builtin when its argv is supported
+ *
+ * Every builtin decides from the tokenized argv alone whether it can
+ * reproduce the external command exactly; anything it does not recognise
+ * is left to the real binary.
+ *
+ * @param stage Stage whose argv is examined
+ * @return 1 if a builtin was bound to the stage, 0 otherwise
+ */
+int	match_builtin(t_stage *stage)
+{
+	const t_builtin	*builtins;
+	int				i;
+
+	if (!stage->argv || !stage->argv[0])
+		return (0);
+	builtins = builtin_table();
+	i = 0;
+	while (builtins[i].name)
+	{
+		if (ft_strncmp(builtins[i].name, stage->argv[0],
+				ft_strlen(builtins[i].name) + 1) == 0
+			&& builtins[i].match(stage))
+		{
+			stage->builtin = &builtins[i];
+			return (1);
+		}
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Releases the state a builtin attached to its stage at match time
+ *
+ * @param stage Stage to clean up
+ */
+void	free_builtin_state(t_stage *stage)
+{
+	if (stage->builtin && stage->builtin->free_state && stage->state)
+		stage->builtin->free_state(stage->state);
+	stage->state = NULL;
+}
+
+/**
+ * @brief Reports a builtin failure the way the external tool would
+ *
+ * @param name Name of the builtin (e.g. "cat")
+ * @param what What failed, followed by the current errno description
+ * @return Always 1, the exit status for the failing stage
+ */
+int	builtin_error(const char *name, const char *what)
+{
+	ft_putstr_fd("pipex_bonus: ", STDERR_FILENO);
+	ft_putstr_fd((char *)name, STDERR_FILENO);
+	ft_putstr_fd(": ", STDERR_FILENO);
+	ft_putstr_fd((char *)what, STDERR_FILENO);
+	ft_putstr_fd(": ", STDERR_FILENO);
+	ft_putendl_fd(strerror(errno), STDERR_FILENO);
+	return (1);
+}
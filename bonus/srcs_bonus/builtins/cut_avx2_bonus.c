@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cut_avx2_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:54:45 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 13:54:45 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../../inc_bonus/pipex_bonus.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+
+# include <immintrin.h>
+
+/**
+ * @brief Marks the delimiters and newlines of a 64 byte block (AVX2)
+ *
+ * Two 32 byte compares per byte value are folded into one bit per byte,
+ * bit k standing for p[k].
+ *
+ * @param p Start of the block, 64 readable bytes
+ * @param delim Field delimiter
+ * @return Bitmask of the bytes equal to delim or '\n'
+ */
+__attribute__((target("avx2")))
+uint64_t	cut_mask_avx2(const unsigned char *p, int delim)
+{
+	__m256i		d;
+	__m256i		nl;
+	__m256i		lo;
+	__m256i		hi;
+
+	d = _mm256_set1_epi8(delim);
+	nl = _mm256_set1_epi8('\n');
+	lo = _mm256_loadu_si256((const __m256i *)p);
+	hi = _mm256_loadu_si256((const __m256i *)(p + 32));
+	lo = _mm256_or_si256(_mm256_cmpeq_epi8(lo, d), _mm256_cmpeq_epi8(lo, nl));
+	hi = _mm256_or_si256(_mm256_cmpeq_epi8(hi, d), _mm256_cmpeq_epi8(hi, nl));
+	return ((uint64_t)(uint32_t)_mm256_movemask_epi8(lo)
+		| (uint64_t)(uint32_t)_mm256_movemask_epi8(hi) << 32);
+}
+
+#else
+
+/**
+ * @brief AVX2 is x86 only; builds the mask with the scalar loop
+ *
+ * @param p Start of the block, 64 readable bytes
+ * @param delim Field delimiter
+ * @return Bitmask of the bytes equal to delim or '\n'
+ */
+uint64_t	cut_mask_avx2(const unsigned char *p, int delim)
+{
+	return (cut_mask_scalar(p, 64, delim));
+}
+
+#endif
@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cut_fields_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:54:45 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 13:54:45 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Prints the current field if it is selected
+ *
+ * The range cursor only moves forward, fields being numbered in
+ * increasing order along the line.
+ *
+ * @param run Cut in progress
+ * @param end End of the field
+ * @return 0 on success, -1 on write error
+ */
+static int	cut_emit(t_cut_run *run, const char *end)
+{
+	const t_cut	*cut;
+
+	cut = run->cut;
+	while (run->range < cut->n && cut->ranges[run->range].hi < run->index)
+		run->range++;
+	if (run->range == cut->n || cut->ranges[run->range].lo > run->index)
+		return (0);
+	if (run->printed
+		&& out_write(&run->out, cut->outdelim, cut->outlen) < 0)
+		return (-1);
+	run->printed = 1;
+	return (out_write(&run->out, run->field, end - run->field));
+}
+
+/**
+ * @brief Ends a field at a delimiter
+ *
+ * Once the range cursor is past the last selected field, the rest of
+ * the line's delimiters are ignored.
+ *
+ * @param run Cut in progress
+ * @param q Delimiter
+ * @return 0 on success, -1 on write error
+ */
+static int	cut_delim(t_cut_run *run, const char *q)
+{
+	run->split = 1;
+	if (run->range == run->cut->n)
+		return (0);
+	if (cut_emit(run, q) < 0)
+		return (-1);
+	run->index++;
+	run->field = q + 1;
+	return (0);
+}
+
+/**
+ * @brief Ends a line: prints its last field, or the whole line when it
+ * has no delimiter (nothing with -s), then a newline
+ *
+ * @param run Cut in progress
+ * @param q Newline, or end of input for a last line without one
+ * @return 0 on success, -1 on write error
+ */
+static int	cut_eol(t_cut_run *run, const char *q)
+{
+	int	status;
+
+	status = 0;
+	if (!run->split && !(run->cut->flags & CUT_SUPPRESS))
+		status = out_write(&run->out, run->start, q - run->start);
+	else if (run->split && run->range < run->cut->n)
+		status = cut_emit(run, q);
+	if (status == 0 && (run->split || !(run->cut->flags & CUT_SUPPRESS)))
+		status = out_write(&run->out, "\n", 1);
+	run->start = q + 1;
+	run->field = q + 1;
+	run->index = 1;
+	run->range = 0;
+	run->printed = 0;
+	run->split = 0;
+	return (status);
+}
+
+/**
+ * @brief Visits the delimiters and newlines marked in a block's mask
+ *
+ * @param run Cut in progress
+ * @param base Start of the block
+ * @param mask One bit per marked byte
+ * @return 0 on success, -1 on write error
+ */
+static int	cut_marks(t_cut_run *run, const char *base, uint64_t mask)
+{
+	const char	*q;
+	int			status;
+
+	while (mask)
+	{
+		q = base + __builtin_ctzll(mask);
+		mask &= mask - 1;
+		if (*q == '\n')
+			status = cut_eol(run, q);
+		else
+			status = cut_delim(run, q);
+		if (status < 0)
+			return (-1);
+	}
+	return (0);
+}
+
+/**
+ * @brief Cuts -f selections out of a block of whole lines
+ *
+ * Delimiters and newlines are located 64 bytes at a time as a bitmask
+ * (AVX2 when the CPU has it) and fields are written as slices of the
+ * read buffer, so a line costs no allocation and no copy.
+ *
+ * @param run Cut in progress, between two lines
+ * @param p Block, ending with a newline unless it is the end of input
+ * @param len Size of the block
+ * @return 0 on success, -1 on write error
+ */
+int	cut_fields(t_cut_run *run, const char *p, size_t len)
+{
+	size_t	i;
+
+	run->start = p;
+	run->field = p;
+	i = 0;
+	while (i < len)
+	{
+		if (cut_marks(run, p + i, cut_mask((const unsigned char *)p + i,
+					len - i, run->cut->delim)) < 0)
+			return (-1);
+		i += 64;
+	}
+	if (len > 0 && p[len - 1] != '\n')
+		return (cut_eol(run, p + len));
+	return (0);
+}
@@ -0,0 +1,162 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cut_list_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:54:45 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 13:54:45 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Reads one field or position number of a cut list
+ *
+ * @param s List
+ * @param i Index of the first digit, moved past the number
+ * @param n Receives the number
+ * @return 0 on success, -1 without digits or when it is too large
+ */
+static int	cut_number(const char *s, size_t *i, size_t *n)
+{
+	size_t	start;
+
+	start = *i;
+	*n = 0;
+	while (ft_isdigit(s[*i]))
+	{
+		if (*n > SIZE_MAX / 10 - 1)
+			return (-1);
+		*n = *n * 10 + (s[*i] - '0');
+		(*i)++;
+	}
+	if (*i == start)
+		return (-1);
+	return (0);
+}
+
+/**
+ * @brief Reads one item of a cut list: "N", "N-M", "N-" or "-M"
+ *
+ * Positions count from 1 and a range may not decrease; cut rejects
+ * anything else, so such lists are left to it.
+ *
+ * @param s List
+ * @param i Index of the item, moved to the separator after it
+ * @param r Receives the range, hi being SIZE_MAX when open
+ * @return 0 on success, -1 if the item is not valid
+ */
+static int	cut_item(const char *s, size_t *i, t_cut_range *r)
+{
+	r->lo = 1;
+	r->hi = SIZE_MAX;
+	if (s[*i] == '-' && !ft_isdigit(s[*i + 1]))
+		return (-1);
+	if (s[*i] != '-' && cut_number(s, i, &r->lo) < 0)
+		return (-1);
+	if (s[*i] != '-')
+		r->hi = r->lo;
+	else
+	{
+		(*i)++;
+		if (ft_isdigit(s[*i]) && cut_number(s, i, &r->hi) < 0)
+			return (-1);
+	}
+	if (r->lo == 0 || r->hi < r->lo)
+		return (-1);
+	if (s[*i] && s[*i] != ',' && s[*i] != ' ' && s[*i] != '\t')
+		return (-1);
+	return (0);
+}
+
+/**
+ * @brief Inserts a range in order of start, doubling the array when full
+ *
+ * @param cut Selection
+ * @param r Range to insert
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	cut_push(t_cut *cut, const t_cut_range *r)
+{
+	t_cut_range	*grown;
+	size_t		cap;
+	size_t		j;
+
+	if (cut->n == 0 || (cut->n >= 4 && (cut->n & (cut->n - 1)) == 0))
+	{
+		cap = cut->n * 2 + (cut->n == 0) * 4;
+		grown = malloc(sizeof(t_cut_range) * cap);
+		if (!grown)
+			return (-1);
+		if (cut->n)
+			ft_memcpy(grown, cut->ranges, sizeof(t_cut_range) * cut->n);
+		free(cut->ranges);
+		cut->ranges = grown;
+	}
+	j = cut->n;
+	while (j > 0 && cut->ranges[j - 1].lo > r->lo)
+	{
+		cut->ranges[j] = cut->ranges[j - 1];
+		j--;
+	}
+	cut->ranges[j] = *r;
+	cut->n++;
+	return (0);
+}
+
+/**
+ * @brief Merges the ranges that overlap
+ *
+ * Ranges that only touch ("1-2,3-4") stay apart, as in cut: the output
+ * delimiter of -b goes between them.
+ *
+ * @param cut Selection, sorted, holding at least one range
+ */
+static void	cut_merge(t_cut *cut)
+{
+	size_t	i;
+	size_t	j;
+
+	j = 0;
+	i = 0;
+	while (++i < cut->n)
+	{
+		if (cut->ranges[i].lo > cut->ranges[j].hi)
+		{
+			j++;
+			cut->ranges[j] = cut->ranges[i];
+		}
+		else if (cut->ranges[i].hi > cut->ranges[j].hi)
+			cut->ranges[j].hi = cut->ranges[i].hi;
+	}
+	cut->n = j + 1;
+}
+
+/**
+ * @brief Parses a -b, -c or -f list into sorted, disjoint ranges
+ *
+ * Items are separated by commas or blanks.
+ *
+ * @param list List as written on the command line
+ * @param cut Receives the ranges
+ * @return 0 on success, -1 if cut would reject the list
+ */
+int	parse_cut_list(const char *list, t_cut *cut)
+{
+	t_cut_range	r;
+	size_t		i;
+
+	i = 0;
+	while (1)
+	{
+		if (cut_item(list, &i, &r) < 0 || cut_push(cut, &r) < 0)
+			return (-1);
+		if (!list[i])
+			break ;
+		i++;
+	}
+	cut_merge(cut);
+	return (0);
+}
@@ -0,0 +1,195 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cut_parse_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:54:45 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 13:54:45 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Applies an option that takes a value (-b, -c, -f, -d or
+ * --output-delimiter, given as 'o')
+ *
+ * The delimiter is a single byte, an empty one meaning NUL; an empty
+ * output delimiter is a NUL byte as well. Only one list is accepted.
+ * -c counts bytes in coreutils, so it is only taken over in the C
+ * locale, where no cut counts characters differently.
+ *
+ * @param cut Options parsed so far
+ * @param opt Option letter
+ * @param value Value of the option, NULL when it is missing
+ * @return 0 on success, -1 if cut would reject it
+ */
+static int	cut_set(t_cut *cut, int opt, const char *value)
+{
+	if (!value || (opt == 'c' && ctype_locale() != CTYPE_C))
+		return (-1);
+	if (opt == 'd')
+	{
+		if (value[0] == '\n' || (value[0] && value[1]))
+			return (-1);
+		cut->delim = value[0];
+		cut->flags |= CUT_DELIM;
+		return (0);
+	}
+	if (opt == 'o')
+	{
+		cut->outdelim = value;
+		cut->outlen = ft_strlen(value) + !value[0];
+		cut->flags |= CUT_OUTDELIM;
+		return (0);
+	}
+	if (cut->list)
+		return (-1);
+	cut->list = value;
+	if (opt == 'f')
+		cut->flags |= CUT_FIELDS;
+	return (0);
+}
+
+/**
+ * @brief Parses a cluster of short options ("-sd:", "-f", "1", "-nb1-3")
+ *
+ * @param argv Stage argument vector
+ * @param i Index of the cluster
+ * @param cut Receives the options
+ * @return Number of arguments consumed, or 0 or -1 if not supported
+ */
+static int	cut_short(char **argv, int i, t_cut *cut)
+{
+	size_t	k;
+
+	k = 1;
+	while (argv[i][k] && !ft_strchr("bcdf", argv[i][k]))
+	{
+		if (argv[i][k] == 's')
+			cut->flags |= CUT_SUPPRESS;
+		else if (argv[i][k] != 'n')
+			return (-1);
+		k++;
+	}
+	if (!argv[i][k])
+		return (1);
+	if (argv[i][k + 1])
+		return (cut_set(cut, argv[i][k], argv[i] + k + 1) + 1);
+	if (cut_set(cut, argv[i][k], argv[i + 1]) < 0)
+		return (-1);
+	return (2);
+}
+
+/**
+ * @brief Parses a long option ("--fields=1,3", "--delimiter :", ...)
+ *
+ * Abbreviations are left to cut.
+ *
+ * @param argv Stage argument vector
+ * @param i Index of the option
+ * @param cut Receives the options
+ * @return Number of arguments consumed, or 0 or -1 if not supported
+ */
+static int	cut_long(char **argv, int i, t_cut *cut)
+{
+	static const char	*names[] = {"--bytes", "--characters", "--fields",
+		"--delimiter", "--output-delimiter", "--only-delimited",
+		"--complement", NULL};
+	size_t				len;
+	int					k;
+
+	k = -1;
+	while (names[++k])
+	{
+		len = ft_strlen(names[k]);
+		if (ft_strncmp(argv[i], names[k], len) == 0
+			&& (argv[i][len] == '=' || !argv[i][len]))
+			break ;
+	}
+	if (!names[k] || (k >= 5 && argv[i][len]))
+		return (-1);
+	cut->flags |= (k == 5) * CUT_SUPPRESS | (k == 6) * CUT_COMPLEMENT;
+	if (k >= 5)
+		return (1);
+	if (argv[i][len] == '=')
+		return (cut_set(cut, "bcfdo"[k], argv[i] + len + 1) + 1);
+	if (cut_set(cut, "bcfdo"[k], argv[i + 1]) < 0)
+		return (-1);
+	return (2);
+}
+
+/**
+ * @brief Replaces the selection by the positions it leaves out
+ *
+ * @param cut Selection, sorted and disjoint
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	cut_complement(t_cut *cut)
+{
+	t_cut_range	*sel;
+	size_t		next;
+	size_t		i;
+	size_t		n;
+
+	sel = malloc(sizeof(t_cut_range) * (cut->n + 1));
+	if (!sel)
+		return (-1);
+	next = 1;
+	i = 0;
+	n = 0;
+	while (i < cut->n)
+	{
+		sel[n].lo = next;
+		sel[n].hi = cut->ranges[i].lo - 1;
+		n += (cut->ranges[i].lo > next);
+		next = cut->ranges[i++].hi + 1;
+	}
+	sel[n].lo = next;
+	sel[n].hi = SIZE_MAX;
+	n += (next != 0);
+	free(cut->ranges);
+	cut->ranges = sel;
+	cut->n = n;
+	return (0);
+}
+
+/**
+ * @brief Recognizes a cut stage reading stdin
+ *
+ * Exactly one of -b, -c and -f is needed; -d and -s only go with -f, as
+ * cut requires. File operands and any other option are left to the real
+ * binary.
+ *
+ * @param argv Stage argument vector
+ * @param cut Receives the options and the selection (ranges to free)
+ * @return 0 on success, -1 if the stage is not such a cut
+ */
+int	parse_cut_argv(char **argv, t_cut *cut)
+{
+	int	used;
+	int	i;
+
+	ft_memset(cut, 0, sizeof(t_cut));
+	cut->delim = '\t';
+	i = 1;
+	while (argv[i] && ft_strncmp(argv[i], "--", 3) != 0)
+	{
+		used = -1;
+		if (argv[i][0] == '-' && argv[i][1] == '-')
+			used = cut_long(argv, i, cut);
+		else if (argv[i][0] == '-' && argv[i][1])
+			used = cut_short(argv, i, cut);
+		if (used <= 0)
+			return (-1);
+		i += used;
+	}
+	if ((argv[i] && argv[i + 1]) || !cut->list
+		|| (!(cut->flags & CUT_FIELDS)
+			&& (cut->flags & (CUT_DELIM | CUT_SUPPRESS)))
+		|| parse_cut_list(cut->list, cut) < 0
+		|| ((cut->flags & CUT_COMPLEMENT) && cut_complement(cut) < 0))
+		return (-1);
+	return (0);
+}
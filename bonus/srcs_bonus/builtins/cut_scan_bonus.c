@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cut_scan_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:54:45 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 13:54:45 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Marks the delimiters and newlines of up to 64 bytes
+ *
+ * @param p Start of the block
+ * @param len Size of the block, at most 64
+ * @param delim Field delimiter
+ * @return Bitmask of the bytes equal to delim or '\n', bit k standing
+ * for p[k]
+ */
+uint64_t	cut_mask_scalar(const unsigned char *p, size_t len, int delim)
+{
+	uint64_t	mask;
+
+	mask = 0;
+	while (len > 0)
+	{
+		len--;
+		mask = mask << 1 | (p[len] == (unsigned char)delim
+				|| p[len] == '\n');
+	}
+	return (mask);
+}
+
+/**
+ * @brief Marks the delimiters and newlines of the next 64 bytes with the
+ * widest kernel the CPU supports
+ *
+ * @param p Start of the block
+ * @param len Bytes left from p (only the first 64 are looked at)
+ * @param delim Field delimiter
+ * @return Bitmask of the bytes equal to delim or '\n'
+ */
+uint64_t	cut_mask(const unsigned char *p, size_t len, int delim)
+{
+	int	level;
+
+	level = simd_level();
+	if (len >= 64 && level == 2)
+		return (cut_mask_avx2(p, delim));
+	if (len > 64)
+		len = 64;
+	return (cut_mask_scalar(p, len, delim));
+}
+
+/**
+ * @brief Prints the selected bytes of one line, without its newline
+ *
+ * Ranges are written as slices of the read buffer. With
+ * --output-delimiter, the delimiter goes before every range but the
+ * first one printed, as in cut.
+ *
+ * @param run Cut in progress
+ * @param line Start of the line
+ * @param len Length of the line
+ * @return 0 on success, -1 on write error
+ */
+static int	cut_bytes_line(t_cut_run *run, const char *line, size_t len)
+{
+	const t_cut	*cut;
+	size_t		hi;
+	size_t		k;
+
+	cut = run->cut;
+	k = 0;
+	while (k < cut->n && cut->ranges[k].lo <= len)
+	{
+		hi = cut->ranges[k].hi;
+		if (hi > len)
+			hi = len;
+		if (k > 0 && (cut->flags & CUT_OUTDELIM)
+			&& out_write(&run->out, cut->outdelim, cut->outlen) < 0)
+			return (-1);
+		if (out_write(&run->out, line + cut->ranges[k].lo - 1,
+				hi - cut->ranges[k].lo + 1) < 0)
+			return (-1);
+		k++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Cuts -b/-c selections out of a block of whole lines
+ *
+ * Lines are found with memchr(); the last line of the input gets a
+ * newline when it lacks one.
+ *
+ * @param run Cut in progress
+ * @param p Block, ending with a newline unless it is the end of input
+ * @param len Size of the block
+ * @return 0 on success, -1 on write error
+ */
+int	cut_bytes(t_cut_run *run, const char *p, size_t len)
+{
+	const char	*end;
+	const char	*nl;
+
+	end = p + len;
+	while (p < end)
+	{
+		nl = memchr(p, '\n', end - p);
+		if (!nl)
+			nl = end;
+		if (cut_bytes_line(run, p, nl - p) < 0
+			|| out_write(&run->out, "\n", 1) < 0)
+			return (-1);
+		p = nl + (nl < end);
+	}
+	return (0);
+}
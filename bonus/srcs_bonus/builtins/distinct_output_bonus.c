@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   distinct_output_bonus.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:45:48 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 13:45:48 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Formats a count the way uniq -c does ("%7ld ")
+ *
+ * @param field Receives the field, at least 24 bytes
+ * @param n Count
+ * @return Length of the field
+ */
+static size_t	count_field(char *field, long n)
+{
+	char	digits[24];
+	size_t	len;
+	int		d;
+
+	d = 0;
+	digits[d++] = '0' + n % 10;
+	n /= 10;
+	while (n > 0)
+	{
+		digits[d++] = '0' + n % 10;
+		n /= 10;
+	}
+	len = 0;
+	while (len + d < 7)
+		field[len++] = ' ';
+	while (d > 0)
+		field[len++] = digits[--d];
+	field[len++] = ' ';
+	return (len);
+}
+
+/**
+ * @brief Writes the distinct lines of the table, with their counts
+ * under -c
+ *
+ * @param d Distinct table
+ * @param out_fd Destination file descriptor
+ * @return 0 on success, -1 on write error
+ */
+int	dist_emit(const t_distinct *d, int out_fd)
+{
+	t_out	out;
+	char	field[24];
+	size_t	j;
+	int		err;
+
+	out_init(&out, out_fd);
+	err = 0;
+	j = 0;
+	while (!err && j < d->n)
+	{
+		if (d->flags & DIST_COUNT)
+			err = out_write(&out, field,
+					count_field(field, d->entries[j].count));
+		if (!err)
+			err = out_write(&out, d->arena.data + d->entries[j].off,
+					d->entries[j].len);
+		if (!err)
+			err = out_write(&out, "\n", 1);
+		j++;
+	}
+	if (err || out_flush(&out) < 0)
+		return (-builtin_error("@distinct", "write failed"));
+	return (0);
+}
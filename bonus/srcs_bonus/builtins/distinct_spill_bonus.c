@@ -0,0 +1,170 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   distinct_spill_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:45:48 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 13:45:48 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Appends one entry to its partition file
+ *
+ * A record is the count and the length, followed by the line bytes. The
+ * partition file is created on first use.
+ *
+ * @param d Distinct table
+ * @param e Entry to write
+ * @return 0 on success, -1 on error
+ */
+static int	part_write(t_distinct *d, const t_dist_entry *e)
+{
+	size_t	head[2];
+	int		p;
+
+	p = e->hash >> 58;
+	if (d->parts[p] < 0)
+	{
+		d->parts[p] = open_tmpfile(NULL);
+		if (d->parts[p] < 0)
+			return (-builtin_error("@distinct",
+					"cannot create temporary file"));
+		out_init(&d->outs[p], d->parts[p]);
+	}
+	head[0] = e->count;
+	head[1] = e->len;
+	if (out_write(&d->outs[p], (char *)head, sizeof(head)) < 0
+		|| out_write(&d->outs[p], d->arena.data + e->off, e->len) < 0)
+		return (-builtin_error("@distinct", "write failed"));
+	return (0);
+}
+
+/**
+ * @brief Moves the whole table out to the partition files
+ *
+ * Equal lines always land in the same partition, so each partition can
+ * later be counted on its own in a fraction of the memory.
+ *
+ * @param d Distinct table over its memory budget
+ * @return 0 on success, -1 on error
+ */
+int	dist_spill(t_distinct *d)
+{
+	size_t	j;
+	int		p;
+
+	if (!d->parts)
+	{
+		d->parts = malloc(sizeof(int) * DIST_PARTS);
+		d->outs = malloc(sizeof(t_out) * DIST_PARTS);
+		p = 0;
+		while (d->parts && p < DIST_PARTS)
+		{
+			d->parts[p] = -1;
+			p++;
+		}
+		if (!d->parts || !d->outs)
+			return (-builtin_error("@distinct", "memory exhausted"));
+	}
+	j = 0;
+	while (j < d->n)
+	{
+		if (part_write(d, &d->entries[j]) < 0)
+			return (-1);
+		j++;
+	}
+	dist_clear(d);
+	return (0);
+}
+
+/**
+ * @brief Makes sure n bytes of a partition are buffered
+ *
+ * @param r Reader on the partition file
+ * @param n Number of bytes needed
+ * @return 1 if they are, 0 at a clean end of file, -1 on error
+ */
+static int	part_need(t_reader *r, size_t n)
+{
+	while (r->end - r->start < n && !r->eof)
+	{
+		if (reader_fill(r) < 0)
+			return (-1);
+	}
+	if (r->end - r->start >= n)
+		return (1);
+	return (-(r->end > r->start));
+}
+
+/**
+ * @brief Counts the records of one partition back into the table
+ *
+ * @param d Empty distinct table
+ * @param fd Partition file, fully written
+ * @return 0 on success, -1 on error
+ */
+static int	part_load(t_distinct *d, int fd)
+{
+	t_reader	r;
+	size_t		head[2];
+	int			ret;
+
+	if (lseek(fd, 0, SEEK_SET) < 0 || reader_init(&r, fd) < 0)
+		return (-builtin_error("@distinct", "temporary file"));
+	ret = part_need(&r, sizeof(head));
+	while (ret > 0)
+	{
+		ft_memcpy(head, r.buf + r.start, sizeof(head));
+		ret = part_need(&r, sizeof(head) + head[1]);
+		if (ret > 0 && dist_add(d, r.buf + r.start + sizeof(head), head[1],
+				head[0]) < 0)
+			ret = -1;
+		r.start += sizeof(head) + head[1];
+		if (ret > 0)
+			ret = part_need(&r, sizeof(head));
+	}
+	reader_free(&r);
+	if (ret < 0)
+		return (-builtin_error("@distinct", "temporary file"));
+	return (0);
+}
+
+/**
+ * @brief Writes out every distinct line once the input is consumed
+ *
+ * Without a spill the table is written as is, in order of first
+ * appearance. Otherwise what is left joins the partitions, which are
+ * then counted and written one after the other.
+ *
+ * @param d Distinct table
+ * @param out_fd Destination file descriptor
+ * @return 0 on success, -1 on error
+ */
+int	dist_drain(t_distinct *d, int out_fd)
+{
+	int	p;
+
+	if (!d->parts)
+		return (dist_emit(d, out_fd));
+	if (dist_spill(d) < 0)
+		return (-1);
+	p = 0;
+	while (p < DIST_PARTS)
+	{
+		if (d->parts[p] >= 0)
+		{
+			if (out_flush(&d->outs[p]) < 0)
+				return (-builtin_error("@distinct", "write failed"));
+			if (part_load(d, d->parts[p]) < 0 || dist_emit(d, out_fd) < 0)
+				return (-1);
+			dist_clear(d);
+		}
+		p++;
+	}
+	return (0);
+}
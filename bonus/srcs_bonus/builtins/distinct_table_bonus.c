@@ -0,0 +1,175 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   distinct_table_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:45:48 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:33:21 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Hashes a line eight bytes at a time
+ *
+ * The top bits pick the spill partition, the low bits the table slot.
+ *
+ * @param p Line
+ * @param len Length of the line
+ * @return 64-bit hash
+ */
+uint64_t	dist_hash(const char *p, size_t len)
+{
+	uint64_t	h;
+	uint64_t	w;
+
+	h = len * 0x9E3779B97F4A7C15ULL;
+	while (len >= 8)
+	{
+		memcpy(&w, p, 8);
+		h = (h ^ w) * 0xBF58476D1CE4E5B9ULL;
+		h ^= h >> 31;
+		p += 8;
+		len -= 8;
+	}
+	w = 0;
+	memcpy(&w, p, len);
+	h = (h ^ w) * 0x94D049BB133111EBULL;
+	h ^= h >> 29;
+	h *= 0xBF58476D1CE4E5B9ULL;
+	return (h ^ (h >> 32));
+}
+
+/**
+ * @brief Doubles the slot array and reinserts every entry
+ *
+ * A slot holds the upper half of the hash next to the entry index plus
+ * one, so most probes that miss never touch the entries.
+ *
+ * @param d Distinct table
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	dist_grow(t_distinct *d)
+{
+	uint64_t	*slots;
+	size_t		mask;
+	size_t		i;
+	size_t		j;
+
+	mask = DIST_SLOTS - 1;
+	if (d->slots)
+		mask = d->mask * 2 + 1;
+	slots = ft_calloc(mask + 1, sizeof(uint64_t));
+	if (!slots)
+		return (-1);
+	j = 0;
+	while (j < d->n)
+	{
+		i = d->entries[j].hash & mask;
+		while (slots[i])
+			i = (i + 1) & mask;
+		slots[i] = (d->entries[j].hash & 0xFFFFFFFF00000000ULL) | (j + 1);
+		j++;
+	}
+	free(d->slots);
+	d->slots = slots;
+	d->mask = mask;
+	return (0);
+}
+
+/**
+ * @brief Finds the slot of a line, or the empty slot where it belongs
+ *
+ * @param d Distinct table
+ * @param h Hash of the line
+ * @param data Line
+ * @param len Length of the line
+ * @return Slot index
+ */
+size_t	dist_find(const t_distinct *d, uint64_t h, const char *data,
+		size_t len)
+{
+	const t_dist_entry	*e;
+	size_t				i;
+
+	i = h & d->mask;
+	while (d->slots[i])
+	{
+		if ((d->slots[i] >> 32) == (h >> 32))
+		{
+			e = &d->entries[(d->slots[i] & 0xFFFFFFFFULL) - 1];
+			if (e->len == len && (len == 0
+					|| ft_memcmp(d->arena.data + e->off, data, len) == 0))
+				return (i);
+		}
+		i = (i + 1) & d->mask;
+	}
+	return (i);
+}
+
+/**
+ * @brief Makes room for one more entry
+ *
+ * @param d Distinct table
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	dist_reserve(t_distinct *d)
+{
+	t_dist_entry	*grown;
+
+	if (d->n < d->cap)
+		return (0);
+	grown = malloc(sizeof(t_dist_entry) * (d->cap * 2 + 1024));
+	if (!grown)
+		return (-1);
+	if (d->n)
+		ft_memcpy(grown, d->entries, sizeof(t_dist_entry) * d->n);
+	free(d->entries);
+	d->entries = grown;
+	d->cap = d->cap * 2 + 1024;
+	return (0);
+}
+
+/**
+ * @brief Counts a line, adding it to the table the first time it is seen
+ *
+ * The bytes of every distinct line are copied once into the arena;
+ * entries keep their order of first appearance.
+ *
+ * @param d Distinct table
+ * @param data Line
+ * @param len Length of the line
+ * @param count Number of occurrences to add
+ * @return Index of the entry, -1 on allocation failure
+ */
+long	dist_add(t_distinct *d, const char *data, size_t len, long count)
+{
+	t_dist_entry	*e;
+	uint64_t		h;
+	size_t			i;
+
+	if ((d->n + 1) * 2 > d->mask + 1 && dist_grow(d) < 0)
+		return (-1);
+	h = dist_hash(data, len);
+	i = dist_find(d, h, data, len);
+	if (d->slots[i])
+		d->entries[(d->slots[i] & 0xFFFFFFFFULL) - 1].count += count;
+	if (d->slots[i])
+		return ((d->slots[i] & 0xFFFFFFFFULL) - 1);
+	if (dist_reserve(d) < 0)
+		return (-1);
+	e = &d->entries[d->n];
+	e->hash = h;
+	e->off = d->arena.len;
+	e->len = len;
+	e->count = count;
+	buf_append(&d->arena, data, len);
+	d->slots[i] = (h & 0xFFFFFFFF00000000ULL) | (d->n + 1);
+	d->n++;
+	if (d->arena.failed)
+		return (-1);
+	return (d->n - 1);
+}
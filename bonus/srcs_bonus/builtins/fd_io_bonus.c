@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fd_io_bonus.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:45:04 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:45:04 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief read() that also serves the rings between threaded stages
+ *
+ * @param fd Kernel or ring descriptor
+ * @param buf Destination
+ * @param len Size of buf
+ * @return Bytes read, 0 at EOF, -1 on error (errno is set)
+ */
+ssize_t	io_read(int fd, void *buf, size_t len)
+{
+	t_ring	*r;
+
+	r = ring_get(fd);
+	if (r)
+		return (ring_read(r, buf, len));
+	return (read(fd, buf, len));
+}
+
+/**
+ * @brief write() that also serves the rings between threaded stages
+ *
+ * @param fd Kernel or ring descriptor
+ * @param buf Data to write
+ * @param len Number of bytes
+ * @return Bytes written, -1 on error (errno is set)
+ */
+ssize_t	io_write(int fd, const void *buf, size_t len)
+{
+	t_ring	*r;
+
+	r = ring_get(fd);
+	if (r)
+		return (ring_write(r, buf, len));
+	return (write(fd, buf, len));
+}
+
+/**
+ * @brief writev() that also serves the rings between threaded stages
+ *
+ * A ring takes the slices one after the other; they end up in the same
+ * buffers anyway.
+ *
+ * @param fd Kernel or ring descriptor
+ * @param iov Slices to write
+ * @param count Number of slices
+ * @return Bytes written, -1 on error (errno is set)
+ */
+ssize_t	io_writev(int fd, const struct iovec *iov, int count)
+{
+	t_ring	*r;
+	ssize_t	total;
+	int		k;
+
+	r = ring_get(fd);
+	if (!r)
+		return (writev(fd, iov, count));
+	total = 0;
+	k = 0;
+	while (k < count)
+	{
+		total += ring_write(r, iov[k].iov_base, iov[k].iov_len);
+		k++;
+	}
+	return (total);
+}
+
+/**
+ * @brief close() that also serves the rings between threaded stages
+ *
+ * A ring is released by the thread that set it up; its reader only
+ * abandons it, which stops the writer as a closed pipe would.
+ *
+ * @param fd Kernel or ring descriptor
+ */
+void	io_close(int fd)
+{
+	if (ring_get(fd))
+		ring_abandon(fd);
+	else
+		close(fd);
+}
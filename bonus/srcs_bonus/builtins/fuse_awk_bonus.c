@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuse_awk_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:54:29 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:54:29 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Prepares awk inside a fused stage
+ *
+ * @param op Operator of the awk stage
+ * @return 0 on success, -1 on allocation failure
+ */
+int	fuse_awk_start(t_fuse_op *op)
+{
+	t_awk_run	*run;
+
+	run = ft_calloc(1, sizeof(t_awk_run));
+	if (!run)
+		return (-1);
+	run->awk = op->stage->state;
+	fuse_out(op, &run->out);
+	op->run = run;
+	return (0);
+}
+
+/**
+ * @brief Runs the rules of awk over a block of records
+ *
+ * @param op Operator of the awk stage
+ * @param p Whole records
+ * @param len Size of the block
+ * @return 0 on success, -1 on error
+ */
+int	fuse_awk_block(t_fuse_op *op, const char *p, size_t len)
+{
+	if (awk_block(op->run, p, len) < 0)
+		return (-1);
+	return (0);
+}
+
+/**
+ * @brief Runs the END rule and releases the awk tables
+ *
+ * @param op Operator of the awk stage
+ * @return 0 on success, -1 on write error
+ */
+int	fuse_awk_finish(t_fuse_op *op)
+{
+	t_awk_run	*run;
+	int			status;
+
+	run = op->run;
+	status = awk_end(run);
+	free(run->table.arena.data);
+	free(run->table.entries);
+	free(run->table.slots);
+	return (status);
+}
@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuse_bonus.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:54:29 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:05:46 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Table of the builtins that can run inside a fused stage
+ *
+ * Byte kinds take any slice of the stream; line kinds are only handed
+ * whole lines, records lines that all end with a newline. A terminal
+ * kind (wc) only prints at the end, so it has to come last. A kind
+ * with a parallel test can run on separate blocks of whole lines at
+ * once (--steal), what it counted on each block moved by merge.
+ *
+ * @return The kinds, ended by a NULL name
+ */
+static const t_fuse_kind	*fuse_kinds(void)
+{
+	static const t_fuse_kind	kinds[] = {
+	{"cat", NULL, NULL, fuse_emit, NULL, FUSE_BYTES, 0, fuse_stateless, NULL},
+	{"tr", NULL, fuse_tr_start, fuse_tr_block, NULL, FUSE_BYTES, 0,
+		fuse_tr_parallel, NULL},
+	{"head", NULL, fuse_head_start, fuse_head_block, NULL, FUSE_BYTES, 0,
+		NULL, NULL},
+	{"wc", NULL, fuse_wc_start, fuse_wc_block, fuse_wc_finish, FUSE_BYTES,
+		1, fuse_stateless, fuse_wc_merge},
+	{"grep", fuse_grep_accept, fuse_grep_start, fuse_grep_block,
+		fuse_grep_finish, FUSE_LINES, 0, fuse_grep_parallel, fuse_grep_merge},
+	{"cut", NULL, fuse_cut_start, fuse_cut_block, NULL, FUSE_LINES, 0,
+		fuse_stateless, NULL},
+	{"sed", NULL, fuse_sed_start, fuse_sed_block, NULL, FUSE_LINES, 0,
+		fuse_stateless, NULL},
+	{"awk", NULL, fuse_awk_start, fuse_awk_block, fuse_awk_finish,
+		FUSE_RECORDS, 0, NULL, NULL},
+	{NULL, NULL, NULL, NULL, NULL, 0, 0, NULL, NULL}
+	};
+
+	return (kinds);
+}
+
+/**
+ * @brief Finds how a builtin stage runs inside a fused stage
+ *
+ * @param stage Stage to look up
+ * @return Its kind, or NULL if the stage cannot be fused
+ */
+const t_fuse_kind	*fuse_kind(t_stage *stage)
+{
+	const t_fuse_kind	*kind;
+
+	if (!stage->builtin)
+		return (NULL);
+	kind = fuse_kinds();
+	while (kind->name && ft_strncmp(kind->name, stage->builtin->name,
+			ft_strlen(kind->name) + 1) != 0)
+		kind++;
+	if (!kind->name || (kind->accept && !kind->accept(stage)))
+		return (NULL);
+	return (kind);
+}
+
+/**
+ * @brief Tells whether --fuse runs stage i and stage i + 1 in one loop
+ *
+ * @param context Pointer to the pipex context structure
+ * @param i Index of the first stage
+ * @return 1 if they fuse, 0 otherwise
+ */
+int	fuse_next(t_pipex *context, int i)
+{
+	const t_fuse_kind	*kind;
+
+	if (!context->opts.fuse || i + 1 >= context->cmd_count)
+		return (0);
+	kind = fuse_kind(&context->stages[i]);
+	return (kind && !kind->terminal
+		&& fuse_kind(&context->stages[i + 1]) != NULL);
+}
+
+/**
+ * @brief Passes output of a fused operator on to the next one, or
+ * writes it out after the last one
+ *
+ * @param op Operator producing the bytes
+ * @param p Bytes
+ * @param len Number of bytes
+ * @return 0 on success, -1 on error
+ */
+int	fuse_emit(t_fuse_op *op, const char *p, size_t len)
+{
+	if (op->next)
+		return (fuse_push(op->next, p, len));
+	return (write_all(op->out_fd, p, len));
+}
+
+/**
+ * @brief Points the buffered writer of an operator at its successor
+ *
+ * @param op Operator owning the writer
+ * @param out Writer the builtin's block function fills
+ */
+void	fuse_out(t_fuse_op *op, t_out *out)
+{
+	out_init(out, op->out_fd);
+	if (op->next)
+	{
+		out->sink = fuse_sink;
+		out->ctx = op->next;
+	}
+	op->out = out;
+}
@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuse_bytes_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:54:29 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:54:29 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Prepares tr inside a fused stage
+ *
+ * The slices pushed in belong to the producer, so they are translated
+ * in a buffer of the operator; arg keeps the last byte for -s.
+ *
+ * @param op Operator of the tr stage
+ * @return 0 on success, -1 on allocation failure
+ */
+int	fuse_tr_start(t_fuse_op *op)
+{
+	op->run = malloc(IO_CHUNK);
+	op->arg = -1;
+	return (-(op->run == NULL));
+}
+
+/**
+ * @brief Translates a slice and passes it on
+ *
+ * @param op Operator of the tr stage
+ * @param p Bytes
+ * @param len Number of bytes
+ * @return 0 on success, -1 on error
+ */
+int	fuse_tr_block(t_fuse_op *op, const char *p, size_t len)
+{
+	size_t	n;
+	size_t	kept;
+	int		last;
+
+	while (len > 0)
+	{
+		n = len;
+		if (n > IO_CHUNK)
+			n = IO_CHUNK;
+		ft_memcpy(op->run, p, n);
+		last = op->arg;
+		kept = tr_block(op->stage->state, op->run, n, &last);
+		op->arg = last;
+		if (fuse_emit(op, op->run, kept) < 0)
+			return (-1);
+		p += n;
+		len -= n;
+	}
+	return (0);
+}
+
+/**
+ * @brief Prepares head inside a fused stage; arg counts what is left
+ *
+ * @param op Operator of the head stage
+ * @return 0 on success, -1 on allocation failure
+ */
+int	fuse_head_start(t_fuse_op *op)
+{
+	t_head	*head;
+
+	head = malloc(sizeof(t_head));
+	if (!head)
+		return (-1);
+	parse_head_argv(op->stage->argv, head);
+	op->run = head;
+	op->arg = head->count;
+	op->stop = (head->count <= 0);
+	return (0);
+}
+
+/**
+ * @brief Passes on the part of a slice that is still wanted
+ *
+ * Once the count is reached the operator stops, which stops reading
+ * the input of the whole fused stage.
+ *
+ * @param op Operator of the head stage
+ * @param p Bytes
+ * @param len Number of bytes
+ * @return 0 on success, -1 on error
+ */
+int	fuse_head_block(t_fuse_op *op, const char *p, size_t len)
+{
+	const t_head	*head;
+	size_t			take;
+
+	head = op->run;
+	if (head->bytes && (long)len > op->arg)
+		len = op->arg;
+	take = head_take(head, p, len, &op->arg);
+	op->stop = (op->arg <= 0);
+	return (fuse_emit(op, p, take));
+}
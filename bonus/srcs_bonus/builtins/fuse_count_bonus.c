@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuse_count_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:54:29 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:54:29 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Prepares wc inside a fused stage; arg holds the WC_* flags
+ *
+ * @param op Operator of the wc stage
+ * @return 0 on success, -1 on allocation failure
+ */
+int	fuse_wc_start(t_fuse_op *op)
+{
+	op->run = ft_calloc(1, sizeof(t_wc));
+	op->arg = parse_wc(op->stage->argv);
+	return (-(op->run == NULL));
+}
+
+/**
+ * @brief Counts a slice
+ *
+ * @param op Operator of the wc stage
+ * @param p Bytes
+ * @param len Number of bytes
+ * @return Always 0
+ */
+int	fuse_wc_block(t_fuse_op *op, const char *p, size_t len)
+{
+	((t_wc *)op->run)->bytes += len;
+	wc_scan(op->run, (const unsigned char *)p, len, op->arg);
+	return (0);
+}
+
+/**
+ * @brief Prints the counts, padded as for a pipe
+ *
+ * @param op Operator of the wc stage, always the last one
+ * @return 0 on success, 1 on write error
+ */
+int	fuse_wc_finish(t_fuse_op *op)
+{
+	struct stat	st;
+
+	ft_memset(&st, 0, sizeof(struct stat));
+	return (print_counts(op->run, op->arg, count_width(op->arg, &st),
+			op->out_fd));
+}
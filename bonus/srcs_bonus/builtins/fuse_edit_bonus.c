@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuse_edit_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:54:29 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:54:29 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Cuts the selected bytes or fields of a block
+ *
+ * @param op Operator of the cut stage
+ * @param p Whole lines
+ * @param len Size of the block
+ * @return 0 on success, -1 on error
+ */
+int	fuse_cut_block(t_fuse_op *op, const char *p, size_t len)
+{
+	return (cut_block(op->run, p, len));
+}
+
+/**
+ * @brief Prepares sed inside a fused stage
+ *
+ * Its gathered slices are handed to the next operator in order, which
+ * takes them before the block they point into is released.
+ *
+ * @param op Operator of the sed stage
+ * @return 0 on success, -1 on allocation failure
+ */
+int	fuse_sed_start(t_fuse_op *op)
+{
+	t_sed_run	*run;
+
+	run = ft_calloc(1, sizeof(t_sed_run));
+	if (!run)
+		return (-1);
+	run->sed = op->stage->state;
+	run->key = &run->sed->pat;
+	if (run->sed->flags & SED_ADDRESS)
+		run->key = &run->sed->addr;
+	run->out.fd = op->out_fd;
+	if (op->next)
+	{
+		run->out.sink = fuse_sink;
+		run->out.ctx = op->next;
+	}
+	op->run = run;
+	return (0);
+}
+
+/**
+ * @brief Edits a block
+ *
+ * @param op Operator of the sed stage
+ * @param p Whole lines
+ * @param len Size of the block
+ * @return 0 on success, -1 on error
+ */
+int	fuse_sed_block(t_fuse_op *op, const char *p, size_t len)
+{
+	return (sed_block(op->run, p, len));
+}
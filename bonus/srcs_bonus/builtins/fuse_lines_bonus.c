@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuse_lines_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:54:29 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:54:29 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief grep -c only prints at the end, straight to its fd, so it is
+ * not fused
+ *
+ * @param stage Stage of the grep builtin
+ * @return 1 if the stage can be fused, 0 otherwise
+ */
+int	fuse_grep_accept(t_stage *stage)
+{
+	return (!(((t_grep *)stage->state)->flags & GREP_COUNT));
+}
+
+/**
+ * @brief Prepares grep inside a fused stage
+ *
+ * @param op Operator of the grep stage
+ * @return 0 on success, -1 on allocation failure
+ */
+int	fuse_grep_start(t_fuse_op *op)
+{
+	t_grep_run	*run;
+
+	run = ft_calloc(1, sizeof(t_grep_run));
+	if (!run)
+		return (-1);
+	run->grep = op->stage->state;
+	fuse_out(op, &run->out);
+	op->run = run;
+	op->stop = (run->grep->max_count == 0);
+	return (0);
+}
+
+/**
+ * @brief Selects the matching lines of a block
+ *
+ * Input with a NUL byte is binary: as in the builtin, NULs end lines
+ * and the first match only prints the notice. The block belongs to the
+ * producer, so that rewrite is done on a copy.
+ *
+ * @param op Operator of the grep stage
+ * @param p Whole lines
+ * @param len Size of the block
+ * @return 0 on success, -1 on error
+ */
+int	fuse_grep_block(t_fuse_op *op, const char *p, size_t len)
+{
+	t_grep_run	*run;
+	char		*nul;
+	int			status;
+
+	run = op->run;
+	if (!run->binary && memchr(p, '\0', len))
+		run->binary = 1;
+	if (run->binary)
+	{
+		op->scratch.len = 0;
+		buf_append(&op->scratch, p, len);
+		if (op->scratch.failed)
+			return (-1);
+		p = op->scratch.data;
+		nul = memchr(op->scratch.data, '\0', len);
+		while (nul)
+		{
+			*nul = '\n';
+			nul = memchr(nul, '\0', op->scratch.data + len - nul);
+		}
+	}
+	status = grep_block(run, p, len);
+	op->stop = run->stop;
+	return (status);
+}
+
+/**
+ * @brief Prints the binary notice and returns grep's status
+ *
+ * @param op Operator of the grep stage
+ * @return 0 if a line was selected, 1 otherwise
+ */
+int	fuse_grep_finish(t_fuse_op *op)
+{
+	t_grep_run	*run;
+
+	run = op->run;
+	if (run->notice)
+		ft_putstr_fd("grep: (standard input): binary file matches\n",
+			STDERR_FILENO);
+	return (run->selected == 0);
+}
+
+/**
+ * @brief Prepares cut inside a fused stage
+ *
+ * @param op Operator of the cut stage
+ * @return 0 on success, -1 on allocation failure
+ */
+int	fuse_cut_start(t_fuse_op *op)
+{
+	t_cut_run	*run;
+
+	run = ft_calloc(1, sizeof(t_cut_run));
+	if (!run)
+		return (-1);
+	run->cut = op->stage->state;
+	run->index = 1;
+	fuse_out(op, &run->out);
+	op->run = run;
+	return (0);
+}
@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuse_merge_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:05:46 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:05:46 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Parallel test of the kinds that keep no state from one line to
+ * the next
+ *
+ * @param stage Stage of the builtin
+ * @return Always 1
+ */
+int	fuse_stateless(t_stage *stage)
+{
+	(void)stage;
+	return (1);
+}
+
+/**
+ * @brief tr works on separate blocks unless it squeezes (which looks at
+ * the byte before) or changes the newlines the blocks are cut at
+ *
+ * @param stage Stage of the tr builtin
+ * @return 1 if blocks can be translated apart, 0 otherwise
+ */
+int	fuse_tr_parallel(t_stage *stage)
+{
+	const t_tr	*tr;
+
+	tr = stage->state;
+	return (!(tr->flags & TR_SQUEEZE) && tr->map['\n'] == '\n'
+		&& !tr->del['\n']);
+}
+
+/**
+ * @brief grep works on separate blocks unless -m counts across them
+ *
+ * @param stage Stage of the grep builtin
+ * @return 1 if blocks can be searched apart, 0 otherwise
+ */
+int	fuse_grep_parallel(t_stage *stage)
+{
+	return (((t_grep *)stage->state)->max_count < 0);
+}
+
+/**
+ * @brief Moves what a grep has selected on a block to another
+ *
+ * @param into Operator that prints the notice and gives the status
+ * @param from Operator that searched the block, reset for the next one
+ */
+void	fuse_grep_merge(t_fuse_op *into, t_fuse_op *from)
+{
+	t_grep_run	*dst;
+	t_grep_run	*src;
+
+	dst = into->run;
+	src = from->run;
+	dst->selected += src->selected;
+	dst->notice |= src->notice;
+	src->selected = 0;
+	src->notice = 0;
+}
+
+/**
+ * @brief Moves the counts of a wc over a block to another
+ *
+ * @param into Operator that prints the counts
+ * @param from Operator that counted the block, reset for the next one
+ */
+void	fuse_wc_merge(t_fuse_op *into, t_fuse_op *from)
+{
+	t_wc	*dst;
+	t_wc	*src;
+
+	dst = into->run;
+	src = from->run;
+	dst->lines += src->lines;
+	dst->words += src->words;
+	dst->bytes += src->bytes;
+	ft_memset(src, 0, sizeof(t_wc));
+}
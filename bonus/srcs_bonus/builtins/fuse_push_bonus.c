@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuse_push_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:54:29 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:54:29 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Completes the line left over from the previous push
+ *
+ * @param op Line operator with a partial line in its carry
+ * @param p Start of the new bytes, advanced past what was used
+ * @param len Number of new bytes, decreased accordingly
+ * @return 0 on success, -1 on error
+ */
+static int	flush_carry(t_fuse_op *op, const char **p, size_t *len)
+{
+	const char	*nl;
+	size_t		n;
+
+	nl = memchr(*p, '\n', *len);
+	n = *len;
+	if (nl)
+		n = nl + 1 - *p;
+	buf_append(&op->carry, *p, n);
+	*p += n;
+	*len -= n;
+	if (op->carry.failed)
+		return (-1);
+	if (!nl)
+		return (0);
+	n = op->carry.len;
+	op->carry.len = 0;
+	return (op->kind->block(op, op->carry.data, n));
+}
+
+/**
+ * @brief Sink of a builtin's writer inside a fused stage
+ *
+ * @param ctx The next operator
+ * @param p Bytes written by the builtin
+ * @param len Number of bytes
+ * @return 0 on success, -1 on error
+ */
+int	fuse_sink(void *ctx, const char *p, size_t len)
+{
+	return (fuse_push(ctx, p, len));
+}
+
+/**
+ * @brief Feeds bytes to a fused operator
+ *
+ * Byte operators get the slice as is. Line operators get the whole
+ * lines straight from the producer's buffer, which is still in cache;
+ * only a line cut by the end of the slice is copied, into the carry.
+ *
+ * @param op Operator
+ * @param p Bytes
+ * @param len Number of bytes
+ * @return 0 on success, -1 on error
+ */
+int	fuse_push(t_fuse_op *op, const char *p, size_t len)
+{
+	const char	*nl;
+	size_t		n;
+
+	if (op->stop || len == 0)
+		return (0);
+	if (op->kind->lines == FUSE_BYTES)
+		return (op->kind->block(op, p, len));
+	if (op->carry.len > 0 && flush_carry(op, &p, &len) < 0)
+		return (-1);
+	if (op->carry.len > 0 || len == 0 || op->stop)
+		return (0);
+	nl = memrchr(p, '\n', len);
+	n = 0;
+	if (nl)
+		n = nl + 1 - p;
+	if (n > 0 && op->kind->block(op, p, n) < 0)
+		return (-1);
+	if (n < len && !op->stop)
+		buf_append(&op->carry, p + n, len - n);
+	return (-op->carry.failed);
+}
+
+/**
+ * @brief Ends the input of a fused operator
+ *
+ * The last line, if it has no newline, is handed over (with one added
+ * for records), then the builtin prints what it prints at end of input
+ * and its writer is flushed into the next operator.
+ *
+ * @param op Operator, ended after every operator before it
+ * @return Exit status of the builtin
+ */
+int	fuse_end(t_fuse_op *op)
+{
+	int	status;
+	int	done;
+
+	status = 0;
+	if (op->carry.len > 0 && !op->stop && op->kind->lines == FUSE_RECORDS)
+		buf_append(&op->carry, "\n", 1);
+	if (op->carry.len > 0 && !op->stop && !op->carry.failed)
+		status = op->kind->block(op, op->carry.data, op->carry.len);
+	if (op->carry.failed)
+		status = -1;
+	done = 0;
+	if (op->kind->finish)
+		done = op->kind->finish(op);
+	if (status == 0)
+		status = done;
+	if (status >= 0 && op->out && out_flush(op->out) < 0)
+		status = -1;
+	if (status < 0)
+		return (builtin_error(op->stage->argv[0], "write error"));
+	return (status);
+}
+
+/**
+ * @brief Releases the operators of a fused stage
+ *
+ * @param ops Operators
+ * @param count Number of operators
+ */
+void	fuse_free(t_fuse_op *ops, int count)
+{
+	int	k;
+
+	k = 0;
+	while (k < count)
+	{
+		free(ops[k].run);
+		free(ops[k].carry.data);
+		free(ops[k].scratch.data);
+		k++;
+	}
+	free(ops);
+}
@@ -0,0 +1,151 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fuse_run_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:54:29 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:05:46 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Chains one operator per stage and prepares their builtins
+ *
+ * @param ops Zeroed operators, one per stage
+ * @param stages First stage of the fused run
+ * @param count Number of stages
+ * @param out_fd Destination of the last operator
+ * @return 0 on success, -1 on allocation failure
+ */
+int	fuse_open(t_fuse_op *ops, t_stage *stages, int count, int out_fd)
+{
+	int	k;
+
+	k = 0;
+	while (k < count)
+	{
+		ops[k].stage = &stages[k];
+		ops[k].kind = fuse_kind(&stages[k]);
+		ops[k].out_fd = out_fd;
+		if (k + 1 < count)
+			ops[k].next = &ops[k + 1];
+		if (!ops[k].kind || (ops[k].kind->start
+				&& ops[k].kind->start(&ops[k]) < 0))
+			return (-1);
+		k++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Tells whether an operator has all the input it wants (head,
+ * grep -m), which makes the input upstream of it useless
+ *
+ * @param ops Operators
+ * @param count Number of operators
+ * @return 1 if reading can stop, 0 otherwise
+ */
+int	fuse_stopped(const t_fuse_op *ops, int count)
+{
+	int	k;
+
+	k = 0;
+	while (k < count)
+	{
+		if (ops[k].stop)
+			return (1);
+		k++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Reads the input and pushes every block through the chain
+ *
+ * @param ops Operators
+ * @param count Number of operators
+ * @param in_fd Source file descriptor
+ * @return 0 on success, -1 on error (reported)
+ */
+static int	fuse_read(t_fuse_op *ops, int count, int in_fd)
+{
+	char	*buf;
+	ssize_t	n;
+	int		status;
+
+	buf = malloc(FUSE_BUFSIZE);
+	if (!buf)
+		return (-builtin_error(ops->stage->argv[0], "malloc"));
+	status = 0;
+	n = 1;
+	while (status == 0 && n != 0 && !fuse_stopped(ops, count))
+	{
+		n = io_read(in_fd, buf, FUSE_BUFSIZE);
+		if (n < 0 && errno != EINTR)
+			status = -builtin_error(ops->stage->argv[0], "read error");
+		else if (n > 0 && fuse_push(ops, buf, n) < 0)
+			status = -builtin_error(ops[count - 1].stage->argv[0],
+					"write error");
+	}
+	free(buf);
+	return (status);
+}
+
+/**
+ * @brief Runs adjacent streaming builtins as a single loop
+ *
+ * Every block read is carried through all the stages by direct calls,
+ * each stage filling a buffer that the next one works on while it is
+ * still in cache; nothing goes through a pipe or a queue in between.
+ * As in a pipeline, the status is that of the last stage.
+ *
+ * @param stages First stage of the fused run
+ * @param count Number of stages
+ * @param in_fd Source file descriptor
+ * @param out_fd Destination file descriptor
+ * @return Exit status of the last stage
+ */
+int	fuse_run(t_stage *stages, int count, int in_fd, int out_fd)
+{
+	t_fuse_op	*ops;
+	int			failed;
+	int			status;
+	int			k;
+
+	ops = ft_calloc(count, sizeof(t_fuse_op));
+	if (!ops || fuse_open(ops, stages, count, out_fd) < 0)
+	{
+		if (ops)
+			fuse_free(ops, count);
+		return (builtin_error(stages->argv[0], "malloc"));
+	}
+	failed = fuse_read(ops, count, in_fd) < 0;
+	status = 0;
+	k = 0;
+	while (k < count)
+		status = fuse_end(&ops[k++]);
+	fuse_free(ops, count);
+	if (failed && status == 0)
+		return (1);
+	return (status);
+}
+
+/**
+ * @brief Runs a segment of a group: a single builtin, or a fused run
+ *
+ * @param stage First stage of the segment
+ * @param count Number of stages in the segment
+ * @param in_fd Source file descriptor
+ * @param out_fd Destination file descriptor
+ * @return Exit status of the last stage
+ */
+int	run_segment(t_stage *stage, int count, int in_fd, int out_fd)
+{
+	if (count == 1)
+		return (stage->builtin->run(stage, in_fd, out_fd));
+	return (fuse_run(stage, count, in_fd, out_fd));
+}
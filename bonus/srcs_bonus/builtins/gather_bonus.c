@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   gather_bonus.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:01:35 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:54:29 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Hands the gathered slices to the sink of a fused stage
+ *
+ * @param out Gathering writer with a sink
+ * @return 0 on success, -1 on error
+ */
+static int	gather_sink(t_gather *out)
+{
+	int	i;
+
+	i = 0;
+	while (i < out->n)
+	{
+		if (out->sink(out->ctx, out->iov[i].iov_base, out->iov[i].iov_len) < 0)
+			return (-1);
+		i++;
+	}
+	out->n = 0;
+	return (0);
+}
+
+/**
+ * @brief Writes out the gathered slices with writev(), resuming after
+ * short writes and EINTR
+ *
+ * @param out Gathering writer
+ * @return 0 on success, -1 on write error (errno is set)
+ */
+int	gather_flush(t_gather *out)
+{
+	ssize_t	n;
+	int		i;
+
+	if (out->sink)
+		return (gather_sink(out));
+	i = 0;
+	while (i < out->n)
+	{
+		n = io_writev(out->fd, out->iov + i, out->n - i);
+		if (n < 0 && errno != EINTR)
+			return (-1);
+		while (n > 0 && (size_t)n >= out->iov[i].iov_len)
+		{
+			n -= out->iov[i].iov_len;
+			i++;
+		}
+		if (n > 0)
+		{
+			out->iov[i].iov_base = (char *)out->iov[i].iov_base + n;
+			out->iov[i].iov_len -= n;
+		}
+	}
+	out->n = 0;
+	return (0);
+}
+
+/**
+ * @brief Queues a slice for the next writev() without copying it
+ *
+ * A slice that continues the previous one extends it, so unchanged runs
+ * of the input go out as one piece. The bytes must stay in place until
+ * the next gather_flush().
+ *
+ * @param out Gathering writer
+ * @param data Bytes to write
+ * @param len Number of bytes
+ * @return 0 on success, -1 on write error (errno is set)
+ */
+int	gather_add(t_gather *out, const char *data, size_t len)
+{
+	struct iovec	*last;
+
+	if (len == 0)
+		return (0);
+	if (out->n > 0)
+	{
+		last = out->iov + out->n - 1;
+		if ((const char *)last->iov_base + last->iov_len == data)
+		{
+			last->iov_len += len;
+			return (0);
+		}
+	}
+	if (out->n == GATHER_IOV && gather_flush(out) < 0)
+		return (-1);
+	out->iov[out->n].iov_base = (void *)data;
+	out->iov[out->n].iov_len = len;
+	out->n++;
+	return (0);
+}
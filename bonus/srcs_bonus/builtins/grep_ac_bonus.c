@@ -0,0 +1,178 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   grep_ac_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:50:49 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:50:49 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Adds one (already case folded) pattern to the trie
+ *
+ * State 0 is the root and is never a child, so 0 marks a missing edge.
+ *
+ * @param ac Automaton under construction
+ * @param pat Pattern to insert
+ */
+static void	ac_insert(t_ac *ac, const t_line *pat)
+{
+	int		*edge;
+	int		state;
+	size_t	i;
+
+	state = 0;
+	i = 0;
+	while (i < pat->len)
+	{
+		edge = &ac->delta[(size_t)state * ac->classes
+			+ ac->cls[(unsigned char)pat->data[i]]];
+		if (*edge == 0)
+			*edge = ac->states++;
+		state = *edge;
+		i++;
+	}
+	ac->accept[state] = 1;
+}
+
+/**
+ * @brief Gives every pattern byte an input class and allocates the tables
+ *
+ * Bytes that appear in no pattern share class 0, and case folded bytes
+ * share the class of their folded form, which keeps the transition table
+ * narrow. The table is sized for the worst case trie: one state per
+ * pattern byte, plus the root.
+ *
+ * @param grep Builtin grep state holding the patterns
+ * @return Maximum number of states, 0 on allocation failure
+ */
+static size_t	ac_trie(t_grep *grep)
+{
+	t_ac			*ac;
+	size_t			i;
+	unsigned char	c;
+
+	ac = &grep->ac;
+	ac->classes = 1;
+	i = 0;
+	while (i < grep->text.len)
+	{
+		c = grep->text.data[i++];
+		if (c != '\n' && !ac->cls[c])
+			ac->cls[c] = ac->classes++;
+	}
+	i = 0;
+	while (i < 256)
+	{
+		ac->cls[i] = ac->cls[grep->fold[i]];
+		i++;
+	}
+	ac->delta = ft_calloc((grep->text.len + 1) * ac->classes, sizeof(int));
+	ac->accept = ft_calloc(grep->text.len + 1, 1);
+	if (!ac->delta || !ac->accept)
+		return (0);
+	return (grep->text.len + 1);
+}
+
+/**
+ * @brief Completes the row of one state in breadth first order
+ *
+ * Missing edges take the transition of the failure state, so searching
+ * is one table lookup per byte. Children inherit the accepting flag of
+ * their failure state, so a pattern ending inside a longer one is seen.
+ *
+ * @param ac Automaton under construction
+ * @param fail Failure state of every state
+ * @param state State whose row is completed
+ * @param queue Receives the children of the state
+ * @return Number of children queued
+ */
+static int	ac_row(t_ac *ac, int *fail, int state, int *queue)
+{
+	int	*row;
+	int	*fallback;
+	int	c;
+	int	n;
+
+	row = ac->delta + (size_t)state * ac->classes;
+	fallback = ac->delta + (size_t)fail[state] * ac->classes;
+	n = 0;
+	c = -1;
+	while (++c < ac->classes)
+	{
+		if (row[c] == 0 && state != 0)
+			row[c] = fallback[c];
+		else if (row[c] != 0)
+		{
+			fail[row[c]] = 0;
+			if (state != 0)
+				fail[row[c]] = fallback[c];
+			ac->accept[row[c]] |= ac->accept[fail[row[c]]];
+			queue[n++] = row[c];
+		}
+	}
+	return (n);
+}
+
+/**
+ * @brief Builds the Aho-Corasick automaton for all the patterns
+ *
+ * @param grep Builtin grep state holding the patterns
+ * @return 0 on success, -1 on allocation failure
+ */
+int	ac_build(t_grep *grep)
+{
+	size_t	states;
+	int		*fail;
+	int		*queue;
+	int		head;
+	int		tail;
+
+	states = ac_trie(grep);
+	fail = NULL;
+	if (states > 0)
+		fail = ft_calloc(states * 2, sizeof(int));
+	if (!fail)
+		return (-1);
+	queue = fail + states;
+	grep->ac.states = 1;
+	head = -1;
+	while (++head < grep->count)
+		ac_insert(&grep->ac, &grep->patterns[head]);
+	tail = ac_row(&grep->ac, fail, 0, queue);
+	head = -1;
+	while (++head < tail)
+		tail += ac_row(&grep->ac, fail, queue[head], queue + tail);
+	free(fail);
+	return (0);
+}
+
+/**
+ * @brief Finds the first position where any pattern ends
+ *
+ * @param ac Automaton
+ * @param p Text to search
+ * @param len Length of the text
+ * @return Offset of the last byte of the first match, -1 if none
+ */
+long	ac_search(const t_ac *ac, const unsigned char *p, size_t len)
+{
+	size_t	i;
+	int		state;
+
+	state = 0;
+	i = 0;
+	while (i < len)
+	{
+		state = ac->delta[(size_t)state * ac->classes + ac->cls[p[i]]];
+		if (ac->accept[state])
+			return (i);
+		i++;
+	}
+	return (-1);
+}
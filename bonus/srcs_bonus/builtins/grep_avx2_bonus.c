@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   grep_avx2_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:50:49 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:50:49 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+
+# include <immintrin.h>
+
+/**
+ * @brief Returns the other case of a folded pattern byte under -i
+ *
+ * @param grep Builtin grep state
+ * @param c Folded pattern byte
+ * @return Upper case form of c with -i, c itself otherwise
+ */
+static char	other_case(const t_grep *grep, unsigned char c)
+{
+	if ((grep->flags & GREP_ICASE) && c >= 'a' && c <= 'z')
+		return (c - 'a' + 'A');
+	return (c);
+}
+
+/**
+ * @brief Broadcasts the first and last pattern bytes in both cases
+ *
+ * @param grep Builtin grep state
+ * @param ends Receives first byte, its other case, last byte, its other case
+ */
+__attribute__((target("avx2")))
+static void	set_ends(const t_grep *grep, __m256i *ends)
+{
+	const char	*pat;
+	size_t		last;
+
+	pat = grep->patterns[0].data;
+	last = grep->patterns[0].len - 1;
+	ends[0] = _mm256_set1_epi8(pat[0]);
+	ends[1] = _mm256_set1_epi8(other_case(grep, pat[0]));
+	ends[2] = _mm256_set1_epi8(pat[last]);
+	ends[3] = _mm256_set1_epi8(other_case(grep, pat[last]));
+}
+
+/**
+ * @brief Flags the positions of a 32 byte block where the pattern may start
+ *
+ * A position is a candidate when its byte equals the first pattern byte
+ * and the byte len - 1 further equals the last one (in either case).
+ *
+ * @param ends First byte, its other case, last byte, its other case
+ * @param p Start of the block
+ * @param len Pattern length
+ * @return One bit per candidate position
+ */
+__attribute__((target("avx2")))
+static unsigned int	candidates(const __m256i *ends, const unsigned char *p,
+		size_t len)
+{
+	__m256i	first;
+	__m256i	last;
+
+	first = _mm256_loadu_si256((const __m256i *)p);
+	last = _mm256_loadu_si256((const __m256i *)(p + len - 1));
+	first = _mm256_or_si256(_mm256_cmpeq_epi8(first, ends[0]),
+			_mm256_cmpeq_epi8(first, ends[1]));
+	last = _mm256_or_si256(_mm256_cmpeq_epi8(last, ends[2]),
+			_mm256_cmpeq_epi8(last, ends[3]));
+	return (_mm256_movemask_epi8(_mm256_and_si256(first, last)));
+}
+
+/**
+ * @brief Finds the single pattern 32 positions at a time (AVX2)
+ *
+ * The first/last byte filter rejects almost every position with two
+ * compares; the few candidates left are verified with memcmp(). The tail
+ * shorter than a block goes through the scalar search.
+ *
+ * @param grep Builtin grep state
+ * @param p Text to search
+ * @param len Length of the text
+ * @return Offset of the first match, -1 if none
+ */
+__attribute__((target("avx2,bmi")))
+long	grep_search_avx2(const t_grep *grep, const unsigned char *p,
+		size_t len)
+{
+	__m256i			ends[4];
+	size_t			i;
+	unsigned int	mask;
+	long			tail;
+
+	set_ends(grep, ends);
+	i = 0;
+	while (i + grep->patterns[0].len + 31 <= len)
+	{
+		mask = candidates(ends, p + i, grep->patterns[0].len);
+		while (mask)
+		{
+			if (grep_verify(grep, p + i + __builtin_ctz(mask)))
+				return (i + __builtin_ctz(mask));
+			mask &= mask - 1;
+		}
+		i += 32;
+	}
+	tail = grep_search_scalar(grep, p + i, len - i);
+	if (tail < 0)
+		return (-1);
+	return (i + tail);
+}
+
+#endif
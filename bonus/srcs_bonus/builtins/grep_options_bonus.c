@@ -0,0 +1,169 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   grep_options_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:50:49 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:50:49 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Applies one flag letter of a short option cluster
+ *
+ * @param grep Builtin grep state
+ * @param c Option letter
+ * @return 0 on success, -1 if the flag is not supported
+ */
+static int	grep_flag(t_grep *grep, char c)
+{
+	static const char	letters[] = "vFEiycG";
+	static const int	bits[] = {GREP_INVERT, GREP_FIXED, GREP_EXTENDED,
+		GREP_ICASE, GREP_ICASE, GREP_COUNT, GREP_BASIC};
+	char				*letter;
+
+	letter = ft_strchr(letters, c);
+	if (!letter || !c)
+		return (-1);
+	grep->flags |= bits[letter - letters];
+	return (0);
+}
+
+/**
+ * @brief Applies an option taking a value: -m NUM, -e PATTERN, -f FILE
+ *
+ * @param grep Builtin grep state
+ * @param opt Option letter ('m', 'e' or 'f')
+ * @param value Option value, NULL if it is missing
+ * @return 0 on success, -1 if the value is missing or not supported
+ */
+static int	grep_value(t_grep *grep, char opt, const char *value)
+{
+	size_t	len;
+
+	if (!value)
+		return (-1);
+	len = ft_strlen(value);
+	if (opt == 'e')
+		return (grep_add_text(grep, value, len));
+	if (opt == 'f')
+		return (grep_read_file(grep, value));
+	if (len == 0 || len > 18 || strspn(value, "0123456789") != len)
+		return (-1);
+	grep->max_count = strtol(value, NULL, 10);
+	return (0);
+}
+
+/**
+ * @brief Parses a long option ("--count", "--max-count=5", ...)
+ *
+ * @param grep Builtin grep state
+ * @param argv Stage argument vector
+ * @param i Index of the option, advanced past a separate value
+ * @return 0 on success, -1 if the option is not supported
+ */
+static int	grep_long(t_grep *grep, char **argv, int *i)
+{
+	static const char	*flags[] = {"--invert-match", "--fixed-strings",
+		"--extended-regexp", "--ignore-case", "--count", "--basic-regexp",
+		NULL};
+	static const char	*valued[] = {"--max-count", "--regexp", "--file",
+		NULL};
+	size_t				len;
+	int					k;
+
+	k = -1;
+	while (flags[++k])
+		if (ft_strncmp(argv[*i], flags[k], ft_strlen(flags[k]) + 1) == 0)
+			return (grep_flag(grep, "vFEicG"[k]));
+	k = -1;
+	while (valued[++k])
+	{
+		len = ft_strlen(valued[k]);
+		if (ft_strncmp(argv[*i], valued[k], len) == 0 && argv[*i][len] == '=')
+			return (grep_value(grep, "mef"[k], argv[*i] + len + 1));
+		if (ft_strncmp(argv[*i], valued[k], len + 1) == 0)
+		{
+			*i += 1;
+			return (grep_value(grep, "mef"[k], argv[*i]));
+		}
+	}
+	return (-1);
+}
+
+/**
+ * @brief Parses an option argument: a short cluster such as "-vc" or
+ * "-m5", or a long option
+ *
+ * @param grep Builtin grep state
+ * @param argv Stage argument vector
+ * @param i Index of the argument, advanced past a separate value
+ * @return 0 on success, -1 if an option is not supported
+ */
+static int	grep_option(t_grep *grep, char **argv, int *i)
+{
+	const char	*arg;
+	int			j;
+
+	arg = argv[*i];
+	if (arg[1] == '-')
+		return (grep_long(grep, argv, i));
+	j = 1;
+	while (arg[j])
+	{
+		if (ft_strchr("mef", arg[j]))
+		{
+			if (arg[j + 1])
+				return (grep_value(grep, arg[j], arg + j + 1));
+			*i += 1;
+			return (grep_value(grep, arg[j], argv[*i]));
+		}
+		if (grep_flag(grep, arg[j]) < 0)
+			return (-1);
+		j++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Parses a grep argv the builtin can run
+ *
+ * Options may follow the pattern, as with GNU getopt. The pattern comes
+ * from -e/-f or else from the first operand; any other operand is a file,
+ * which the builtin leaves to the real grep.
+ *
+ * @param argv Stage argument vector, argv[0] being "grep"
+ * @param grep Builtin grep state to fill in
+ * @return 0 on success, -1 for anything unsupported
+ */
+int	parse_grep_argv(char **argv, t_grep *grep)
+{
+	const char	*operand;
+	int			i;
+	int			options;
+
+	operand = NULL;
+	options = 1;
+	i = 0;
+	while (argv[++i])
+	{
+		if (options && ft_strncmp(argv[i], "--", 3) == 0)
+			options = 0;
+		else if (options && argv[i][0] == '-' && argv[i][1])
+		{
+			if (grep_option(grep, argv, &i) < 0)
+				return (-1);
+		}
+		else if (operand)
+			return (-1);
+		else
+			operand = argv[i];
+	}
+	if (grep->sources == 0 && operand)
+		return (grep_add_text(grep, operand, ft_strlen(operand)));
+	return (-(grep->sources == 0 || operand != NULL));
+}
@@ -0,0 +1,172 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   grep_patterns_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:50:49 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:50:49 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Adds the patterns of a -e value or of the pattern operand
+ *
+ * Like grep, a newline inside the text separates patterns.
+ *
+ * @param grep Builtin grep state
+ * @param text Pattern text
+ * @param len Length of the text
+ * @return 0 on success, -1 on allocation failure
+ */
+int	grep_add_text(t_grep *grep, const char *text, size_t len)
+{
+	buf_append(&grep->text, text, len);
+	buf_append(&grep->text, "\n", 1);
+	grep->sources++;
+	return (-(grep->text.failed != 0));
+}
+
+/**
+ * @brief Adds the patterns of a -f file, one per line
+ *
+ * The file is read when the stage is bound, so a missing or unreadable
+ * file leaves the stage to the real grep and its diagnostics.
+ *
+ * @param grep Builtin grep state
+ * @param path Pattern file ("-" is not supported)
+ * @return 0 on success, -1 on error
+ */
+int	grep_read_file(t_grep *grep, const char *path)
+{
+	char	chunk[IO_CHUNK];
+	size_t	start;
+	ssize_t	n;
+	int		fd;
+
+	if (ft_strncmp(path, "-", 2) == 0)
+		return (-1);
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return (-1);
+	start = grep->text.len;
+	n = read(fd, chunk, IO_CHUNK);
+	while (n > 0 || (n < 0 && errno == EINTR))
+	{
+		if (n > 0)
+			buf_append(&grep->text, chunk, n);
+		n = read(fd, chunk, IO_CHUNK);
+	}
+	close(fd);
+	if (grep->text.len > start && grep->text.data[grep->text.len - 1] != '\n')
+		buf_append(&grep->text, "\n", 1);
+	grep->sources++;
+	return (-(n < 0 || grep->text.failed != 0));
+}
+
+/**
+ * @brief Tells whether a pattern means the same as a fixed string
+ *
+ * Without -F, a pattern free of regular expression operators is still
+ * a literal. In a UTF-8 locale only ASCII patterns are taken, so that a
+ * byte match is always a character match.
+ *
+ * @param grep Builtin grep state
+ * @param pat Pattern
+ * @return 1 if the builtin can match it as a fixed string, 0 otherwise
+ */
+static int	is_literal(t_grep *grep, const t_line *pat)
+{
+	const char	*special;
+	size_t		i;
+
+	special = NULL;
+	if (grep->flags & GREP_EXTENDED)
+		special = "\\.[]()*+?{}|^$";
+	else if (!(grep->flags & GREP_FIXED))
+		special = "\\.[*^$";
+	i = 0;
+	while (i < pat->len)
+	{
+		if (special && pat->data[i] && ft_strchr(special, pat->data[i]))
+			return (0);
+		if (grep->utf8 && (unsigned char)pat->data[i] >= 0x80)
+			return (0);
+		i++;
+	}
+	return (1);
+}
+
+/**
+ * @brief Splits the pattern text into patterns and case folds them
+ *
+ * @param grep Builtin grep state
+ * @return 0 on success, -1 on allocation failure or a non literal pattern
+ */
+static int	split_patterns(t_grep *grep)
+{
+	char	*p;
+	char	*nl;
+	size_t	i;
+
+	grep->count = 0;
+	p = grep->text.data;
+	while (p && p < grep->text.data + grep->text.len)
+	{
+		nl = memchr(p, '\n', grep->text.data + grep->text.len - p);
+		grep->patterns[grep->count].data = p;
+		grep->patterns[grep->count].len = nl - p;
+		if (!is_literal(grep, &grep->patterns[grep->count]))
+			return (-1);
+		if (nl == p)
+			grep->any_empty = 1;
+		i = 0;
+		while (p + i < nl)
+		{
+			p[i] = grep->fold[(unsigned char)p[i]];
+			i++;
+		}
+		grep->count++;
+		p = nl + 1;
+	}
+	return (0);
+}
+
+/**
+ * @brief Turns the collected pattern text into a matcher
+ *
+ * One pattern is searched with the vector first/last byte filter,
+ * several go through an Aho-Corasick automaton. An empty pattern matches
+ * every line, so it needs no matcher at all. Under -i, patterns and input
+ * are compared through an ASCII lower casing table.
+ *
+ * @param grep Builtin grep state
+ * @return 0 on success, -1 if the patterns are not supported
+ */
+int	grep_compile(t_grep *grep)
+{
+	size_t	count;
+	size_t	i;
+
+	i = 0;
+	while (i < 256)
+	{
+		grep->fold[i] = i;
+		if ((grep->flags & GREP_ICASE) && i >= 'A' && i <= 'Z')
+			grep->fold[i] = i - 'A' + 'a';
+		i++;
+	}
+	count = 0;
+	i = 0;
+	while (i < grep->text.len)
+		count += (grep->text.data[i++] == '\n');
+	grep->patterns = malloc(sizeof(t_line) * (count + 1));
+	if (!grep->patterns || split_patterns(grep) < 0)
+		return (-1);
+	if (grep->count > 1 && !grep->any_empty)
+		return (ac_build(grep));
+	return (0);
+}
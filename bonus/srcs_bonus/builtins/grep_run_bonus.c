@@ -0,0 +1,168 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   grep_run_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:50:49 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:50:49 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Counts or prints one selected line
+ *
+ * Like GNU grep, a line that is not valid UTF-8 in a UTF-8 locale is
+ * counted but not printed, and in binary input the first selected line
+ * ends the search; either way a notice is printed at the end.
+ *
+ * @param run Search in progress
+ * @param line Start of the line
+ * @param len Length of the line, without its newline
+ * @return 0 on success, -1 on write error
+ */
+static int	select_line(t_grep_run *run, const char *line, size_t len)
+{
+	run->selected++;
+	if (run->selected == run->grep->max_count)
+		run->stop = 1;
+	if (run->grep->flags & GREP_COUNT)
+		return (0);
+	if (run->binary)
+		run->stop = 1;
+	if (run->binary || (run->grep->utf8 && !utf8_valid(line, len)))
+	{
+		run->notice = 1;
+		return (0);
+	}
+	if (out_write(&run->out, line, len) < 0
+		|| out_write(&run->out, "\n", 1) < 0)
+		return (-1);
+	return (0);
+}
+
+/**
+ * @brief Selects a whole block at once when no line needs a check
+ *
+ * Possible without -m and, unless counting, for text input: the block
+ * is counted with the wc newline kernel or written in one piece.
+ *
+ * @param run Search in progress
+ * @param p Start of the block
+ * @param len Length of the block (not 0)
+ * @return 1 if the block was handled, 0 if it must go line by line, -1 on
+ * write error
+ */
+static int	select_bulk(t_grep_run *run, const char *p, size_t len)
+{
+	t_wc	wc;
+
+	if (run->grep->max_count >= 0 || (!(run->grep->flags & GREP_COUNT)
+			&& (run->binary || (run->grep->utf8 && !utf8_valid(p, len)))))
+		return (0);
+	ft_memset(&wc, 0, sizeof(t_wc));
+	wc_scan(&wc, (const unsigned char *)p, len, WC_LINES);
+	run->selected += wc.lines + (p[len - 1] != '\n');
+	if (run->grep->flags & GREP_COUNT)
+		return (1);
+	if (out_write(&run->out, p, len) < 0
+		|| (p[len - 1] != '\n' && out_write(&run->out, "\n", 1) < 0))
+		return (-1);
+	return (1);
+}
+
+/**
+ * @brief Selects every line of a block (the non matching lines under -v)
+ *
+ * @param run Search in progress
+ * @param p Start of the block
+ * @param len Length of the block; only its last line may lack a newline
+ * @return 0 on success, -1 on write error
+ */
+static int	select_lines(t_grep_run *run, const char *p, size_t len)
+{
+	const char	*nl;
+	int			bulk;
+
+	if (len == 0)
+		return (0);
+	bulk = select_bulk(run, p, len);
+	if (bulk != 0)
+		return (-(bulk < 0));
+	while (len > 0 && !run->stop)
+	{
+		nl = memchr(p, '\n', len);
+		if (!nl)
+			nl = p + len;
+		if (select_line(run, p, nl - p) < 0)
+			return (-1);
+		len -= nl - p + (nl < p + len);
+		p = nl + 1;
+	}
+	return (0);
+}
+
+/**
+ * @brief Finds the bounds of the line holding a match
+ *
+ * @param p Start of the text searched
+ * @param pos Offset of a byte of the match
+ * @param len Length of the text
+ * @param line Receives the line, without its newline
+ */
+static void	match_line(const char *p, long pos, size_t len, t_line *line)
+{
+	const char	*end;
+
+	line->data = memrchr(p, '\n', pos);
+	if (line->data)
+		line->data++;
+	else
+		line->data = (char *)p;
+	end = memchr(p + pos, '\n', len - pos);
+	if (!end)
+		end = p + len;
+	line->len = end - line->data;
+}
+
+/**
+ * @brief Runs the search over a block of whole lines
+ *
+ * The matcher scans the block as a whole rather than line by line; only
+ * the line around each match is delimited. Under -v, the lines between
+ * two matching lines are selected in one piece.
+ *
+ * @param run Search in progress
+ * @param p Start of the block
+ * @param len Length of the block; only its last line may lack a newline
+ * @return 0 on success, -1 on write error
+ */
+int	grep_block(t_grep_run *run, const char *p, size_t len)
+{
+	t_line	line;
+	size_t	cur;
+	long	pos;
+	int		status;
+
+	cur = 0;
+	status = 0;
+	while (cur < len && !run->stop && status == 0)
+	{
+		pos = grep_search(run->grep, (const unsigned char *)p + cur,
+				len - cur);
+		if (pos < 0 && (run->grep->flags & GREP_INVERT))
+			return (select_lines(run, p + cur, len - cur));
+		if (pos < 0)
+			return (0);
+		match_line(p + cur, pos, len - cur, &line);
+		if (run->grep->flags & GREP_INVERT)
+			status = select_lines(run, p + cur, line.data - (p + cur));
+		else
+			status = select_line(run, line.data, line.len);
+		cur = line.data + line.len + 1 - p;
+	}
+	return (status);
+}
@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   grep_search_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:50:49 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:50:49 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Checks a candidate position against the single pattern
+ *
+ * @param grep Builtin grep state
+ * @param p Candidate position, with at least the pattern length available
+ * @return 1 if the pattern occurs at p, 0 otherwise
+ */
+int	grep_verify(const t_grep *grep, const unsigned char *p)
+{
+	const unsigned char	*pat;
+	size_t				i;
+
+	pat = (const unsigned char *)grep->patterns[0].data;
+	if (!(grep->flags & GREP_ICASE))
+		return (memcmp(p, pat, grep->patterns[0].len) == 0);
+	i = 0;
+	while (i < grep->patterns[0].len)
+	{
+		if (grep->fold[p[i]] != pat[i])
+			return (0);
+		i++;
+	}
+	return (1);
+}
+
+/**
+ * @brief Finds the single pattern without vector instructions
+ *
+ * Case sensitive searches go through memmem(); -i compares folded bytes.
+ *
+ * @param grep Builtin grep state
+ * @param p Text to search
+ * @param len Length of the text
+ * @return Offset of the first match, -1 if none
+ */
+long	grep_search_scalar(const t_grep *grep, const unsigned char *p,
+		size_t len)
+{
+	const unsigned char	*hit;
+	size_t				k;
+	size_t				i;
+
+	k = grep->patterns[0].len;
+	if (!(grep->flags & GREP_ICASE))
+	{
+		hit = memmem(p, len, grep->patterns[0].data, k);
+		if (!hit)
+			return (-1);
+		return (hit - p);
+	}
+	i = 0;
+	while (i + k <= len)
+	{
+		if (grep_verify(grep, p + i))
+			return (i);
+		i++;
+	}
+	return (-1);
+}
+
+/**
+ * @brief Finds the first position of a line selected by the patterns
+ *
+ * @param grep Builtin grep state
+ * @param p Text to search (whole lines)
+ * @param len Length of the text
+ * @return Offset of a byte of the first match, -1 if none
+ */
+long	grep_search(const t_grep *grep, const unsigned char *p, size_t len)
+{
+	int	level;
+
+	if (grep->any_empty)
+		return (0);
+	if (grep->count == 0)
+		return (-1);
+	if (grep->count > 1)
+		return (ac_search(&grep->ac, p, len));
+	level = simd_level();
+	if (level == 2)
+		return (grep_search_avx2(grep, p, len));
+	return (grep_search_scalar(grep, p, len));
+}
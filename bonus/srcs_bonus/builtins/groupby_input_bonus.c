@@ -0,0 +1,107 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   groupby_input_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:23:02 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:33:21 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Splits a batch of whole lines into one range per worker and
+ * starts every worker but the first on its own thread
+ *
+ * @param parts Workers
+ * @param count Number of workers used for this batch
+ * @param p Batch, ending with a newline
+ * @param len Length of the batch
+ */
+static void	group_split(t_group_part *parts, int count, const char *p,
+	size_t len)
+{
+	const char	*bounds[BATCH_MAX_THREADS + 1];
+	int			k;
+
+	batch_bounds(p, len, count, bounds);
+	k = 0;
+	while (k < count)
+	{
+		parts[k].p = bounds[k];
+		parts[k].end = bounds[k + 1];
+		parts[k].started = (k > 0 && pthread_create(&parts[k].thread, NULL,
+					group_worker, &parts[k]) == 0);
+		k++;
+	}
+}
+
+/**
+ * @brief Groups a batch in parallel, the calling thread taking the first
+ * range; batches under GROUP_MIN_SPLIT bytes per worker use fewer workers
+ *
+ * @param parts Workers
+ * @param count Number of workers
+ * @param p Batch, ending with a newline
+ * @param len Length of the batch
+ */
+static void	group_batch(t_group_part *parts, int count, const char *p,
+	size_t len)
+{
+	int	k;
+
+	if ((size_t)count > len / GROUP_MIN_SPLIT + 1)
+		count = len / GROUP_MIN_SPLIT + 1;
+	group_split(parts, count, p, len);
+	group_worker(&parts[0]);
+	k = 1;
+	while (k < count)
+	{
+		if (parts[k].started)
+			pthread_join(parts[k].thread, NULL);
+		else
+			group_worker(&parts[k]);
+		k++;
+	}
+}
+
+/**
+ * @brief Reads the input in batches of whole lines and groups each one
+ *
+ * A last line without a newline gets one.
+ *
+ * @param parts Workers
+ * @param count Number of workers
+ * @param fd Input file descriptor
+ * @return 0 on success, -1 on read failure
+ */
+int	group_input(t_group_part *parts, int count, int fd)
+{
+	t_reader	r;
+	const char	*nl;
+	size_t		len;
+	int			status;
+
+	ft_memset(&r, 0, sizeof(t_reader));
+	r.fd = fd;
+	status = reader_batch(&r, GROUP_BATCH);
+	while (status == 0 && !(r.eof && r.start == r.end))
+	{
+		nl = memrchr(r.buf + r.start, '\n', r.end - r.start);
+		if (!nl && (!r.eof || r.end == r.cap))
+			status = reader_batch(&r, GROUP_BATCH);
+		else if (!nl)
+			r.buf[r.end++] = '\n';
+		else
+		{
+			len = nl + 1 - (r.buf + r.start);
+			group_batch(parts, count, r.buf + r.start, len);
+			r.start += len;
+		}
+	}
+	free(r.buf);
+	return (status);
+}
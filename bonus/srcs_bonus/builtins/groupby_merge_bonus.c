@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   groupby_merge_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:23:02 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:23:02 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Makes room for the accumulator of entry idx
+ *
+ * @param part Worker
+ * @param idx Entry index
+ * @return 0 on success, -1 on allocation failure
+ */
+int	group_reserve(t_group_part *part, long idx)
+{
+	t_group_acc	*acc;
+	size_t		cap;
+
+	if ((size_t)idx < part->cap)
+		return (0);
+	cap = part->cap * 2;
+	if (cap < 1024)
+		cap = 1024;
+	acc = malloc(cap * sizeof(t_group_acc));
+	if (!acc)
+		return (-1);
+	if (part->acc)
+		ft_memcpy(acc, part->acc, part->cap * sizeof(t_group_acc));
+	free(part->acc);
+	part->acc = acc;
+	part->cap = cap;
+	return (0);
+}
+
+/**
+ * @brief Converts a field to a number the way awk does
+ *
+ * The field is copied out first so that strtod cannot read on into the
+ * next one when the -t delimiter could be part of a number.
+ *
+ * @param p Start of the field
+ * @param len Length of the field
+ * @return Value of the field, 0 when it is not numeric
+ */
+double	group_number(const char *p, size_t len)
+{
+	char	buf[64];
+	char	*copy;
+	double	v;
+
+	if (len < sizeof(buf))
+	{
+		ft_memcpy(buf, p, len);
+		buf[len] = '\0';
+		return (awk_tonum(buf, len));
+	}
+	copy = malloc(len + 1);
+	if (!copy)
+		return (0);
+	ft_memcpy(copy, p, len);
+	copy[len] = '\0';
+	v = awk_tonum(copy, len);
+	free(copy);
+	return (v);
+}
+
+/**
+ * @brief Adds entry j of one worker's table to another's
+ *
+ * @param into Table the groups are merged into
+ * @param from Table of another worker
+ * @param j Entry of from
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	group_fold(t_group_part *into, t_group_part *from, size_t j)
+{
+	const t_dist_entry	*e;
+	t_group_acc			*acc;
+	long				idx;
+
+	e = &from->table.entries[j];
+	idx = dist_add(&into->table, from->table.arena.data + e->off, e->len,
+			e->count);
+	if (idx < 0 || !(into->group->flags & GROUP_VALUES))
+		return (-(idx < 0));
+	if (group_reserve(into, idx) < 0)
+		return (-1);
+	acc = &into->acc[idx];
+	if (into->table.entries[idx].count == e->count)
+		*acc = from->acc[j];
+	else
+	{
+		acc->sum += from->acc[j].sum;
+		if (from->acc[j].min < acc->min)
+			acc->min = from->acc[j].min;
+		if (from->acc[j].max > acc->max)
+			acc->max = from->acc[j].max;
+	}
+	return (0);
+}
+
+/**
+ * @brief Merges the tables of all workers into the first one
+ *
+ * @param parts Workers
+ * @param count Number of workers
+ * @return 0 on success, -3 on allocation failure
+ */
+int	group_merge(t_group_part *parts, int count)
+{
+	size_t	j;
+	int		k;
+
+	k = 0;
+	while (k < count)
+		if (parts[k++].failed)
+			return (-3);
+	k = 1;
+	while (k < count)
+	{
+		j = 0;
+		while (j < parts[k].table.n)
+			if (group_fold(parts, &parts[k], j++) < 0)
+				return (-3);
+		k++;
+	}
+	return (0);
+}
@@ -0,0 +1,161 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   groupby_output_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:23:02 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:23:02 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Value of aggregate k of group j
+ *
+ * @param part Merged worker
+ * @param j Entry of the group
+ * @param k Aggregate index
+ * @return Value of the aggregate
+ */
+static double	group_agg(const t_group_part *part, size_t j, int k)
+{
+	if (part->group->aggs[k] == GROUP_SUM)
+		return (part->acc[j].sum);
+	if (part->group->aggs[k] == GROUP_MIN)
+		return (part->acc[j].min);
+	if (part->group->aggs[k] == GROUP_MAX)
+		return (part->acc[j].max);
+	return (part->table.entries[j].count);
+}
+
+/**
+ * @brief Compares the keys of two entries bytewise, a prefix first
+ *
+ * @param table Merged table
+ * @param a First entry index
+ * @param b Second entry index
+ * @return Negative, zero or positive as key a sorts before, with or after b
+ */
+static int	group_keycmp(const t_distinct *table, size_t a, size_t b)
+{
+	const t_dist_entry	*x;
+	const t_dist_entry	*y;
+	size_t				n;
+	int					c;
+
+	x = &table->entries[a];
+	y = &table->entries[b];
+	n = x->len;
+	if (y->len < n)
+		n = y->len;
+	c = 0;
+	if (n)
+		c = ft_memcmp(table->arena.data + x->off, table->arena.data + y->off,
+				n);
+	if (c)
+		return (c);
+	return ((x->len > y->len) - (x->len < y->len));
+}
+
+/**
+ * @brief qsort_r comparator: by key, or with -r by the first aggregate
+ * from the largest down and then by key
+ *
+ * @param a First entry index
+ * @param b Second entry index
+ * @param arg Merged worker
+ * @return Negative, zero or positive as a sorts before, with or after b
+ */
+static int	group_cmp(const void *a, const void *b, void *arg)
+{
+	const t_group_part	*part;
+	double				d;
+
+	part = arg;
+	if (part->group->flags & GROUP_RANK)
+	{
+		d = group_agg(part, *(const size_t *)b, 0)
+			- group_agg(part, *(const size_t *)a, 0);
+		if (d != 0)
+			return ((d > 0) - (d < 0));
+	}
+	return (group_keycmp(&part->table, *(const size_t *)a,
+			*(const size_t *)b));
+}
+
+/**
+ * @brief Writes one group: its key then each aggregate, separated by the
+ * -t delimiter or a space
+ *
+ * @param part Merged worker
+ * @param j Entry of the group
+ * @param out Output buffer
+ * @return 0 on success, -1 on write failure
+ */
+static int	group_row(const t_group_part *part, size_t j, t_out *out)
+{
+	char	buf[40];
+	int		len;
+	int		k;
+	int		err;
+
+	buf[0] = ' ';
+	if (part->group->flags & GROUP_DELIM)
+		buf[0] = part->group->delim;
+	err = out_write(out, part->table.arena.data + part->table.entries[j].off,
+			part->table.entries[j].len);
+	k = 0;
+	while (!err && k < part->group->naggs)
+	{
+		if (part->group->aggs[k] == GROUP_COUNT)
+			len = snprintf(buf + 1, sizeof(buf) - 1, "%ld",
+					part->table.entries[j].count);
+		else
+			len = snprintf(buf + 1, sizeof(buf) - 1, "%.15g",
+					group_agg(part, j, k));
+		err = out_write(out, buf, len + 1);
+		k++;
+	}
+	if (!err)
+		err = out_write(out, "\n", 1);
+	return (err);
+}
+
+/**
+ * @brief Writes the merged groups, in order of first appearance unless
+ * -s or -r asked for a sort
+ *
+ * @param part Merged worker
+ * @param out_fd Output file descriptor
+ * @return 0 on success, -2 on write failure, -3 on allocation failure
+ */
+int	group_emit(t_group_part *part, int out_fd)
+{
+	t_out	out;
+	size_t	*order;
+	size_t	j;
+	int		err;
+
+	order = malloc((part->table.n + 1) * sizeof(size_t));
+	if (!order)
+		return (-3);
+	j = 0;
+	while (j < part->table.n)
+	{
+		order[j] = j;
+		j++;
+	}
+	if (part->group->flags & (GROUP_SORT | GROUP_RANK))
+		qsort_r(order, part->table.n, sizeof(size_t), group_cmp, part);
+	out_init(&out, out_fd);
+	err = 0;
+	j = 0;
+	while (!err && j < part->table.n)
+		err = group_row(part, order[j++], &out);
+	free(order);
+	if (err || out_flush(&out) < 0)
+		return (-2);
+	return (0);
+}
@@ -0,0 +1,163 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   groupby_parse_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:23:02 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:33:21 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Parses a field number or thread count
+ *
+ * @param s Decimal number
+ * @param n Receives the number
+ * @param min Smallest accepted value
+ * @param max Largest accepted value, at most 1000000
+ * @return 0 on success, -1 if s is not a number in range
+ */
+static int	group_count(const char *s, int *n, int min, int max)
+{
+	long	v;
+
+	v = 0;
+	if (!*s)
+		return (-1);
+	while (*s >= '0' && *s <= '9' && v <= 1000000)
+		v = v * 10 + *s++ - '0';
+	if (*s || v < min || v > max)
+		return (-1);
+	*n = v;
+	return (0);
+}
+
+/**
+ * @brief Parses a comma separated list of aggregates
+ *
+ * @param list Names among count, sum, min and max
+ * @param group Group stage receiving the aggregates
+ * @return 0 on success, -1 on an unknown name or too many of them
+ */
+static int	group_aggs(const char *list, t_group *group)
+{
+	static const char	*names[] = {"count", "sum", "min", "max", NULL};
+	size_t				len;
+	int					k;
+
+	group->naggs = 0;
+	while (*list && group->naggs < GROUP_MAX_AGGS)
+	{
+		len = 0;
+		while (list[len] && list[len] != ',')
+			len++;
+		k = 0;
+		while (names[k] && !(ft_strlen(names[k]) == len
+				&& ft_strncmp(names[k], list, len) == 0))
+			k++;
+		if (!names[k])
+			return (-1);
+		if (k != GROUP_COUNT)
+			group->flags |= GROUP_VALUES;
+		group->aggs[group->naggs++] = k;
+		list += len + (list[len] == ',');
+	}
+	return (-(*list != '\0' || group->naggs == 0));
+}
+
+/**
+ * @brief Applies one option taking an argument
+ *
+ * "\t" is accepted for a tab delimiter; a newline cannot be one.
+ *
+ * @param group Group stage
+ * @param c Option letter
+ * @param arg Its argument
+ * @return 0 on success, -1 on an unknown option or a bad argument
+ */
+static int	group_option(t_group *group, char c, const char *arg)
+{
+	if (c == 'k')
+		return (group_count(arg, &group->key, 0, 1000000));
+	if (c == 'v')
+		return (group_count(arg, &group->value, 1, 1000000));
+	if (c == 'j')
+		return (group_count(arg, &group->threads, 1,
+				BATCH_MAX_THREADS));
+	if (c == 'a')
+		return (group_aggs(arg, group));
+	if (c != 't')
+		return (-1);
+	group->flags |= GROUP_DELIM;
+	group->delim = arg[0];
+	if (ft_strncmp(arg, "\\t", 3) == 0)
+		group->delim = '\t';
+	else if (!arg[0] || arg[1] || arg[0] == '\n')
+		return (-1);
+	return (0);
+}
+
+/**
+ * @brief Sets the defaults: key field 1, a count and one thread per
+ * online CPU up to GROUP_MAX_THREADS
+ *
+ * @param group Group stage
+ */
+static void	group_defaults(t_group *group)
+{
+	long	cpus;
+
+	ft_memset(group, 0, sizeof(t_group));
+	group->key = 1;
+	group->aggs[0] = GROUP_COUNT;
+	group->naggs = 1;
+	cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	group->threads = GROUP_MAX_THREADS;
+	if (cpus < GROUP_MAX_THREADS)
+		group->threads = cpus;
+	if (group->threads < 1)
+		group->threads = 1;
+}
+
+/**
+ * @brief Parses @groupby [-t C] [-k N] [-v M] [-a AGGS] [-s | -r] [-j N]
+ *
+ * -k 0 groups by the whole line; -v names the field summed, or compared
+ * for min and max, and is required by those aggregates. -s sorts the
+ * groups by key, -r by their first aggregate from the largest down.
+ *
+ * @param argv Stage arguments
+ * @param group Receives the parsed stage
+ * @return 0 on success, -1 on a usage error
+ */
+int	parse_groupby(char **argv, t_group *group)
+{
+	int	i;
+	int	err;
+
+	group_defaults(group);
+	err = 0;
+	i = 1;
+	while (!err && argv[i])
+	{
+		if (ft_strncmp(argv[i], "-s", 3) == 0)
+			group->flags |= GROUP_SORT;
+		else if (ft_strncmp(argv[i], "-r", 3) == 0)
+			group->flags |= GROUP_RANK;
+		else if (argv[i][0] != '-' || !argv[i][1])
+			err = -1;
+		else if (argv[i][2])
+			err = group_option(group, argv[i][1], argv[i] + 2);
+		else if (argv[++i])
+			err = group_option(group, argv[i - 1][1], argv[i]);
+		else
+			err = -1;
+		i++;
+	}
+	if ((group->flags & GROUP_VALUES) && group->value == 0)
+		err = -1;
+	return (err - ((group->flags & GROUP_SORT) && (group->flags & GROUP_RANK)));
+}
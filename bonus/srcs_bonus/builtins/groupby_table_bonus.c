@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   groupby_table_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:23:02 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:23:02 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Finds field n of a line split on the -t delimiter
+ *
+ * @param part Worker, whose eol is the newline ending the line
+ * @param p Start of the line
+ * @param n Field number, at least 1
+ * @param len Receives the length of the field
+ * @return Start of the field, or NULL if the line has fewer fields
+ */
+static const char	*group_cut(t_group_part *part, const char *p, int n,
+	size_t *len)
+{
+	const char	*q;
+
+	while (n-- > 1)
+	{
+		p = memchr(p, part->group->delim, part->eol - p);
+		if (!p)
+			return (NULL);
+		p++;
+	}
+	q = memchr(p, part->group->delim, part->eol - p);
+	if (!q)
+		q = part->eol;
+	*len = q - p;
+	return (p);
+}
+
+/**
+ * @brief Finds field n of a line; 0 is the whole line and a field past
+ * the last one is empty
+ *
+ * Without -t fields are split on runs of blanks like the default awk FS.
+ *
+ * @param part Worker, whose eol is the newline ending the line
+ * @param line Start of the line
+ * @param n Field number
+ * @param len Receives the length of the field
+ * @return Start of the field
+ */
+static const char	*group_field(t_group_part *part, const char *line, int n,
+	size_t *len)
+{
+	const char	*field;
+
+	*len = part->eol - line;
+	if (n == 0)
+		return (line);
+	if (part->group->flags & GROUP_DELIM)
+		field = group_cut(part, line, n, len);
+	else
+		field = awk_field(line, part->end, n, len);
+	if (field)
+		return (field);
+	*len = 0;
+	return (line);
+}
+
+/**
+ * @brief Folds the value field of a line into the accumulator of its group
+ *
+ * @param part Worker
+ * @param idx Entry of the group, just counted
+ * @param line Start of the line
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	group_value(t_group_part *part, long idx, const char *line)
+{
+	t_group_acc	*acc;
+	const char	*field;
+	size_t		len;
+	double		v;
+
+	if (group_reserve(part, idx) < 0)
+		return (-1);
+	field = group_field(part, line, part->group->value, &len);
+	v = group_number(field, len);
+	acc = &part->acc[idx];
+	if (part->table.entries[idx].count == 1)
+	{
+		acc->sum = 0;
+		acc->min = v;
+		acc->max = v;
+	}
+	acc->sum += v;
+	if (v < acc->min)
+		acc->min = v;
+	if (v > acc->max)
+		acc->max = v;
+	return (0);
+}
+
+/**
+ * @brief Groups the lines of the worker's range into its own table
+ *
+ * @param part Worker; failed is set on allocation failure
+ */
+static void	group_range(t_group_part *part)
+{
+	const char	*p;
+	const char	*key;
+	size_t		len;
+	long		idx;
+
+	p = part->p;
+	while (!part->failed && p < part->end)
+	{
+		part->eol = memchr(p, '\n', part->end - p);
+		key = group_field(part, p, part->group->key, &len);
+		idx = dist_add(&part->table, key, len, 1);
+		if (idx < 0 || ((part->group->flags & GROUP_VALUES)
+				&& group_value(part, idx, p) < 0))
+			part->failed = 1;
+		p = part->eol + 1;
+	}
+}
+
+/**
+ * @brief Thread entry point grouping one range
+ *
+ * @param arg Worker
+ * @return NULL
+ */
+void	*group_worker(void *arg)
+{
+	group_range(arg);
+	return (NULL);
+}
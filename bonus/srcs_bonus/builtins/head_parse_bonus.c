@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   head_parse_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:03:46 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 13:03:46 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Parses a plain decimal head count
+ *
+ * Suffixes (K, MB...) and negative counts ("all but the last N") are left
+ * to the real head.
+ *
+ * @param value Count as written on the command line
+ * @param head Receives the count
+ * @param bytes 1 for -c, 0 for -n
+ * @return 0 on success, -1 if the count is not supported
+ */
+static int	head_count(const char *value, t_head *head, int bytes)
+{
+	long	n;
+	int		i;
+
+	if (!value || !value[0])
+		return (-1);
+	n = 0;
+	i = 0;
+	while (value[i])
+	{
+		if (!ft_isdigit(value[i]) || n > (LONG_MAX - 9) / 10)
+			return (-1);
+		n = n * 10 + (value[i] - '0');
+		i++;
+	}
+	head->count = n;
+	head->bytes = bytes;
+	return (0);
+}
+
+/**
+ * @brief Parses one head option ("-n N", "-cN", "--lines=N", "--bytes N")
+ *
+ * @param argv Stage argument vector
+ * @param i Index of the option
+ * @param head Receives the count and the mode
+ * @return Number of arguments consumed, or -1 if not supported
+ */
+static int	head_option(char **argv, int i, t_head *head)
+{
+	const char	*value;
+	int			bytes;
+	int			end;
+
+	bytes = (ft_strncmp(argv[i], "--bytes", 7) == 0);
+	end = 7;
+	if (!bytes && ft_strncmp(argv[i], "--lines", 7) != 0)
+	{
+		if (argv[i][1] != 'n' && argv[i][1] != 'c')
+			return (-1);
+		bytes = (argv[i][1] == 'c');
+		end = 2;
+	}
+	if (!argv[i][end])
+	{
+		if (head_count(argv[i + 1], head, bytes) < 0)
+			return (-1);
+		return (2);
+	}
+	if (end == 7 && argv[i][end] != '=')
+		return (-1);
+	value = argv[i] + end + (end == 7);
+	if (head_count(value, head, bytes) < 0)
+		return (-1);
+	return (1);
+}
+
+/**
+ * @brief Recognizes a head stage reading stdin with -n or -c
+ *
+ * The obsolete "-N" form is accepted as the first argument, like head
+ * does; the last count given wins. File operands, -q/-v/-z and
+ * anything else are left to the real binary.
+ *
+ * @param argv Stage argument vector
+ * @param head Receives the count (DEFAULT_HEAD_LINES lines by default)
+ * @return 0 on success, -1 if the stage is not such a head
+ */
+int	parse_head_argv(char **argv, t_head *head)
+{
+	int	used;
+	int	i;
+
+	if (!argv || !argv[0] || ft_strncmp(argv[0], "head", 5) != 0)
+		return (-1);
+	head->count = DEFAULT_HEAD_LINES;
+	head->bytes = 0;
+	i = 1 + (argv[1] && argv[1][0] == '-' && ft_isdigit(argv[1][1]));
+	if (i == 2 && head_count(argv[1] + 1, head, 0) < 0)
+		return (-1);
+	while (argv[i] && ft_strncmp(argv[i], "--", 3) != 0)
+	{
+		if (argv[i][0] != '-' || !argv[i][1])
+			return (-1);
+		used = head_option(argv, i, head);
+		if (used <= 0)
+			return (-1);
+		i += used;
+	}
+	if (argv[i] && argv[i + 1])
+		return (-1);
+	return (0);
+}
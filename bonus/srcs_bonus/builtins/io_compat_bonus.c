@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   io_compat_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:27:56 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:27:56 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+#ifdef __linux__
+
+/**
+ * @brief Moves up to len bytes between descriptors without a user copy
+ *
+ * One side must be a pipe. Both descriptors use their file offsets.
+ *
+ * @param in_fd Source file descriptor
+ * @param out_fd Destination file descriptor
+ * @param len Maximum number of bytes to move
+ * @return Bytes moved, 0 at EOF, -1 on error (errno is set)
+ */
+ssize_t	move_pipe(int in_fd, int out_fd, size_t len)
+{
+	return (splice(in_fd, NULL, out_fd, NULL, len,
+			SPLICE_F_MOVE | SPLICE_F_MORE));
+}
+
+/**
+ * @brief Copies up to len bytes between two files inside the kernel
+ *
+ * @param in_fd Source file descriptor
+ * @param out_fd Destination file descriptor
+ * @param len Maximum number of bytes to copy
+ * @return Bytes copied, 0 at EOF, -1 on error (errno is set)
+ */
+ssize_t	copy_range(int in_fd, int out_fd, size_t len)
+{
+	return (copy_file_range(in_fd, NULL, out_fd, NULL, len, 0));
+}
+
+#else
+
+/**
+ * @brief splice() is Linux only; callers fall back to read/write
+ *
+ * @param in_fd Unused
+ * @param out_fd Unused
+ * @param len Unused
+ * @return Always -1 with errno set to ENOSYS
+ */
+ssize_t	move_pipe(int in_fd, int out_fd, size_t len)
+{
+	(void)in_fd;
+	(void)out_fd;
+	(void)len;
+	errno = ENOSYS;
+	return (-1);
+}
+
+/**
+ * @brief copy_file_range() is Linux only; callers fall back to read/write
+ *
+ * @param in_fd Unused
+ * @param out_fd Unused
+ * @param len Unused
+ * @return Always -1 with errno set to ENOSYS
+ */
+ssize_t	copy_range(int in_fd, int out_fd, size_t len)
+{
+	(void)in_fd;
+	(void)out_fd;
+	(void)len;
+	errno = ENOSYS;
+	return (-1);
+}
+
+#endif
@@ -0,0 +1,152 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   join_keys_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:33:21 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:33:21 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Tells whether a byte separates the fields of a key file line
+ *
+ * @param join Join stage
+ * @param c Byte
+ * @return 1 for the -t delimiter, or a blank without -t, 0 otherwise
+ */
+static int	join_sep(const t_join *join, char c)
+{
+	if (join->flags & JOIN_DELIM)
+		return (c == join->delim);
+	return (c == ' ' || c == '\t');
+}
+
+/**
+ * @brief Adds the key of a @join key file line, and its payload the first
+ * time the key is seen
+ *
+ * The key is the first field, split like the input; the payload is the
+ * rest, after one separator or a run of blanks. Empty keys are skipped.
+ *
+ * @param join Join stage
+ * @param line Key file line without its newline
+ * @param end End of the line
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	join_pair(t_join *join, const char *line, const char *end)
+{
+	t_join_pay	pay;
+	const char	*p;
+	long		idx;
+
+	while (!(join->flags & JOIN_DELIM) && line < end && join_sep(join, *line))
+		line++;
+	p = line;
+	while (p < end && !join_sep(join, *p))
+		p++;
+	if (p == line)
+		return (0);
+	idx = dist_add(&join->keys, line, p - line, 1);
+	if (idx < 0 || join->keys.entries[idx].count > 1)
+		return (-(idx < 0));
+	p += (p < end);
+	while (!(join->flags & JOIN_DELIM) && p < end && join_sep(join, *p))
+		p++;
+	pay.off = join->payload.len;
+	pay.len = end - p;
+	buf_append(&join->payload, p, end - p);
+	buf_append(&join->pays, (const char *)&pay, sizeof(t_join_pay));
+	return (-(join->pays.failed || join->payload.failed));
+}
+
+/**
+ * @brief Adds one line of the key file to the set
+ *
+ * For @semijoin the whole line is the key, and empty lines are skipped.
+ *
+ * @param join Join stage
+ * @param line Key file line without its newline
+ * @param len Length of the line
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	join_add(t_join *join, const char *line, size_t len)
+{
+	if (join->flags & JOIN_PAYLOAD)
+		return (join_pair(join, line, line + len));
+	if (len && dist_add(&join->keys, line, len, 1) < 0)
+		return (-1);
+	return (0);
+}
+
+/**
+ * @brief Builds the Bloom filter of a large key set
+ *
+ * One 64-bit word per four keys, three bits per key taken from the hash
+ * kept in each entry: a lookup that misses usually stops at that word,
+ * which is far smaller than the slot array.
+ *
+ * @param join Join stage with its keys loaded
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	join_bloom(t_join *join)
+{
+	uint64_t	h;
+	size_t		words;
+	size_t		j;
+
+	if (join->keys.n < JOIN_BLOOM_MIN)
+		return (0);
+	words = 1;
+	while (words * 4 < join->keys.n)
+		words *= 2;
+	join->bloom = ft_calloc(words, sizeof(uint64_t));
+	if (!join->bloom)
+		return (-1);
+	join->bloom_mask = words - 1;
+	j = 0;
+	while (j < join->keys.n)
+	{
+		h = join->keys.entries[j++].hash;
+		join->bloom[(h >> 24) & join->bloom_mask] |= 1ULL << (h & 63)
+			| 1ULL << ((h >> 6) & 63) | 1ULL << ((h >> 12) & 63);
+	}
+	return (0);
+}
+
+/**
+ * @brief Reads the key file into the hash set
+ *
+ * @param join Join stage
+ * @return 0 on success, -1 on read failure, -3 on allocation failure
+ */
+int	join_load(t_join *join)
+{
+	t_reader	r;
+	char		*line;
+	size_t		len;
+	int			ret;
+	int			fd;
+
+	fd = open(join->file, O_RDONLY);
+	if (fd < 0)
+		return (-1);
+	if (reader_init(&r, fd) < 0)
+	{
+		close(fd);
+		return (-3);
+	}
+	ret = next_line(&r, &line, &len);
+	while (ret > 0 && join_add(join, line, len) == 0)
+		ret = next_line(&r, &line, &len);
+	close(fd);
+	reader_free(&r);
+	if (ret < 0)
+		return (-1);
+	if (ret > 0 || join_bloom(join) < 0)
+		return (-3);
+	return (0);
+}
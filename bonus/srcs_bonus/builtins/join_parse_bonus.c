@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   join_parse_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:33:21 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:33:21 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Applies one option taking an argument
+ *
+ * "\t" is accepted for a tab delimiter; a newline cannot be one.
+ *
+ * @param join Join stage
+ * @param c Option letter
+ * @param arg Its argument
+ * @return 0 on success, -1 on an unknown option or a bad argument
+ */
+static int	join_option(t_join *join, char c, const char *arg)
+{
+	if (c == 'k' && ft_strncmp(arg, "0", 2) == 0)
+		join->key = 0;
+	else if (c == 'k')
+		return (parse_count(arg, AWK_MAX_FIELD, &join->key));
+	else if (c == 'j')
+		return (parse_count(arg, BATCH_MAX_THREADS, &join->threads));
+	else if (c != 't')
+		return (-1);
+	else
+	{
+		join->flags |= JOIN_DELIM;
+		join->delim = arg[0];
+		if (ft_strncmp(arg, "\\t", 3) == 0)
+			join->delim = '\t';
+		else if (!arg[0] || arg[1] || arg[0] == '\n')
+			return (-1);
+	}
+	return (0);
+}
+
+/**
+ * @brief Sets the defaults: key field 1 and one thread per online CPU up
+ * to JOIN_MAX_THREADS
+ *
+ * @param join Zeroed join stage
+ * @param name Stage name, @join or @semijoin
+ */
+static void	join_defaults(t_join *join, const char *name)
+{
+	long	cpus;
+
+	join->name = name;
+	if (ft_strncmp(name, "@join", 6) == 0)
+		join->flags |= JOIN_PAYLOAD;
+	join->key = 1;
+	cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	join->threads = JOIN_MAX_THREADS;
+	if (cpus < JOIN_MAX_THREADS)
+		join->threads = cpus;
+	if (join->threads < 1)
+		join->threads = 1;
+}
+
+/**
+ * @brief Parses @semijoin [-v] [-t C] [-k N] [-j N] FILE and
+ * @join [-t C] [-k N] [-j N] FILE
+ *
+ * -k picks the key field of the input lines (0 for the whole line), -v
+ * keeps the lines whose key is not in FILE.
+ *
+ * @param argv Stage arguments
+ * @param join Zeroed join stage receiving the options
+ * @return 0 on success, -1 on a usage error
+ */
+static int	parse_join(char **argv, t_join *join)
+{
+	int	i;
+	int	err;
+
+	join_defaults(join, argv[0]);
+	err = 0;
+	i = 1;
+	while (!err && argv[i] && argv[i + 1])
+	{
+		if (ft_strncmp(argv[i], "-v", 3) == 0
+			&& !(join->flags & JOIN_PAYLOAD))
+			join->flags |= JOIN_ANTI;
+		else if (argv[i][0] != '-' || !argv[i][1])
+			err = -1;
+		else if (argv[i][2])
+			err = join_option(join, argv[i][1], argv[i] + 2);
+		else if (argv[++i + 1])
+			err = join_option(join, argv[i - 1][1], argv[i]);
+		else
+			err = -1;
+		i++;
+	}
+	join->file = argv[i];
+	if (err || !join->file)
+		return (-1);
+	return (0);
+}
+
+/**
+ * @brief Frees the state built by match_join() and the loaded keys
+ *
+ * @param state t_join to free
+ */
+void	free_join(void *state)
+{
+	t_join	*join;
+
+	join = state;
+	free(join->keys.arena.data);
+	free(join->keys.entries);
+	free(join->keys.slots);
+	free(join->payload.data);
+	free(join->pays.data);
+	free(join->bloom);
+	free(join);
+}
+
+/**
+ * @brief Claims @join and @semijoin stages whose arguments parse; the key
+ * file is only read when the stage runs
+ *
+ * @param stage Stage to inspect; its state becomes the parsed t_join
+ * @return 1 if the stage is handled, 0 otherwise
+ */
+int	match_join(t_stage *stage)
+{
+	t_join	*join;
+
+	join = ft_calloc(1, sizeof(t_join));
+	if (!join)
+		return (0);
+	if (parse_join(stage->argv, join) < 0)
+	{
+		free_join(join);
+		return (0);
+	}
+	stage->state = join;
+	return (1);
+}
@@ -0,0 +1,156 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   join_run_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:33:21 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:33:21 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Looks a key up in the set, through the Bloom filter if any
+ *
+ * @param join Join stage with its keys loaded
+ * @param key Key
+ * @param len Length of the key
+ * @return Entry of the key, or -1 if it is not in the set
+ */
+static long	join_lookup(const t_join *join, const char *key, size_t len)
+{
+	uint64_t	h;
+	uint64_t	bits;
+	size_t		i;
+
+	if (join->keys.n == 0)
+		return (-1);
+	h = dist_hash(key, len);
+	bits = 1ULL << (h & 63) | 1ULL << ((h >> 6) & 63)
+		| 1ULL << ((h >> 12) & 63);
+	if (join->bloom
+		&& (join->bloom[(h >> 24) & join->bloom_mask] & bits) != bits)
+		return (-1);
+	i = dist_find(&join->keys, h, key, len);
+	if (!join->keys.slots[i])
+		return (-1);
+	return ((join->keys.slots[i] & 0xFFFFFFFFULL) - 1);
+}
+
+/**
+ * @brief Finds field n of a line split on the -t delimiter
+ *
+ * @param part Worker
+ * @param p Start of the line
+ * @param eol Newline ending the line
+ * @param n Field number, at least 1
+ * @return Start of the field, or NULL if the line has fewer fields
+ */
+static const char	*join_cut(const t_join_part *part, const char *p,
+	const char *eol, int n)
+{
+	while (n-- > 1)
+	{
+		p = memchr(p, part->join->delim, eol - p);
+		if (!p)
+			return (NULL);
+		p++;
+	}
+	return (p);
+}
+
+/**
+ * @brief Looks the key field of a line up in the key set
+ *
+ * Without -t fields are split on runs of blanks like the default awk FS.
+ * A missing field is never in the set.
+ *
+ * @param part Worker
+ * @param line Start of the line
+ * @param eol Newline ending the line
+ * @return Entry of the key, or -1 if it is not in the set
+ */
+static long	join_match(const t_join_part *part, const char *line,
+	const char *eol)
+{
+	const char	*p;
+	const char	*q;
+	size_t		len;
+
+	len = eol - line;
+	p = line;
+	if (part->join->key > 0 && !(part->join->flags & JOIN_DELIM))
+		p = awk_field(line, part->end, part->join->key, &len);
+	else if (part->join->key > 0)
+	{
+		p = join_cut(part, line, eol, part->join->key);
+		q = NULL;
+		if (p)
+			q = memchr(p, part->join->delim, eol - p);
+		if (!q)
+			q = eol;
+		len = q - p;
+	}
+	if (!p)
+		return (-1);
+	return (join_lookup(part->join, p, len));
+}
+
+/**
+ * @brief Appends a matching line followed by the separator and the
+ * payload of its key
+ *
+ * @param part Worker
+ * @param line Start of the line
+ * @param eol Newline ending the line
+ * @param idx Entry of the key
+ */
+static void	join_emit(t_join_part *part, const char *line, const char *eol,
+	long idx)
+{
+	const t_join_pay	*pay;
+
+	pay = &((const t_join_pay *)part->join->pays.data)[idx];
+	buf_append(&part->out, line, eol - line + 1);
+	if (part->out.failed)
+		return ;
+	part->out.data[part->out.len - 1] = ' ';
+	if (part->join->flags & JOIN_DELIM)
+		part->out.data[part->out.len - 1] = part->join->delim;
+	buf_append(&part->out, part->join->payload.data + pay->off, pay->len);
+	buf_append(&part->out, "\n", 1);
+}
+
+/**
+ * @brief Thread entry point filtering one range into the worker's buffer
+ *
+ * @semijoin copies the kept lines as they are; @join appends the
+ * separator and the payload of the key to each matching line.
+ *
+ * @param arg Worker
+ * @return NULL
+ */
+void	*join_worker(void *arg)
+{
+	t_join_part	*part;
+	const char	*p;
+	const char	*eol;
+	long		idx;
+
+	part = arg;
+	p = part->p;
+	while (p < part->end)
+	{
+		eol = memchr(p, '\n', part->end - p);
+		idx = join_match(part, p, eol);
+		if (!(part->join->flags & JOIN_PAYLOAD)
+			&& (idx >= 0) != !!(part->join->flags & JOIN_ANTI))
+			buf_append(&part->out, p, eol + 1 - p);
+		else if ((part->join->flags & JOIN_PAYLOAD) && idx >= 0)
+			join_emit(part, p, eol, idx);
+		p = eol + 1;
+	}
+	return (NULL);
+}
@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   line_reader_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:34:44 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:45:04 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Prepares a line reader on fd
+ *
+ * @param reader Reader to initialize
+ * @param fd Source file descriptor
+ * @return 0 on success, -1 if the buffer can't be allocated
+ */
+int	reader_init(t_reader *reader, int fd)
+{
+	ft_memset(reader, 0, sizeof(t_reader));
+	reader->fd = fd;
+	reader->cap = IO_CHUNK;
+	reader->buf = malloc(reader->cap);
+	if (!reader->buf)
+		return (-1);
+	return (0);
+}
+
+/**
+ * @brief Moves the partial line to the front and reads more input
+ *
+ * The buffer doubles when a single line fills it.
+ *
+ * @param r Line reader
+ * @return 0 on success (r->eof is set at end of input), -1 on error
+ */
+int	reader_fill(t_reader *r)
+{
+	char	*grown;
+	ssize_t	n;
+
+	memmove(r->buf, r->buf + r->start, r->end - r->start);
+	r->end -= r->start;
+	r->start = 0;
+	if (r->end == r->cap)
+	{
+		grown = malloc(r->cap * 2);
+		if (!grown)
+			return (-1);
+		memcpy(grown, r->buf, r->end);
+		free(r->buf);
+		r->buf = grown;
+		r->cap *= 2;
+	}
+	n = io_read(r->fd, r->buf + r->end, r->cap - r->end);
+	while (n < 0 && errno == EINTR)
+		n = io_read(r->fd, r->buf + r->end, r->cap - r->end);
+	if (n < 0)
+		return (-1);
+	r->eof = (n == 0);
+	r->end += n;
+	return (0);
+}
+
+/**
+ * @brief Returns the next line of input, without its newline
+ *
+ * The line points into the reader's buffer and stays valid until the
+ * next call. A last line without a newline is returned as well.
+ *
+ * @param r Line reader
+ * @param line Receives the start of the line
+ * @param len Receives the length of the line
+ * @return 1 if a line was returned, 0 at end of input, -1 on error
+ */
+int	next_line(t_reader *r, char **line, size_t *len)
+{
+	char	*nl;
+
+	while (1)
+	{
+		nl = memchr(r->buf + r->start, '\n', r->end - r->start);
+		if (nl || (r->eof && r->start < r->end))
+		{
+			*line = r->buf + r->start;
+			*len = r->end - r->start;
+			if (nl)
+				*len = nl - *line;
+			r->start += *len + (nl != NULL);
+			return (1);
+		}
+		if (r->eof)
+			return (0);
+		if (reader_fill(r) < 0)
+			return (-1);
+	}
+}
+
+/**
+ * @brief Frees the reader's buffer
+ *
+ * @param reader Line reader
+ */
+void	reader_free(t_reader *reader)
+{
+	free(reader->buf);
+	reader->buf = NULL;
+}
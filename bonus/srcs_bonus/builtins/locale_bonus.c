@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   locale_bonus.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:50:49 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 13:40:35 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Classifies the character type locale the stages will run with
+ *
+ * The first non empty of LC_ALL, LC_CTYPE and LANG decides, like
+ * setlocale(LC_CTYPE, "") in the external tools.
+ *
+ * @return CTYPE_C for C/POSIX (or nothing set), CTYPE_UTF8 for a UTF-8
+ * locale, CTYPE_OTHER for anything else
+ */
+int	ctype_locale(void)
+{
+	static const char	*vars[] = {"LC_ALL", "LC_CTYPE", "LANG", NULL};
+	const char			*value;
+	int					i;
+
+	i = 0;
+	while (vars[i])
+	{
+		value = getenv(vars[i]);
+		if (value && value[0])
+		{
+			if (ft_strncmp(value, "C", 2) == 0
+				|| ft_strncmp(value, "POSIX", 6) == 0)
+				return (CTYPE_C);
+			if (strcasestr(value, "UTF-8") || strcasestr(value, "UTF8"))
+				return (CTYPE_UTF8);
+			return (CTYPE_OTHER);
+		}
+		i++;
+	}
+	return (CTYPE_C);
+}
+
+/**
+ * @brief Tells whether a locale category resolves to the C locale
+ *
+ * The first non empty of LC_ALL, the category and LANG decides; C.UTF-8
+ * counts as C since its collation and number format are those of C.
+ *
+ * @param category Name of the category variable (e.g. "LC_COLLATE")
+ * @return 1 for C, C.<codeset>, POSIX or nothing set, 0 otherwise
+ */
+int	locale_is_c(const char *category)
+{
+	const char	*vars[4];
+	const char	*value;
+	int			i;
+
+	vars[0] = "LC_ALL";
+	vars[1] = category;
+	vars[2] = "LANG";
+	vars[3] = NULL;
+	i = 0;
+	while (vars[i])
+	{
+		value = getenv(vars[i]);
+		if (value && value[0])
+			return (ft_strncmp(value, "C", 2) == 0
+				|| ft_strncmp(value, "C.", 2) == 0
+				|| ft_strncmp(value, "POSIX", 6) == 0);
+		i++;
+	}
+	return (1);
+}
+
+/**
+ * @brief Measures the UTF-8 sequence starting with a non ASCII byte
+ *
+ * Overlong forms, surrogates and code points past U+10FFFF are
+ * rejected, as glibc does.
+ *
+ * @param p Start of the sequence
+ * @param len Bytes available from p
+ * @return Length of the sequence, 0 if it is not valid UTF-8
+ */
+static size_t	utf8_sequence(const unsigned char *p, size_t len)
+{
+	size_t	n;
+	size_t	i;
+
+	n = 4;
+	if (p[0] >= 0xC2 && p[0] <= 0xDF)
+		n = 2;
+	else if (p[0] >= 0xE0 && p[0] <= 0xEF)
+		n = 3;
+	else if (p[0] < 0xF0 || p[0] > 0xF4)
+		return (0);
+	if (len < n || (p[0] == 0xE0 && p[1] < 0xA0)
+		|| (p[0] == 0xED && p[1] > 0x9F) || (p[0] == 0xF0 && p[1] < 0x90)
+		|| (p[0] == 0xF4 && p[1] > 0x8F))
+		return (0);
+	i = 1;
+	while (i < n)
+	{
+		if ((p[i] & 0xC0) != 0x80)
+			return (0);
+		i++;
+	}
+	return (n);
+}
+
+/**
+ * @brief Tells whether a block is valid UTF-8
+ *
+ * ASCII is skipped eight bytes at a time.
+ *
+ * @param p Block to check
+ * @param len Size of the block
+ * @return 1 if the whole block is valid, 0 otherwise
+ */
+int	utf8_valid(const char *p, size_t len)
+{
+	const unsigned char	*s;
+	unsigned long		word;
+	size_t				i;
+	size_t				n;
+
+	s = (const unsigned char *)p;
+	i = 0;
+	while (i < len)
+	{
+		if (i + 8 <= len)
+			memcpy(&word, s + i, 8);
+		if (i + 8 <= len && !(word & 0x8080808080808080UL))
+			n = 8;
+		else if (s[i] < 0x80)
+			n = 1;
+		else
+			n = utf8_sequence(s + i, len - i);
+		if (n == 0)
+			return (0);
+		i += n;
+	}
+	return (1);
+}
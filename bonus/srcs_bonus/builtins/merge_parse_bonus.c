@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   merge_parse_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:18:35 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:18:35 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Parses @merge [-bnrsu] [-t C] [-k KEY]... [--] [FILE]...
+ *
+ * The ordering options are those of the sort builtin, so a merge of
+ * files sorted with "sort -t, -k2,2n" takes "-t, -k2,2n". Without
+ * files the stage input ("-") is merged on its own.
+ *
+ * @param argv Stage arguments
+ * @param merge Zeroed merge stage receiving the options
+ * @return 0 on success, -1 on a usage error
+ */
+static int	parse_merge(char **argv, t_merge *merge)
+{
+	static char	*stdin_only[] = {"-", NULL};
+	int			used;
+	int			i;
+
+	merge->sort.tab = -1;
+	merge->sort.global.eword = SK_NONE;
+	i = 1;
+	while (argv[i] && argv[i][0] == '-' && argv[i][1]
+		&& ft_strncmp(argv[i], "--", 3) != 0)
+	{
+		used = parse_sort_option(&merge->sort, argv, i);
+		if (used <= 0)
+			return (-1);
+		i += used;
+	}
+	if (argv[i] && ft_strncmp(argv[i], "--", 3) == 0)
+		i++;
+	merge->files = argv + i;
+	while (argv[i])
+		i++;
+	merge->nfiles = i - (merge->files - argv);
+	if (merge->nfiles == 0)
+		merge->files = stdin_only;
+	merge->nfiles += (merge->nfiles == 0);
+	return (sort_inherit(&merge->sort));
+}
+
+/**
+ * @brief Frees the state built by match_merge()
+ *
+ * @param state t_merge to free; the file names belong to the stage
+ */
+void	free_merge(void *state)
+{
+	t_merge	*merge;
+
+	merge = state;
+	free(merge->sort.keys);
+	free(merge->sort.tmpdir);
+	free(merge);
+}
+
+/**
+ * @brief Claims @merge stages whose options parse
+ *
+ * @param stage Stage to inspect; its state becomes the parsed t_merge
+ * @return 1 if the stage is handled, 0 otherwise
+ */
+int	match_merge(t_stage *stage)
+{
+	t_merge	*merge;
+
+	merge = ft_calloc(1, sizeof(t_merge));
+	if (!merge)
+		return (0);
+	if (parse_merge(stage->argv, merge) < 0)
+	{
+		free_merge(merge);
+		return (0);
+	}
+	stage->state = merge;
+	return (1);
+}
+
+/**
+ * @brief Hands the infiles of --inputs to the @merge of the first stage
+ *
+ * @param context Pointer to the pipex context structure
+ */
+void	merge_inputs(t_pipex *context)
+{
+	t_stage	*stage;
+	t_merge	*merge;
+
+	stage = &context->stages[0];
+	merge = NULL;
+	if (stage->builtin && ft_strncmp(stage->builtin->name, "@merge", 7) == 0)
+		merge = stage->state;
+	if (!merge || merge->nfiles != 1 || ft_strncmp(merge->files[0], "-", 2))
+		cleanup_and_exit(context,
+			"--inputs: the first stage must be a @merge without files", 1);
+	merge->files = context->infile_paths;
+	merge->nfiles = context->infile_count;
+}
@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   output_bonus.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:34:44 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:54:29 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Writes the whole buffer, retrying short writes and EINTR
+ *
+ * @param fd Destination file descriptor
+ * @param data Bytes to write
+ * @param len Number of bytes to write
+ * @return 0 on success, -1 on write error (errno is set)
+ */
+int	write_all(int fd, const char *data, size_t len)
+{
+	ssize_t	n;
+
+	while (len > 0)
+	{
+		n = io_write(fd, data, len);
+		if (n < 0 && errno != EINTR)
+			return (-1);
+		if (n > 0)
+		{
+			data += n;
+			len -= n;
+		}
+	}
+	return (0);
+}
+
+/**
+ * @brief Hands bytes to the writer's sink, or writes them to its fd
+ *
+ * @param out Buffered writer
+ * @param data Bytes to write
+ * @param len Number of bytes
+ * @return 0 on success, -1 on error
+ */
+static int	out_emit(t_out *out, const char *data, size_t len)
+{
+	if (out->sink)
+		return (out->sink(out->ctx, data, len));
+	return (write_all(out->fd, data, len));
+}
+
+/**
+ * @brief Prepares a buffered writer on fd
+ *
+ * A fused stage may set sink afterwards to receive the blocks instead
+ * of fd.
+ *
+ * @param out Writer to initialize
+ * @param fd Destination file descriptor
+ */
+void	out_init(t_out *out, int fd)
+{
+	out->fd = fd;
+	out->len = 0;
+	out->sink = NULL;
+	out->ctx = NULL;
+}
+
+/**
+ * @brief Writes out everything buffered so far
+ *
+ * @param out Buffered writer
+ * @return 0 on success, -1 on write error (errno is set)
+ */
+int	out_flush(t_out *out)
+{
+	if (out->len > 0 && out_emit(out, out->data, out->len) < 0)
+		return (-1);
+	out->len = 0;
+	return (0);
+}
+
+/**
+ * @brief Buffers bytes for fd, writing IO_CHUNK sized blocks
+ *
+ * @param out Buffered writer
+ * @param data Bytes to write
+ * @param len Number of bytes
+ * @return 0 on success, -1 on write error (errno is set)
+ */
+int	out_write(t_out *out, const char *data, size_t len)
+{
+	if (out->len + len > IO_CHUNK && out_flush(out) < 0)
+		return (-1);
+	if (len >= IO_CHUNK)
+		return (out_emit(out, data, len));
+	memcpy(out->data + out->len, data, len);
+	out->len += len;
+	return (0);
+}
@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ring_bonus.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:45:04 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:45:04 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Maps a ring descriptor to its registry slot
+ *
+ * Rings live in a process wide table; their descriptors start at
+ * RING_FD_BASE, above any kernel descriptor as long as RLIMIT_NOFILE
+ * stays below it (see ring_fds_usable()).
+ * The table is only changed by the thread that sets up a group, before
+ * the stage threads start and after they are joined.
+ *
+ * @param fd Ring descriptor
+ * @return Address of the slot, or NULL if fd is not a ring descriptor
+ */
+static t_ring	**ring_slot(int fd)
+{
+	static t_ring	*rings[RING_MAX];
+
+	if (fd < RING_FD_BASE || fd >= RING_FD_BASE + RING_MAX)
+		return (NULL);
+	return (&rings[fd - RING_FD_BASE]);
+}
+
+/**
+ * @brief Creates a ring with all of its buffers on the empty queue
+ *
+ * @param upstream Input descriptor of the thread that writes the ring,
+ * abandoned when that thread has to stop early
+ * @return Ring descriptor, or -1 if the table is full or malloc failed
+ */
+int	ring_open(int upstream)
+{
+	t_ring	*r;
+	int		fd;
+	int		k;
+
+	fd = RING_FD_BASE;
+	while (ring_slot(fd) && *ring_slot(fd))
+		fd++;
+	if (!ring_slot(fd))
+		return (-1);
+	r = ft_calloc(1, sizeof(t_ring));
+	if (r)
+		r->bufs = malloc(sizeof(t_ring_buf) * RING_SLOTS);
+	if (!r || !r->bufs)
+	{
+		free(r);
+		return (-1);
+	}
+	k = 0;
+	while (k < RING_SLOTS)
+		spsc_push(&r->empty, &r->bufs[k++]);
+	r->upstream = upstream;
+	*ring_slot(fd) = r;
+	return (fd);
+}
+
+/**
+ * @brief Looks up the ring behind a descriptor
+ *
+ * @param fd Any descriptor
+ * @return The ring, or NULL for a kernel descriptor
+ */
+t_ring	*ring_get(int fd)
+{
+	t_ring	**slot;
+
+	slot = ring_slot(fd);
+	if (!slot)
+		return (NULL);
+	return (*slot);
+}
+
+/**
+ * @brief Releases a ring and its buffers
+ *
+ * @param fd Ring descriptor; kernel descriptors are ignored
+ */
+void	ring_free(int fd)
+{
+	t_ring	**slot;
+
+	slot = ring_slot(fd);
+	if (!slot || !*slot)
+		return ;
+	free((*slot)->bufs);
+	free(*slot);
+	*slot = NULL;
+}
+
+/**
+ * @brief Tells whether ring descriptors cannot clash with kernel ones
+ *
+ * The kernel never hands out a descriptor at or above RLIMIT_NOFILE, so
+ * the ring range is safe while that limit is at most RING_FD_BASE. With
+ * a higher (or unknown) limit, --threaded keeps kernel pipes.
+ *
+ * @return 1 if rings may be used, 0 otherwise
+ */
+int	ring_fds_usable(void)
+{
+	struct rlimit	lim;
+
+	if (getrlimit(RLIMIT_NOFILE, &lim) < 0)
+		return (0);
+	return (lim.rlim_cur != RLIM_INFINITY && lim.rlim_cur <= RING_FD_BASE);
+}
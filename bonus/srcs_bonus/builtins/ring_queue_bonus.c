@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ring_queue_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:45:04 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:45:04 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Appends a buffer to a single-producer single-consumer queue
+ *
+ * A queue holds more slots than a ring has buffers, so a push can never
+ * find it full. The release store publishes the slot before the new tail.
+ *
+ * @param q Queue owned on the producing side by the calling thread
+ * @param buf Buffer to hand over
+ */
+void	spsc_push(t_spsc *q, t_ring_buf *buf)
+{
+	size_t	tail;
+
+	tail = __atomic_load_n(&q->tail, __ATOMIC_RELAXED);
+	q->items[tail & (RING_QUEUE - 1)] = buf;
+	__atomic_store_n(&q->tail, tail + 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Takes the oldest buffer off a single-producer single-consumer
+ * queue without waiting
+ *
+ * @param q Queue owned on the consuming side by the calling thread
+ * @return The buffer, or NULL if the queue is empty
+ */
+t_ring_buf	*spsc_pop(t_spsc *q)
+{
+	t_ring_buf	*buf;
+	size_t		head;
+
+	head = __atomic_load_n(&q->head, __ATOMIC_RELAXED);
+	if (head == __atomic_load_n(&q->tail, __ATOMIC_ACQUIRE))
+		return (NULL);
+	buf = q->items[head & (RING_QUEUE - 1)];
+	__atomic_store_n(&q->head, head + 1, __ATOMIC_RELEASE);
+	return (buf);
+}
+
+/**
+ * @brief Waits a little longer each time a queue is found empty
+ *
+ * Spins first, since the other side is usually about to hand a buffer
+ * over, then yields the CPU, then sleeps so that a stage blocked on a
+ * slow neighbour does not burn a core.
+ *
+ * @param spins Number of times the caller has waited so far
+ */
+void	ring_backoff(int *spins)
+{
+	(*spins)++;
+	if (*spins < RING_SPINS)
+		return ;
+	if (*spins < RING_YIELDS)
+		sched_yield();
+	else
+		usleep(RING_SLEEP_US);
+}
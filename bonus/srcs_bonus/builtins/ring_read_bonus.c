@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ring_read_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:45:04 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:45:04 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Waits for the next filled buffer of a ring
+ *
+ * The queue is checked once more after the writer has closed, since the
+ * last buffer is pushed before the close is published.
+ *
+ * @param r Ring read by the calling thread
+ * @return The buffer, or NULL at end of input
+ */
+static t_ring_buf	*take_full(t_ring *r)
+{
+	t_ring_buf	*buf;
+	int			spins;
+
+	spins = 0;
+	buf = spsc_pop(&r->full);
+	while (!buf)
+	{
+		if (__atomic_load_n(&r->closed, __ATOMIC_ACQUIRE))
+			return (spsc_pop(&r->full));
+		ring_backoff(&spins);
+		buf = spsc_pop(&r->full);
+	}
+	return (buf);
+}
+
+/**
+ * @brief read() for a ring: copies out of the current buffer and hands
+ * it back to the writer once it is drained
+ *
+ * @param r Ring read by the calling thread
+ * @param buf Destination
+ * @param len Size of buf
+ * @return Bytes copied, 0 at end of input
+ */
+ssize_t	ring_read(t_ring *r, void *buf, size_t len)
+{
+	size_t	n;
+
+	if (!r->reading)
+	{
+		r->reading = take_full(r);
+		r->read_off = 0;
+	}
+	if (!r->reading)
+		return (0);
+	n = r->reading->len - r->read_off;
+	if (n > len)
+		n = len;
+	ft_memcpy(buf, r->reading->data + r->read_off, n);
+	r->read_off += n;
+	if (r->read_off == r->reading->len)
+	{
+		spsc_push(&r->empty, r->reading);
+		r->reading = NULL;
+	}
+	return (n);
+}
+
+/**
+ * @brief Tells the writer of a ring that nothing will be read any more,
+ * as closing the read end of a pipe would
+ *
+ * @param fd Ring descriptor; kernel descriptors are ignored
+ */
+void	ring_abandon(int fd)
+{
+	t_ring	*r;
+
+	r = ring_get(fd);
+	if (r)
+		__atomic_store_n(&r->abandoned, 1, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ring_write_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:45:04 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:45:04 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Ends the writing thread after its reader went away
+ *
+ * This is what SIGPIPE does to a stage process: the thread stops
+ * quietly with status 128 + SIGPIPE, and its own input is abandoned in
+ * turn so the stage feeding it stops on its next write.
+ *
+ * @param r Ring whose reader has finished
+ */
+static void	stop_writer(t_ring *r)
+{
+	ring_abandon(r->upstream);
+	pthread_exit((void *)(intptr_t)(128 + SIGPIPE));
+}
+
+/**
+ * @brief Waits for a recycled buffer to fill
+ *
+ * @param r Ring written by the calling thread
+ * @return An empty buffer (does not return if the reader went away)
+ */
+static t_ring_buf	*take_empty(t_ring *r)
+{
+	t_ring_buf	*buf;
+	int			spins;
+
+	spins = 0;
+	buf = spsc_pop(&r->empty);
+	while (!buf)
+	{
+		if (__atomic_load_n(&r->abandoned, __ATOMIC_ACQUIRE))
+			stop_writer(r);
+		ring_backoff(&spins);
+		buf = spsc_pop(&r->empty);
+	}
+	buf->len = 0;
+	return (buf);
+}
+
+/**
+ * @brief Hands the buffer being filled over to the reader
+ *
+ * @param r Ring written by the calling thread
+ */
+static void	push_writing(t_ring *r)
+{
+	spsc_push(&r->full, r->writing);
+	r->writing = NULL;
+}
+
+/**
+ * @brief write() for a ring: copies into fixed-size buffers
+ *
+ * Small writes are coalesced while the reader still has buffers to
+ * work on; a partly filled buffer is handed over at once when the
+ * reader's queue is empty, so a waiting reader is never kept waiting.
+ *
+ * @param r Ring written by the calling thread
+ * @param buf Data to write
+ * @param len Number of bytes
+ * @return len (does not return if the reader went away)
+ */
+ssize_t	ring_write(t_ring *r, const void *buf, size_t len)
+{
+	size_t	done;
+	size_t	n;
+
+	if (__atomic_load_n(&r->abandoned, __ATOMIC_ACQUIRE))
+		stop_writer(r);
+	done = 0;
+	while (done < len)
+	{
+		if (!r->writing)
+			r->writing = take_empty(r);
+		n = RING_BUF - r->writing->len;
+		if (n > len - done)
+			n = len - done;
+		ft_memcpy(r->writing->data + r->writing->len,
+			(const char *)buf + done, n);
+		r->writing->len += n;
+		done += n;
+		if (r->writing->len == RING_BUF)
+			push_writing(r);
+	}
+	if (r->writing && __atomic_load_n(&r->full.head, __ATOMIC_ACQUIRE)
+		== r->full.tail)
+		push_writing(r);
+	return (len);
+}
+
+/**
+ * @brief Flushes what is left and signals end of input to the reader
+ *
+ * @param fd Ring descriptor; kernel descriptors are ignored
+ */
+void	ring_close(int fd)
+{
+	t_ring	*r;
+
+	r = ring_get(fd);
+	if (!r)
+		return ;
+	if (r->writing && r->writing->len > 0)
+		push_writing(r);
+	__atomic_store_n(&r->closed, 1, __ATOMIC_RELEASE);
+}
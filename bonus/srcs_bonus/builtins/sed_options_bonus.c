@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sed_options_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:01:35 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:01:35 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Takes the script of -e, --expression or the first operand
+ *
+ * @param sed Receives the script
+ * @param script Script text, NULL when the option lacks its value
+ * @return 0 on success, -1 when it is missing or a second script (more
+ * -e scripts, or an operand that sed would read as a file)
+ */
+static int	sed_take_script(t_sed *sed, const char *script)
+{
+	if (!script || sed->script)
+		return (-1);
+	sed->script = script;
+	return (0);
+}
+
+/**
+ * @brief Parses a cluster of short options ("-n", "-ne", "-es/a/b/")
+ *
+ * @param argv Stage argument vector
+ * @param i Index of the cluster
+ * @param sed Receives the options
+ * @return Number of arguments consumed, or -1 if not supported
+ */
+static int	sed_short(char **argv, int i, t_sed *sed)
+{
+	size_t	k;
+
+	k = 1;
+	while (argv[i][k] == 'n')
+	{
+		sed->flags |= SED_QUIET;
+		k++;
+	}
+	if (!argv[i][k])
+		return (1);
+	if (argv[i][k] != 'e')
+		return (-1);
+	if (argv[i][k + 1])
+		return (sed_take_script(sed, argv[i] + k + 1) + 1);
+	if (sed_take_script(sed, argv[i + 1]) < 0)
+		return (-1);
+	return (2);
+}
+
+/**
+ * @brief Parses a long option (--quiet, --silent, --expression)
+ *
+ * Abbreviations are left to sed.
+ *
+ * @param argv Stage argument vector
+ * @param i Index of the option
+ * @param sed Receives the options
+ * @return Number of arguments consumed, or 0 or -1 if not supported
+ */
+static int	sed_long(char **argv, int i, t_sed *sed)
+{
+	if (ft_strncmp(argv[i], "--quiet", 8) == 0
+		|| ft_strncmp(argv[i], "--silent", 9) == 0)
+	{
+		sed->flags |= SED_QUIET;
+		return (1);
+	}
+	if (ft_strncmp(argv[i], "--expression=", 13) == 0)
+		return (sed_take_script(sed, argv[i] + 13) + 1);
+	if (ft_strncmp(argv[i], "--expression", 13) != 0
+		|| sed_take_script(sed, argv[i + 1]) < 0)
+		return (-1);
+	return (2);
+}
+
+/**
+ * @brief Recognizes a sed stage reading stdin with one literal command
+ *
+ * Options may come before or after the script, as getopt permutes them.
+ * -n and a single script (operand, -e or --expression) are taken; file
+ * operands, -E/-r, -i, -z and the rest are left to the real binary.
+ *
+ * @param argv Stage argument vector
+ * @param sed Receives the options and the parsed command
+ * @return 0 on success, -1 if the stage is not such a sed
+ */
+int	parse_sed_argv(char **argv, t_sed *sed)
+{
+	int	used;
+	int	i;
+
+	i = 1;
+	while (argv[i] && ft_strncmp(argv[i], "--", 3) != 0)
+	{
+		if (argv[i][0] == '-' && argv[i][1] == '-')
+			used = sed_long(argv, i, sed);
+		else if (argv[i][0] == '-' && argv[i][1])
+			used = sed_short(argv, i, sed);
+		else
+			used = sed_take_script(sed, argv[i]) + 1;
+		if (used <= 0)
+			return (-1);
+		i += used;
+	}
+	if (argv[i] && argv[i + 1]
+		&& (argv[i + 2] || sed_take_script(sed, argv[i + 1]) < 0))
+		return (-1);
+	if (!sed->script)
+		return (-1);
+	return (parse_sed_script(sed->script, sed));
+}
@@ -0,0 +1,190 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sed_parse_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:01:35 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:01:35 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Reads a regular expression that means the same as a fixed
+ * string, up to its closing delimiter, into a grep matcher
+ *
+ * An escaped delimiter stands for itself. Any other backslash, '.',
+ * '[', '*', a leading '^' or a trailing '$' is a regular expression
+ * operator, and so is left to sed; so is the empty regex, which means
+ * "the last one used".
+ *
+ * @param s Script
+ * @param i Index of the first byte, moved past the closing delimiter
+ * @param delim Delimiter
+ * @param grep Receives the literal as its pattern
+ * @return 0 on success, -1 if not supported
+ */
+static int	sed_literal(const char *s, size_t *i, int delim, t_grep *grep)
+{
+	t_buf	lit;
+	char	c;
+	int		status;
+
+	ft_bzero(&lit, sizeof(t_buf));
+	while (s[*i] && s[*i] != delim)
+	{
+		*i += (s[*i] == '\\' && s[*i + 1] == delim);
+		c = s[*i];
+		if (ft_strchr("\\\n.[*", c) || (c == '^' && lit.len == 0))
+			break ;
+		buf_append(&lit, &c, 1);
+		(*i)++;
+	}
+	status = -1;
+	if (s[*i] == delim && lit.len > 0 && !lit.failed
+		&& lit.data[lit.len - 1] != '$')
+		status = grep_add_text(grep, lit.data, lit.len);
+	free(lit.data);
+	*i += (status == 0);
+	return (status);
+}
+
+/**
+ * @brief Reads one byte of a replacement, decoding escapes
+ *
+ * @param s Script
+ * @param i Index of the byte, moved to the escaped byte after a backslash
+ * @param delim Delimiter of the s command
+ * @return Byte it stands for, 256 for '&' (the matched text), -1 for a
+ * newline or an escape left to sed (\1, \U...)
+ */
+static int	sed_repl_byte(const char *s, size_t *i, int delim)
+{
+	int	c;
+
+	c = (unsigned char)s[*i];
+	if (c == '&')
+		return (256);
+	if (c == '\n')
+		return (-1);
+	if (c != '\\')
+		return (c);
+	(*i)++;
+	c = (unsigned char)s[*i];
+	if (c == delim || c == '\\' || c == '&')
+		return (c);
+	if (c == 'n')
+		return ('\n');
+	if (c == 't')
+		return ('\t');
+	return (-1);
+}
+
+/**
+ * @brief Expands a replacement into the bytes it produces
+ *
+ * The pattern being literal, '&' (the matched text) is the pattern
+ * itself.
+ *
+ * @param s Script
+ * @param i Index of the first byte, moved past the closing delimiter
+ * @param delim Delimiter of the s command
+ * @param sed Holds the pattern, receives the replacement
+ * @return 0 on success, -1 if not supported
+ */
+static int	sed_replacement(const char *s, size_t *i, int delim, t_sed *sed)
+{
+	char	byte;
+	int		c;
+
+	while (s[*i] && s[*i] != delim)
+	{
+		c = sed_repl_byte(s, i, delim);
+		if (c < 0)
+			return (-1);
+		byte = c;
+		if (c == 256)
+			buf_append(&sed->repl, sed->pat.text.data, sed->pat.text.len - 1);
+		else
+			buf_append(&sed->repl, &byte, 1);
+		(*i)++;
+	}
+	if (s[*i] != delim || sed->repl.failed)
+		return (-1);
+	(*i)++;
+	return (0);
+}
+
+/**
+ * @brief Parses the rest of an s command: pattern, replacement, flags
+ *
+ * Delimiters that are regular expression operators, backslash, newline
+ * or alphanumeric are left to sed. Only the g and p flags are taken.
+ *
+ * @param s Script
+ * @param i Index of the delimiter, moved past the flags
+ * @param sed Receives the pattern, the replacement and the flags
+ * @return 0 on success, -1 if not supported
+ */
+static int	sed_subst(const char *s, size_t *i, t_sed *sed)
+{
+	int		delim;
+	int		bit;
+
+	delim = (unsigned char)s[*i];
+	if (!delim || ft_strchr("\\\n.*[]^$&", delim) || ft_isalnum(delim))
+		return (-1);
+	(*i)++;
+	if (sed_literal(s, i, delim, &sed->pat) < 0
+		|| sed_replacement(s, i, delim, sed) < 0)
+		return (-1);
+	while (s[*i] == 'g' || s[*i] == 'p')
+	{
+		bit = SED_PRINT;
+		if (s[*i] == 'g')
+			bit = SED_GLOBAL;
+		if (sed->flags & bit)
+			return (-1);
+		sed->flags |= bit;
+		(*i)++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Parses a one command script: [/literal/]d, /literal/p or
+ * [/literal/]s/literal/replacement/[g][p]
+ *
+ * Blanks may surround the address and the command, and a single ';' may
+ * end it. Anything else (line numbers, several commands, other
+ * commands) is left to sed.
+ *
+ * @param script Script text
+ * @param sed Receives the command
+ * @return 0 on success, -1 if not supported
+ */
+int	parse_sed_script(const char *script, t_sed *sed)
+{
+	size_t	i;
+
+	i = strspn(script, " \t");
+	if (script[i] == '/')
+	{
+		i++;
+		sed->flags |= SED_ADDRESS;
+		if (sed_literal(script, &i, '/', &sed->addr) < 0)
+			return (-1);
+		i += strspn(script + i, " \t");
+	}
+	sed->cmd = script[i++];
+	if (!sed->cmd || !ft_strchr("dps", sed->cmd)
+		|| (sed->cmd != 's' && !(sed->flags & SED_ADDRESS))
+		|| (sed->cmd == 's' && sed_subst(script, &i, sed) < 0))
+		return (-1);
+	i += strspn(script + i, " \t");
+	i += (script[i] == ';');
+	i += strspn(script + i, " \t");
+	return (-(script[i] != '\0'));
+}
@@ -0,0 +1,167 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sed_run_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:01:35 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:01:35 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Gathers the substituted line: the text between matches as
+ * slices of the read buffer, the replacement in place of each match
+ *
+ * @param run Sed in progress, run->first being the first match
+ * @return 0 on success, -1 on write error
+ */
+static int	sed_subst_line(t_sed_run *run)
+{
+	const t_sed	*sed;
+	size_t		at;
+	long		hit;
+
+	sed = run->sed;
+	at = 0;
+	hit = run->first;
+	while (hit >= 0)
+	{
+		if (gather_add(&run->out, run->line + at, hit - at) < 0
+			|| gather_add(&run->out, sed->repl.data, sed->repl.len) < 0)
+			return (-1);
+		at = hit + sed->pat.patterns[0].len;
+		if (!(sed->flags & SED_GLOBAL))
+			break ;
+		hit = grep_search(&sed->pat, (const unsigned char *)run->line + at,
+				run->len - at);
+		if (hit >= 0)
+			hit += at;
+	}
+	return (gather_add(&run->out, run->line + at, run->len - at));
+}
+
+/**
+ * @brief Prints the pattern space, substituted when run->first >= 0
+ *
+ * As in sed, a last line without a newline is printed without one; if
+ * anything follows, the missing newline goes out first.
+ *
+ * @param run Sed in progress
+ * @return 0 on success, -1 on write error
+ */
+static int	sed_put(t_sed_run *run)
+{
+	int	status;
+
+	status = 0;
+	if (run->pending)
+		status = gather_add(&run->out, "\n", 1);
+	run->pending = 0;
+	if (status == 0 && run->first < 0)
+		status = gather_add(&run->out, run->line, run->len);
+	else if (status == 0)
+		status = sed_subst_line(run);
+	if (status == 0 && run->nl)
+		status = gather_add(&run->out, run->line + run->len, 1);
+	run->pending = !run->nl;
+	return (status);
+}
+
+/**
+ * @brief Runs the command on a line that holds a match of its key
+ *
+ * @param run Sed in progress, with the line and the offset of the match
+ * @return 0 on success, -1 on write error
+ */
+static int	sed_line(t_sed_run *run)
+{
+	const t_sed	*sed;
+
+	sed = run->sed;
+	if (sed->cmd == 'd')
+		return (0);
+	if (sed->cmd == 'p')
+		run->first = -1;
+	if (sed->cmd == 'p' && sed_put(run) < 0)
+		return (-1);
+	if (sed->cmd == 's' && (sed->flags & SED_ADDRESS))
+		run->first = grep_search(&sed->pat, (const unsigned char *)run->line,
+				run->len);
+	if (sed->cmd == 's' && run->first >= 0 && (sed->flags & SED_PRINT)
+		&& sed_put(run) < 0)
+		return (-1);
+	if (!(sed->flags & SED_QUIET))
+		return (sed_put(run));
+	return (0);
+}
+
+/**
+ * @brief Runs the command on the line holding a match
+ *
+ * @param run Sed in progress
+ * @param line Start of the line
+ * @param len Bytes left in the block from line
+ * @param hit Offset of the match in the line
+ * @return Length of the line with its newline, -1 on write error
+ */
+static long	sed_hit(t_sed_run *run, const char *line, size_t len, size_t hit)
+{
+	const char	*nl;
+
+	nl = memchr(line + hit, '\n', len - hit);
+	run->nl = (nl != NULL);
+	if (!nl)
+		nl = line + len;
+	run->line = line;
+	run->len = nl - line;
+	run->first = hit;
+	if (sed_line(run) < 0)
+		return (-1);
+	return (run->len + run->nl);
+}
+
+/**
+ * @brief Edits a block of whole lines
+ *
+ * The key (the address, else the s pattern) is searched over the whole
+ * block with the vector literal search of the grep builtin, so lines
+ * without it are skipped in bulk: without -n they go out as one slice
+ * of the read buffer. All output is gathered for a single writev() per
+ * block.
+ *
+ * @param run Sed in progress
+ * @param p Block, ending with a newline unless it is the end of input
+ * @param len Size of the block
+ * @return 0 on success, -1 on write error
+ */
+int	sed_block(t_sed_run *run, const char *p, size_t len)
+{
+	size_t	pos;
+	size_t	end;
+	long	hit;
+
+	pos = 0;
+	while (pos < len)
+	{
+		hit = grep_search(run->key, (const unsigned char *)p + pos,
+				len - pos);
+		end = len;
+		if (hit >= 0)
+			end = pos + hit;
+		while (hit >= 0 && end > pos && p[end - 1] != '\n')
+			end--;
+		if (!(run->sed->flags & SED_QUIET)
+			&& gather_add(&run->out, p + pos, end - pos) < 0)
+			return (-1);
+		if (hit < 0)
+			break ;
+		hit = sed_hit(run, p + end, len - end, pos + hit - end);
+		if (hit < 0)
+			return (-1);
+		pos = end + hit;
+	}
+	return (gather_flush(&run->out));
+}
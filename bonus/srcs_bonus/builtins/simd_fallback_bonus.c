@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   simd_fallback_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:50:49 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:50:49 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+#if !defined(__x86_64__) || !defined(__GNUC__)
+
+/**
+ * @brief SSE2 is x86 only; counts newlines with the scalar kernel
+ *
+ * @param wc Counts to update
+ * @param p Block to scan
+ * @param len Size of the block
+ */
+void	wc_lines_sse2(t_wc *wc, const unsigned char *p, size_t len)
+{
+	wc_lines_scalar(wc, p, len);
+}
+
+/**
+ * @brief SSE2 is x86 only; counts words with the scalar kernel
+ *
+ * @param wc Counts and word state to update
+ * @param p Block to scan
+ * @param len Size of the block
+ */
+void	wc_words_sse2(t_wc *wc, const unsigned char *p, size_t len)
+{
+	wc_words_scalar(wc, p, len);
+}
+
+/**
+ * @brief AVX2 is x86 only; counts newlines with the scalar kernel
+ *
+ * @param wc Counts to update
+ * @param p Block to scan
+ * @param len Size of the block
+ */
+void	wc_lines_avx2(t_wc *wc, const unsigned char *p, size_t len)
+{
+	wc_lines_scalar(wc, p, len);
+}
+
+/**
+ * @brief AVX2 is x86 only; counts words with the scalar kernel
+ *
+ * @param wc Counts and word state to update
+ * @param p Block to scan
+ * @param len Size of the block
+ */
+void	wc_words_avx2(t_wc *wc, const unsigned char *p, size_t len)
+{
+	wc_words_scalar(wc, p, len);
+}
+
+/**
+ * @brief AVX2 is x86 only; searches with the scalar kernel
+ *
+ * @param grep Builtin grep state
+ * @param p Text to search
+ * @param len Length of the text
+ * @return Offset of the first match, -1 if none
+ */
+long	grep_search_avx2(const t_grep *grep, const unsigned char *p,
+		size_t len)
+{
+	return (grep_search_scalar(grep, p, len));
+}
+
+#endif
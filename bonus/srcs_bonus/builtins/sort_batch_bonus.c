@@ -0,0 +1,168 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sort_batch_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:40:35 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 13:40:35 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Sorts the batch as independent chunks, in parallel
+ *
+ * The batch is cut into a few chunks per thread so that the pool can
+ * balance uneven chunks; the sorted chunks are merged on output.
+ *
+ * @param run Sort run
+ * @return 0 on success, -1 on allocation failure
+ */
+int	sort_batch(t_sort_run *run)
+{
+	size_t	i;
+
+	run->tasks = 1;
+	if (run->threads > 1)
+		run->tasks = run->threads * SORT_TASKS;
+	if ((size_t)run->tasks > run->batch.n)
+		run->tasks = run->batch.n;
+	free(run->bounds);
+	run->bounds = malloc(sizeof(size_t) * (run->tasks + 1));
+	if (!run->bounds)
+		return (-builtin_error("sort", "memory exhausted"));
+	i = 0;
+	while (i <= (size_t)run->tasks)
+	{
+		run->bounds[i] = 0;
+		if (run->tasks)
+			run->bounds[i] = run->batch.n * i / run->tasks;
+		i++;
+	}
+	if (run->tasks == 0)
+		return (0);
+	return (sort_parallel(run));
+}
+
+/**
+ * @brief Empties the batch once it has been spilled
+ *
+ * The current chunk is kept: it still holds the partial line being read.
+ * The record array is kept as well and refilled.
+ *
+ * @param run Sort run
+ */
+void	sort_reset(t_sort_run *run)
+{
+	t_sort_batch	*b;
+	size_t			i;
+
+	b = &run->batch;
+	i = 0;
+	while (i + 1 < b->nchunks)
+	{
+		free(b->chunks[i]);
+		i++;
+	}
+	if (b->nchunks)
+		b->chunks[0] = run->buf;
+	b->nchunks = (b->nchunks > 0);
+	b->bytes = run->size;
+	b->n = 0;
+	run->tasks = 0;
+}
+
+/**
+ * @brief Points each source at its run or chunk and reads its first line
+ *
+ * @param run Sort run
+ * @param srcs Zeroed sources
+ * @param base Number of runs taking part, which come first
+ * @param k Number of sources
+ * @return 0 on success, -1 on read error
+ */
+static int	sources_fill(t_sort_run *run, t_sort_src *srcs, int base, int k)
+{
+	int	i;
+
+	i = 0;
+	while (i < k)
+	{
+		if (i < base)
+			srcs[i].reader = &run->runs[i];
+		else
+		{
+			srcs[i].rec = run->batch.recs + run->bounds[i - base];
+			srcs[i].end = run->batch.recs + run->bounds[i - base + 1];
+		}
+		i++;
+	}
+	i = 0;
+	while (i < k && src_next(&srcs[i]) >= 0)
+		i++;
+	return (-(i < k));
+}
+
+/**
+ * @brief Lists the sources of a merge: spilled runs, then sorted chunks
+ *
+ * Runs come first since they hold earlier input, which keeps the merge
+ * stable.
+ *
+ * @param run Sort run, sorted by sort_batch()
+ * @param with_runs Whether the spilled runs take part
+ * @param k Receives the number of sources
+ * @return The primed sources, or NULL on error
+ */
+t_sort_src	*sort_sources(t_sort_run *run, int with_runs, int *k)
+{
+	t_sort_src	*srcs;
+	int			base;
+
+	base = 0;
+	if (with_runs)
+		base = run->nruns;
+	*k = base + run->tasks;
+	srcs = ft_calloc(*k + 1, sizeof(t_sort_src));
+	if (!srcs)
+	{
+		builtin_error("sort", "memory exhausted");
+		return (NULL);
+	}
+	if (sources_fill(run, srcs, base, *k) == 0)
+		return (srcs);
+	free(srcs);
+	return (NULL);
+}
+
+/**
+ * @brief Frees the batch and closes the spilled runs
+ *
+ * @param run Sort run
+ */
+void	sort_release(t_sort_run *run)
+{
+	size_t	i;
+	int		r;
+
+	i = 0;
+	while (i < run->batch.nchunks)
+	{
+		free(run->batch.chunks[i]);
+		i++;
+	}
+	free(run->batch.chunks);
+	free(run->batch.recs);
+	free(run->bounds);
+	r = 0;
+	while (r < run->nruns)
+	{
+		close(run->runs[r].fd);
+		reader_free(&run->runs[r]);
+		r++;
+	}
+	free(run->runs);
+}
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sort_chunk_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:40:35 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 13:40:35 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Sorts a few records by insertion (stable)
+ *
+ * @param sort Sort options
+ * @param a Records
+ * @param n Number of records
+ */
+static void	insertion_sort(const t_sort *sort, t_sort_rec *a, size_t n)
+{
+	t_sort_rec	cur;
+	size_t		i;
+	size_t		j;
+
+	i = 1;
+	while (i < n)
+	{
+		cur = a[i];
+		j = i;
+		while (j > 0 && sort_rec_cmp(sort, &a[j - 1], &cur) > 0)
+		{
+			a[j] = a[j - 1];
+			j--;
+		}
+		a[j] = cur;
+		i++;
+	}
+}
+
+/**
+ * @brief Merges the two sorted halves of a, keeping equal records in
+ * order
+ *
+ * Records of the right half left over at the end are already in place.
+ *
+ * @param sort Sort options
+ * @param a Records, both halves sorted
+ * @param tmp Scratch space for n records
+ * @param n Number of records
+ */
+static void	merge_halves(const t_sort *sort, t_sort_rec *a, t_sort_rec *tmp,
+		size_t n)
+{
+	size_t	i;
+	size_t	j;
+	size_t	o;
+
+	i = 0;
+	j = n / 2;
+	o = 0;
+	while (i < n / 2 && j < n)
+	{
+		if (sort_rec_cmp(sort, &a[j], &a[i]) < 0)
+			tmp[o++] = a[j++];
+		else
+			tmp[o++] = a[i++];
+	}
+	ft_memcpy(tmp + o, a + i, sizeof(t_sort_rec) * (n / 2 - i));
+	o += n / 2 - i;
+	ft_memcpy(a, tmp, sizeof(t_sort_rec) * o);
+}
+
+/**
+ * @brief Sorts records with a stable merge sort
+ *
+ * Halves that are already in order are not merged, so sorted input costs
+ * one comparison per record and level.
+ *
+ * @param sort Sort options
+ * @param a Records
+ * @param tmp Scratch space for n records
+ * @param n Number of records
+ */
+void	sort_chunk(const t_sort *sort, t_sort_rec *a, t_sort_rec *tmp,
+		size_t n)
+{
+	if (n <= SORT_INSERTION)
+	{
+		insertion_sort(sort, a, n);
+		return ;
+	}
+	sort_chunk(sort, a, tmp, n / 2);
+	sort_chunk(sort, a + n / 2, tmp + n / 2, n - n / 2);
+	if (sort_rec_cmp(sort, &a[n / 2 - 1], &a[n / 2]) > 0)
+		merge_halves(sort, a, tmp, n);
+}
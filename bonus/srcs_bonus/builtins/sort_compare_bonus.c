@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sort_compare_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:40:35 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 13:40:35 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Cuts the text of a key out of a line
+ *
+ * A key ending before it starts is empty, as in sort.
+ *
+ * @param sort Sort options
+ * @param key Key definition
+ * @param line Line without its newline
+ * @param span Receives the key text
+ */
+void	key_span(const t_sort *sort, const t_sort_key *key,
+		const t_line *line, t_line *span)
+{
+	char	*lim;
+
+	span->data = key_begin(sort, key, line);
+	lim = key_limit(sort, key, line);
+	span->len = 0;
+	if (lim > span->data)
+		span->len = lim - span->data;
+}
+
+/**
+ * @brief Compares the texts of one key taken from two lines
+ *
+ * @param key Key definition
+ * @param x Key text of the first line
+ * @param y Key text of the second line
+ * @return Negative, zero or positive as x sorts before, with or after y
+ */
+int	key_cmp(const t_sort_key *key, const t_line *x, const t_line *y)
+{
+	int	diff;
+
+	if (key->flags & SK_NUMERIC)
+		diff = sort_numcmp(x, y);
+	else
+		diff = line_cmp(x, y);
+	if (key->flags & SK_REVERSE)
+		return (-diff);
+	return (diff);
+}
+
+/**
+ * @brief Orders two lines on the keys from first on, then as a whole
+ *
+ * Lines equal on every key fall back to a bytewise comparison of the
+ * whole lines, unless -u or -s is given. -r reverses that last
+ * comparison too.
+ *
+ * @param sort Sort options
+ * @param a First line
+ * @param b Second line
+ * @param first Index of the first key to compare
+ * @return Negative, zero or positive as a sorts before, with or after b
+ */
+int	sort_compare_from(const t_sort *sort, const t_line *a, const t_line *b,
+		int first)
+{
+	t_line	x;
+	t_line	y;
+	int		diff;
+
+	while (first < sort->nkeys)
+	{
+		key_span(sort, &sort->keys[first], a, &x);
+		key_span(sort, &sort->keys[first], b, &y);
+		diff = key_cmp(&sort->keys[first], &x, &y);
+		if (diff)
+			return (diff);
+		first++;
+	}
+	if (sort->nkeys && (sort->flags & (SORT_UNIQUE | SORT_STABLE)))
+		return (0);
+	diff = line_cmp(a, b);
+	if (sort->flags & SORT_REVERSE)
+		return (-diff);
+	return (diff);
+}
+
+/**
+ * @brief Orders two lines the way sort does in the C locale
+ *
+ * @param sort Sort options
+ * @param a First line
+ * @param b Second line
+ * @return Negative, zero or positive as a sorts before, with or after b
+ */
+int	sort_compare(const t_sort *sort, const t_line *a, const t_line *b)
+{
+	return (sort_compare_from(sort, a, b, 0));
+}
@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sort_fields_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:40:35 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 13:40:35 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Skips blanks (space and tab, as in the C locale)
+ *
+ * @param p Current position
+ * @param lim End of the line
+ * @return First non blank position, or lim
+ */
+static char	*skip_blanks(char *p, const char *lim)
+{
+	while (p < lim && (*p == ' ' || *p == '\t'))
+		p++;
+	return (p);
+}
+
+/**
+ * @brief Moves past one field: its leading blanks, then its non blanks
+ *
+ * Without -t the blanks before a field belong to it.
+ *
+ * @param p Start of the field
+ * @param lim End of the line
+ * @return Position of the first blank after the field, or lim
+ */
+static char	*skip_field(char *p, const char *lim)
+{
+	p = skip_blanks(p, lim);
+	while (p < lim && *p != ' ' && *p != '\t')
+		p++;
+	return (p);
+}
+
+/**
+ * @brief Moves to the end of the current field
+ *
+ * @param p Current position
+ * @param lim End of the line
+ * @param tab Separator byte, or -1 for blank separated fields
+ * @return Position of the separator (or blank) after the field, or lim
+ */
+static char	*field_end(char *p, const char *lim, int tab)
+{
+	if (tab < 0)
+		return (skip_field(p, lim));
+	while (p < lim && (unsigned char)*p != tab)
+		p++;
+	return (p);
+}
+
+/**
+ * @brief Finds where a key starts in a line, like sort's begfield()
+ *
+ * @param sort Sort options (for the separator)
+ * @param key Key definition
+ * @param line Line without its newline
+ * @return Start of the key, at most the end of the line
+ */
+char	*key_begin(const t_sort *sort, const t_sort_key *key,
+		const t_line *line)
+{
+	char	*p;
+	char	*lim;
+	size_t	word;
+
+	p = line->data;
+	lim = line->data + line->len;
+	word = key->sword;
+	while (p < lim && word > 0)
+	{
+		word--;
+		p = field_end(p, lim, sort->tab);
+		if (sort->tab >= 0 && p < lim)
+			p++;
+	}
+	if (key->flags & SK_BLANK_START)
+		p = skip_blanks(p, lim);
+	if ((size_t)(lim - p) < key->schar)
+		return (lim);
+	return (p + key->schar);
+}
+
+/**
+ * @brief Finds where a key ends in a line, like sort's limfield()
+ *
+ * A character offset of zero takes the whole end field; with -t the
+ * separator after it is not part of the key.
+ *
+ * @param sort Sort options (for the separator)
+ * @param key Key definition
+ * @param line Line without its newline
+ * @return End of the key (may come before its start)
+ */
+char	*key_limit(const t_sort *sort, const t_sort_key *key,
+		const t_line *line)
+{
+	char	*p;
+	char	*lim;
+	size_t	word;
+
+	p = line->data;
+	lim = line->data + line->len;
+	if (key->eword == SK_NONE)
+		return (lim);
+	word = key->eword + (key->echar == 0);
+	while (p < lim && word > 0)
+	{
+		word--;
+		p = field_end(p, lim, sort->tab);
+		if (sort->tab >= 0 && p < lim && (word || key->echar))
+			p++;
+	}
+	if (key->echar == 0)
+		return (p);
+	if (key->flags & SK_BLANK_END)
+		p = skip_blanks(p, lim);
+	if ((size_t)(lim - p) < key->echar)
+		return (lim);
+	return (p + key->echar);
+}
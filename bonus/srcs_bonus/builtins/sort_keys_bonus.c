@@ -0,0 +1,166 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sort_keys_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:40:35 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 13:40:35 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Parses the field or character number of a key position
+ *
+ * @param s Start of the number
+ * @param out Receives the number
+ * @return First character after the number, NULL if there is none
+ */
+static const char	*field_count(const char *s, size_t *out)
+{
+	size_t	n;
+
+	if (!ft_isdigit(*s))
+		return (NULL);
+	n = 0;
+	while (ft_isdigit(*s))
+	{
+		if (n > (SK_NONE - 9) / 10)
+			return (NULL);
+		n = n * 10 + (*s - '0');
+		s++;
+	}
+	*out = n;
+	return (s);
+}
+
+/**
+ * @brief Parses the ordering letters following a key position
+ *
+ * @param s Start of the letters
+ * @param key Key receiving the SK_* bits
+ * @param blank Bit set by 'b' (SK_BLANK_START or SK_BLANK_END)
+ * @return First character that is not a supported letter
+ */
+static const char	*key_ordering(const char *s, t_sort_key *key, int blank)
+{
+	while (*s == 'b' || *s == 'n' || *s == 'r')
+	{
+		if (*s == 'b')
+			key->flags |= blank;
+		else if (*s == 'n')
+			key->flags |= SK_NUMERIC;
+		else
+			key->flags |= SK_REVERSE;
+		s++;
+	}
+	return (s);
+}
+
+/**
+ * @brief Parses the optional ",F[.C][OPTS]" end of a key definition
+ *
+ * Without it the key runs to the end of the line; a character offset of
+ * zero means the end of the field.
+ *
+ * @param s Rest of the key definition
+ * @param key Key being defined
+ * @return 0 on success, -1 if the definition is not supported
+ */
+static int	key_end(const char *s, t_sort_key *key)
+{
+	key->eword = SK_NONE;
+	key->echar = 0;
+	if (*s == ',')
+	{
+		s = field_count(s + 1, &key->eword);
+		if (!s || key->eword == 0)
+			return (-1);
+		key->eword--;
+		if (*s == '.')
+		{
+			s = field_count(s + 1, &key->echar);
+			if (!s)
+				return (-1);
+		}
+		s = key_ordering(s, key, SK_BLANK_END);
+	}
+	if (*s)
+		return (-1);
+	return (0);
+}
+
+/**
+ * @brief Appends a -k F[.C][OPTS][,F[.C][OPTS]] key to the key list
+ *
+ * Positions are stored zero based, as sort does internally. Ordering
+ * letters other than b, n and r are left to the real sort.
+ *
+ * @param sort Sort options
+ * @param spec Key definition
+ * @return 0 on success, -1 if the key is not supported
+ */
+int	sort_add_key(t_sort *sort, const char *spec)
+{
+	t_sort_key	*keys;
+	t_sort_key	*key;
+	const char	*s;
+
+	keys = malloc(sizeof(t_sort_key) * (sort->nkeys + 1));
+	if (!keys)
+		return (-1);
+	if (sort->nkeys)
+		ft_memcpy(keys, sort->keys, sizeof(t_sort_key) * sort->nkeys);
+	free(sort->keys);
+	sort->keys = keys;
+	key = &keys[sort->nkeys++];
+	ft_bzero(key, sizeof(t_sort_key));
+	s = field_count(spec, &key->sword);
+	if (!s || key->sword == 0)
+		return (-1);
+	key->sword--;
+	if (*s == '.')
+	{
+		s = field_count(s + 1, &key->schar);
+		if (!s || key->schar == 0)
+			return (-1);
+		key->schar--;
+	}
+	return (key_end(key_ordering(s, key, SK_BLANK_START), key));
+}
+
+/**
+ * @brief Applies the global ordering options the way sort does
+ *
+ * Keys without any ordering letter inherit -b, -n and -r. Without keys,
+ * -b or -n make the whole line a key; -r alone only reverses the final
+ * whole-line comparison.
+ *
+ * @param sort Sort options
+ * @return 0 on success, -1 on allocation failure
+ */
+int	sort_inherit(t_sort *sort)
+{
+	int	i;
+
+	i = 0;
+	while (i < sort->nkeys)
+	{
+		if (!sort->keys[i].flags)
+			sort->keys[i].flags = sort->global.flags;
+		i++;
+	}
+	if (sort->nkeys == 0
+		&& (sort->global.flags & (SK_BLANK_START | SK_NUMERIC)))
+	{
+		sort->keys = malloc(sizeof(t_sort_key));
+		if (!sort->keys)
+			return (-1);
+		sort->keys[0] = sort->global;
+		sort->nkeys = 1;
+	}
+	return (0);
+}
@@ -0,0 +1,111 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sort_merge_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:40:35 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 13:40:35 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Prepares the merge state and its loser tree
+ *
+ * @param m Merge state to fill
+ * @param sort Sort options
+ * @param srcs Primed sources
+ * @param k Number of sources
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	merge_new(t_sort_merge *m, const t_sort *sort, t_sort_src *srcs,
+		int k)
+{
+	ft_memset(&m->last, 0, sizeof(t_buf));
+	m->sort = sort;
+	m->srcs = srcs;
+	m->k = k;
+	m->has_last = 0;
+	m->tree = malloc(sizeof(int) * k);
+	if (!m->tree)
+		return (-builtin_error("sort", "memory exhausted"));
+	loser_init(m);
+	return (0);
+}
+
+/**
+ * @brief Writes the winning line, dropping repeats under -u
+ *
+ * With -u only the first of a run of equal lines is written. A line from
+ * the batch stays put until the merge ends; one read back from a run is
+ * copied to m->last since the reader may move it.
+ *
+ * @param m Merge state
+ * @param src Source holding the line to write
+ * @return 0 on success, -1 on error
+ */
+static int	merge_emit(t_sort_merge *m, const t_sort_src *src)
+{
+	if (m->sort->flags & SORT_UNIQUE)
+	{
+		if (m->has_last && sort_compare(m->sort, &m->prev, &src->line) == 0)
+			return (0);
+		m->prev = src->line;
+		if (src->reader)
+		{
+			m->last.len = 0;
+			buf_append(&m->last, src->line.data, src->line.len);
+			if (m->last.failed)
+				return (-builtin_error("sort", "memory exhausted"));
+			m->prev.data = m->last.data;
+		}
+		m->has_last = 1;
+	}
+	if (out_write(&m->out, src->line.data, src->line.len) < 0
+		|| out_write(&m->out, "\n", 1) < 0)
+		return (-builtin_error("sort", "write failed"));
+	return (0);
+}
+
+/**
+ * @brief Merges sorted sources into fd through a loser tree
+ *
+ * Each output line costs log2(k) comparisons, whatever the number of
+ * sources.
+ *
+ * @param sort Sort options
+ * @param srcs Sources, each primed with src_next()
+ * @param k Number of sources
+ * @param fd Destination file descriptor
+ * @return 0 on success, -1 on error
+ */
+int	sort_merge(const t_sort *sort, t_sort_src *srcs, int k, int fd)
+{
+	t_sort_merge	m;
+	int				w;
+	int				ret;
+
+	if (k == 0)
+		return (0);
+	if (merge_new(&m, sort, srcs, k) < 0)
+		return (-1);
+	out_init(&m.out, fd);
+	ret = 0;
+	w = m.tree[0];
+	while (ret == 0 && !srcs[w].done)
+	{
+		ret = merge_emit(&m, &srcs[w]);
+		if (ret == 0 && src_next(&srcs[w]) < 0)
+			ret = -1;
+		loser_replay(&m, w);
+		w = m.tree[0];
+	}
+	if (ret == 0 && out_flush(&m.out) < 0)
+		ret = -builtin_error("sort", "write failed");
+	free(m.tree);
+	free(m.last.data);
+	return (ret);
+}
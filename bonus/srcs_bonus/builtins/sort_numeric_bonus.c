@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sort_numeric_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:40:35 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 13:40:35 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Splits the leading number of a key into sign, integer digits
+ * and fraction digits
+ *
+ * Leading blanks and zeros and trailing fraction zeros are dropped, so
+ * equal values get equal parts; no number at all, like -0, is zero.
+ *
+ * @param key Key text
+ * @param n Receives the parts
+ */
+static void	num_parse(const t_line *key, t_num *n)
+{
+	const char	*p;
+	const char	*end;
+
+	p = key->data;
+	end = key->data + key->len;
+	while (p < end && (*p == ' ' || *p == '\t'))
+		p++;
+	n->neg = (p < end && *p == '-');
+	p += n->neg;
+	while (p < end && *p == '0')
+		p++;
+	n->digits = p;
+	while (p < end && ft_isdigit(*p))
+		p++;
+	n->int_len = p - n->digits;
+	n->frac = p + (p < end && *p == '.');
+	n->frac_len = 0;
+	while (n->frac > p && n->frac + n->frac_len < end
+		&& ft_isdigit(n->frac[n->frac_len]))
+		n->frac_len++;
+	while (n->frac_len && n->frac[n->frac_len - 1] == '0')
+		n->frac_len--;
+	n->neg &= (n->int_len || n->frac_len);
+}
+
+/**
+ * @brief Compares the absolute values of two parsed numbers
+ *
+ * @param a First number
+ * @param b Second number
+ * @return Negative, zero or positive as |a| is below, equal to or above |b|
+ */
+static int	num_magnitude(const t_num *a, const t_num *b)
+{
+	size_t	len;
+	int		c;
+
+	if (a->int_len != b->int_len)
+		return ((a->int_len > b->int_len) * 2 - 1);
+	c = memcmp(a->digits, b->digits, a->int_len);
+	if (c)
+		return (c);
+	len = a->frac_len;
+	if (b->frac_len < len)
+		len = b->frac_len;
+	c = memcmp(a->frac, b->frac, len);
+	if (c)
+		return (c);
+	return ((a->frac_len > b->frac_len) - (a->frac_len < b->frac_len));
+}
+
+/**
+ * @brief Orders two keys by numeric value, like sort -n in the C locale
+ *
+ * Numbers are compared digit by digit, so their length is not limited;
+ * there is no thousands separator and the decimal point is '.'.
+ *
+ * @param a First key
+ * @param b Second key
+ * @return Negative, zero or positive as a sorts before, with or after b
+ */
+int	sort_numcmp(const t_line *a, const t_line *b)
+{
+	t_num	x;
+	t_num	y;
+	int		c;
+
+	num_parse(a, &x);
+	num_parse(b, &y);
+	if (x.neg != y.neg)
+		return (y.neg - x.neg);
+	c = num_magnitude(&x, &y);
+	if (x.neg)
+		return (-c);
+	return (c);
+}
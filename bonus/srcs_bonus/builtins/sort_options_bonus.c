@@ -0,0 +1,171 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sort_options_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:40:35 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 13:45:48 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Parses a -S buffer size ("512M", "64K", "100" meaning KiB)
+ *
+ * @param value Size as written on the command line
+ * @param budget Receives the size in bytes
+ * @return 0 on success, -1 if the size is not supported
+ */
+int	parse_size(const char *value, size_t *budget)
+{
+	const char	*unit;
+	size_t		n;
+	int			shift;
+	int			i;
+
+	n = 0;
+	i = 0;
+	while (ft_isdigit(value[i]) && n <= (SK_NONE - 9) / 10)
+		n = n * 10 + (value[i++] - '0');
+	shift = 10;
+	unit = NULL;
+	if (value[i])
+		unit = ft_strchr("bkKmMgGtT", value[i]);
+	if (unit)
+		shift = (unit - "bkKmMgGtT" + 1) / 2 * 10;
+	if (i == 0 || ft_isdigit(value[i]) || (value[i] && (!unit || value[i + 1]))
+		|| n > (SK_NONE >> shift))
+		return (-1);
+	*budget = n << shift;
+	return (0);
+}
+
+/**
+ * @brief Applies one option that takes no value
+ *
+ * @param sort Sort options
+ * @param c Option letter
+ * @return 0 on success, -1 if the option is not supported
+ */
+static int	sort_flag(t_sort *sort, char c)
+{
+	if (c == 'b')
+		sort->global.flags |= SK_BLANK_START | SK_BLANK_END;
+	else if (c == 'n')
+		sort->global.flags |= SK_NUMERIC;
+	else if (c == 'r')
+	{
+		sort->global.flags |= SK_REVERSE;
+		sort->flags |= SORT_REVERSE;
+	}
+	else if (c == 's')
+		sort->flags |= SORT_STABLE;
+	else if (c == 'u')
+		sort->flags |= SORT_UNIQUE;
+	else
+		return (-1);
+	return (0);
+}
+
+/**
+ * @brief Applies one option that takes a value (-k, -t, -S, -T,
+ * --parallel)
+ *
+ * @param sort Sort options
+ * @param opt Option letter ('P' for --parallel)
+ * @param value Option value
+ * @return 0 on success, -1 if the option is not supported
+ */
+static int	sort_value(t_sort *sort, char opt, const char *value)
+{
+	if (opt == 'k')
+		return (sort_add_key(sort, value));
+	if (opt == 't')
+	{
+		if (!value[0] || value[1]
+			|| (sort->tab >= 0 && sort->tab != (unsigned char)value[0]))
+			return (-1);
+		sort->tab = (unsigned char)value[0];
+		return (0);
+	}
+	if (opt == 'S')
+		return (parse_size(value, &sort->budget));
+	if (opt == 'P')
+		return (parse_count(value, 256, &sort->threads));
+	if (!value[0])
+		return (-1);
+	free(sort->tmpdir);
+	sort->tmpdir = ft_strdup(value);
+	return (-(sort->tmpdir == NULL));
+}
+
+/**
+ * @brief Parses one long option ("--key=2,2", "--unique", ...)
+ *
+ * @param sort Sort options
+ * @param argv Stage argument vector
+ * @param i Index of the option
+ * @return Number of arguments consumed, or 0 or -1 if not supported
+ */
+static int	sort_long(t_sort *sort, char **argv, int i)
+{
+	static const char	*names[] = {"unique", "reverse", "numeric-sort",
+		"stable", "ignore-leading-blanks", "key", "field-separator",
+		"buffer-size", "temporary-directory", "parallel", NULL};
+	const char			*arg;
+	size_t				len;
+	int					j;
+
+	arg = argv[i] + 2;
+	len = 0;
+	while (arg[len] && arg[len] != '=')
+		len++;
+	j = 0;
+	while (names[j] && (ft_strlen(names[j]) != len
+			|| ft_strncmp(names[j], arg, len) != 0))
+		j++;
+	if (!names[j] || (j < 5 && arg[len]))
+		return (-1);
+	if (j < 5)
+		return (sort_flag(sort, "urnsb"[j]) + 1);
+	if (arg[len])
+		return (sort_value(sort, "ktSTP"[j - 5], arg + len + 1) + 1);
+	if (!argv[i + 1] || sort_value(sort, "ktSTP"[j - 5], argv[i + 1]) < 0)
+		return (-1);
+	return (2);
+}
+
+/**
+ * @brief Parses one option cluster ("-nr", "-k2,2", "-t:") or long option
+ *
+ * @param sort Sort options
+ * @param argv Stage argument vector
+ * @param i Index of the option
+ * @return Number of arguments consumed, or 0 or -1 if not supported
+ */
+int	parse_sort_option(t_sort *sort, char **argv, int i)
+{
+	const char	*opt;
+
+	if (argv[i][1] == '-')
+		return (sort_long(sort, argv, i));
+	opt = argv[i] + 1;
+	while (*opt)
+	{
+		if (ft_strchr("ktST", *opt))
+		{
+			if (opt[1])
+				return (sort_value(sort, *opt, opt + 1) + 1);
+			if (!argv[i + 1] || sort_value(sort, *opt, argv[i + 1]) < 0)
+				return (-1);
+			return (2);
+		}
+		if (sort_flag(sort, *opt) < 0)
+			return (-1);
+		opt++;
+	}
+	return (1);
+}
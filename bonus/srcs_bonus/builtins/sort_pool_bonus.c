@@ -0,0 +1,179 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sort_pool_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:40:35 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 13:40:35 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Takes the next task from the front of a worker's own range
+ *
+ * A range is packed in one word (first task in the high half, end in the
+ * low half) so that the owner and thieves can update it with a single
+ * compare-and-swap.
+ *
+ * @param w Worker
+ * @return Task index, or -1 if the range is empty
+ */
+static int	take_task(t_sort_worker *w)
+{
+	unsigned long	r;
+
+	r = __atomic_load_n(&w->range, __ATOMIC_ACQUIRE);
+	while ((r >> 32) < (r & 0xFFFFFFFFUL))
+	{
+		if (__atomic_compare_exchange_n(&w->range, &r, r + (1UL << 32), 0,
+				__ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+			return ((int)(r >> 32));
+	}
+	return (-1);
+}
+
+/**
+ * @brief Steals the back half of another worker's range
+ *
+ * The first stolen task is returned, the rest becomes the thief's own
+ * range.
+ *
+ * @param pool Worker pool
+ * @param thief Worker looking for work
+ * @return Task index, or -1 if every range is empty
+ */
+static int	steal_task(t_sort_pool *pool, t_sort_worker *thief)
+{
+	t_sort_worker	*v;
+	unsigned long	r;
+	unsigned long	mid;
+	int				i;
+
+	i = 0;
+	while (i < pool->count)
+	{
+		v = &pool->workers[i];
+		r = __atomic_load_n(&v->range, __ATOMIC_ACQUIRE);
+		mid = (r >> 32) + ((r & 0xFFFFFFFFUL) - (r >> 32)) / 2;
+		if (v == thief || (r >> 32) >= (r & 0xFFFFFFFFUL))
+			i++;
+		else if (__atomic_compare_exchange_n(&v->range, &r,
+				(r & ~0xFFFFFFFFUL) | mid, 0, __ATOMIC_ACQ_REL,
+				__ATOMIC_ACQUIRE))
+		{
+			__atomic_store_n(&thief->range,
+				(mid + 1) << 32 | (r & 0xFFFFFFFFUL), __ATOMIC_RELEASE);
+			return ((int)mid);
+		}
+	}
+	return (-1);
+}
+
+/**
+ * @brief Sorts chunks until neither its own range nor any other has one
+ * left
+ *
+ * @param arg The worker
+ * @return NULL
+ */
+static void	*sort_worker(void *arg)
+{
+	t_sort_worker	*w;
+	t_sort_pool		*p;
+	int				task;
+
+	w = arg;
+	p = w->pool;
+	task = take_task(w);
+	if (task < 0)
+		task = steal_task(p, w);
+	while (task >= 0)
+	{
+		sort_chunk(p->sort, p->recs + p->bounds[task],
+			p->tmp + p->bounds[task],
+			p->bounds[task + 1] - p->bounds[task]);
+		task = take_task(w);
+		if (task < 0)
+			task = steal_task(p, w);
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Allocates the pool and deals the chunks out in equal ranges
+ *
+ * @param pool Pool to set up
+ * @param run Sort run holding the batch and its chunk bounds
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	pool_init(t_sort_pool *pool, t_sort_run *run)
+{
+	int	w;
+
+	pool->sort = run->sort;
+	pool->recs = run->batch.recs;
+	pool->bounds = run->bounds;
+	pool->count = run->threads;
+	if (pool->count > run->tasks)
+		pool->count = run->tasks;
+	pool->tmp = malloc(sizeof(t_sort_rec) * run->batch.n);
+	pool->workers = malloc(sizeof(t_sort_worker) * pool->count);
+	if (!pool->tmp || !pool->workers)
+	{
+		free(pool->tmp);
+		free(pool->workers);
+		return (-builtin_error("sort", "memory exhausted"));
+	}
+	w = 0;
+	while (w < pool->count)
+	{
+		pool->workers[w].range = ((unsigned long)run->tasks * w / pool->count)
+			<< 32 | (unsigned long)run->tasks * (w + 1) / pool->count;
+		pool->workers[w].pool = pool;
+		w++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Sorts the chunks of the batch on a work-stealing thread pool
+ *
+ * Each worker starts on its own range of chunks and, once it runs dry,
+ * steals the back half of another worker's range, so chunks that take
+ * longer (many equal keys, long lines) do not leave the other cores
+ * idle. The calling thread is worker 0; the range of a thread that
+ * cannot be started is simply stolen.
+ *
+ * @param run Sort run whose batch is split by run->bounds
+ * @return 0 on success, -1 on allocation failure
+ */
+int	sort_parallel(t_sort_run *run)
+{
+	t_sort_pool		pool;
+	int				w;
+
+	if (pool_init(&pool, run) < 0)
+		return (-1);
+	w = 1;
+	while (w < pool.count)
+	{
+		pool.workers[w].started = (pthread_create(&pool.workers[w].thread,
+					NULL, sort_worker, &pool.workers[w]) == 0);
+		w++;
+	}
+	sort_worker(&pool.workers[0]);
+	w = 1;
+	while (w < pool.count)
+	{
+		if (pool.workers[w].started)
+			pthread_join(pool.workers[w].thread, NULL);
+		w++;
+	}
+	free(pool.tmp);
+	free(pool.workers);
+	return (0);
+}
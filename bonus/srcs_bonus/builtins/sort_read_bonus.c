@@ -0,0 +1,183 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sort_read_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:40:35 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:45:04 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Appends a record for one line to the batch
+ *
+ * @param run Sort run
+ * @param data Line, inside one of the batch chunks
+ * @param len Length of the line, without its newline
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	batch_push(t_sort_run *run, char *data, size_t len)
+{
+	t_sort_batch	*b;
+	t_sort_rec		*grown;
+	size_t			cap;
+
+	b = &run->batch;
+	if (b->n == b->cap)
+	{
+		cap = b->cap * 2 + 4096;
+		grown = malloc(sizeof(t_sort_rec) * cap);
+		if (!grown)
+			return (-builtin_error("sort", "memory exhausted"));
+		if (b->n)
+			ft_memcpy(grown, b->recs, sizeof(t_sort_rec) * b->n);
+		free(b->recs);
+		b->recs = grown;
+		b->cap = cap;
+	}
+	sort_rec_init(run->sort, &b->recs[b->n], data, len);
+	b->n++;
+	return (0);
+}
+
+/**
+ * @brief Hands a new chunk to the batch
+ *
+ * A current chunk that holds no complete line (a single line longer than
+ * it) is only a copy of the partial line and is dropped.
+ *
+ * @param run Sort run
+ * @param chunk New chunk
+ * @param size Size of the new chunk
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	push_chunk(t_sort_run *run, char *chunk, size_t size)
+{
+	t_sort_batch	*b;
+	char			**grown;
+
+	b = &run->batch;
+	if (b->nchunks == b->chunks_cap)
+	{
+		grown = malloc(sizeof(char *) * (b->chunks_cap * 2 + 16));
+		if (!grown)
+			return (-1);
+		if (b->nchunks)
+			ft_memcpy(grown, b->chunks, sizeof(char *) * b->nchunks);
+		free(b->chunks);
+		b->chunks = grown;
+		b->chunks_cap = b->chunks_cap * 2 + 16;
+	}
+	if (run->buf && run->start == 0)
+	{
+		b->nchunks--;
+		free(b->chunks[b->nchunks]);
+		b->bytes -= run->size;
+	}
+	b->chunks[b->nchunks] = chunk;
+	b->nchunks++;
+	b->bytes += size;
+	return (0);
+}
+
+/**
+ * @brief Starts a new chunk once the current one is full
+ *
+ * The partial line at the end of the current chunk is carried over; the
+ * chunk grows until it can hold twice that line.
+ *
+ * @param run Sort run
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	refill(t_sort_run *run)
+{
+	char	*chunk;
+	size_t	partial;
+	size_t	size;
+
+	partial = run->used - run->start;
+	size = run->chunk;
+	while (size < partial * 2)
+		size *= 2;
+	chunk = malloc(size);
+	if (chunk && partial)
+		ft_memcpy(chunk, run->buf + run->start, partial);
+	if (!chunk || push_chunk(run, chunk, size) < 0)
+	{
+		free(chunk);
+		return (-builtin_error("sort", "memory exhausted"));
+	}
+	run->buf = chunk;
+	run->size = size;
+	run->used = partial;
+	run->start = 0;
+	return (0);
+}
+
+/**
+ * @brief Records every line completed by the bytes just read
+ *
+ * @param run Sort run
+ * @param from Offset of the first byte just read
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	scan_lines(t_sort_run *run, size_t from)
+{
+	char	*end;
+	char	*nl;
+
+	end = run->buf + run->used;
+	nl = memchr(run->buf + from, '\n', end - (run->buf + from));
+	while (nl)
+	{
+		if (batch_push(run, run->buf + run->start,
+				nl - (run->buf + run->start)) < 0)
+			return (-1);
+		run->start = nl + 1 - run->buf;
+		nl = memchr(nl + 1, '\n', end - (nl + 1));
+	}
+	return (0);
+}
+
+/**
+ * @brief Reads input in large blocks into the batch
+ *
+ * Lines stay where they were read; the batch only records where they
+ * are. Reading stops when the chunks and the record arrays (the records
+ * and the merge buffer of the same size) reach the memory budget.
+ *
+ * @param run Sort run
+ * @return 1 if the batch is full, 0 at end of input, -1 on error
+ */
+int	sort_read(t_sort_run *run)
+{
+	ssize_t	n;
+
+	n = 1;
+	while (n > 0)
+	{
+		if (run->batch.n > 0 && run->batch.bytes + run->batch.cap * 2
+			* sizeof(t_sort_rec) >= run->budget)
+			return (1);
+		if (run->used == run->size && refill(run) < 0)
+			return (-1);
+		n = io_read(run->fd, run->buf + run->used, run->size - run->used);
+		while (n < 0 && errno == EINTR)
+			n = io_read(run->fd, run->buf + run->used, run->size - run->used);
+		if (n < 0)
+			return (-builtin_error("sort", "read failed"));
+		run->used += n;
+		if (n > 0 && scan_lines(run, run->used - n) < 0)
+			return (-1);
+	}
+	run->eof = 1;
+	if (run->start < run->used && batch_push(run, run->buf + run->start,
+			run->used - run->start) < 0)
+		return (-1);
+	run->start = run->used;
+	return (0);
+}
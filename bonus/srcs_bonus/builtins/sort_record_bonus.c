@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sort_record_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:40:35 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 13:40:35 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Packs the first 8 bytes of a text, big endian and zero padded
+ *
+ * Two texts with different prefixes compare like their prefixes, which
+ * avoids touching the line data in most comparisons.
+ *
+ * @param data Text
+ * @param len Length of the text
+ * @return The prefix
+ */
+uint64_t	sort_prefix(const char *data, size_t len)
+{
+	uint64_t	prefix;
+	size_t		i;
+
+	prefix = 0;
+	i = 0;
+	while (i < 8)
+	{
+		prefix <<= 8;
+		if (i < len)
+			prefix |= (unsigned char)data[i];
+		i++;
+	}
+	return (prefix);
+}
+
+/**
+ * @brief Fills the record of a line read into the batch
+ *
+ * With keys, the text of the first key is located once here, as sort
+ * does, instead of on every comparison; the prefix then comes from that
+ * key, unless it is numeric.
+ *
+ * @param sort Sort options
+ * @param rec Record to fill
+ * @param data Line
+ * @param len Length of the line, without its newline
+ */
+void	sort_rec_init(const t_sort *sort, t_sort_rec *rec, char *data,
+		size_t len)
+{
+	rec->line.data = data;
+	rec->line.len = len;
+	rec->key = rec->line;
+	if (sort->nkeys)
+		key_span(sort, &sort->keys[0], &rec->line, &rec->key);
+	rec->prefix = 0;
+	if (!sort->nkeys || !(sort->keys[0].flags & SK_NUMERIC))
+		rec->prefix = sort_prefix(rec->key.data, rec->key.len);
+}
+
+/**
+ * @brief Orders two records, through their prefixes when they differ
+ *
+ * @param sort Sort options
+ * @param a First record
+ * @param b Second record
+ * @return Negative, zero or positive as a sorts before, with or after b
+ */
+int	sort_rec_cmp(const t_sort *sort, const t_sort_rec *a,
+		const t_sort_rec *b)
+{
+	int	diff;
+
+	if (a->prefix != b->prefix)
+	{
+		diff = (a->prefix > b->prefix) * 2 - 1;
+		if ((!sort->nkeys && (sort->flags & SORT_REVERSE))
+			|| (sort->nkeys && (sort->keys[0].flags & SK_REVERSE)))
+			return (-diff);
+		return (diff);
+	}
+	if (!sort->nkeys)
+		return (sort_compare(sort, &a->line, &b->line));
+	diff = key_cmp(&sort->keys[0], &a->key, &b->key);
+	if (diff)
+		return (diff);
+	return (sort_compare_from(sort, &a->line, &b->line, 1));
+}
@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sort_spill_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:40:35 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 13:45:48 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Opens an anonymous temporary file for a spilled run
+ *
+ * The file lives in dir, else $TMPDIR or /tmp. O_TMPFILE leaves
+ * nothing behind even if the stage is killed; file systems without it
+ * get a mkstemp() file that is unlinked right away.
+ *
+ * @param dir Directory given with -T, or NULL
+ * @return File descriptor open for reading and writing, -1 on error
+ */
+int	open_tmpfile(const char *dir)
+{
+	t_buf	path;
+	int		fd;
+
+	if (!dir)
+		dir = getenv("TMPDIR");
+	if (!dir || !dir[0])
+		dir = "/tmp";
+	fd = open(dir, O_TMPFILE | O_RDWR, 0600);
+	if (fd >= 0 || (errno != EOPNOTSUPP && errno != EISDIR
+			&& errno != EINVAL))
+		return (fd);
+	ft_memset(&path, 0, sizeof(t_buf));
+	buf_puts(&path, dir);
+	buf_append(&path, "/pipexsortXXXXXX", 17);
+	fd = -1;
+	if (!path.failed)
+		fd = mkstemp(path.data);
+	if (fd >= 0)
+		unlink(path.data);
+	free(path.data);
+	return (fd);
+}
+
+/**
+ * @brief Merges the sorted chunks, and optionally the runs, into fd
+ *
+ * @param run Sort run, sorted by sort_batch()
+ * @param with_runs Whether the spilled runs take part
+ * @param fd Destination file descriptor
+ * @return 0 on success, -1 on error
+ */
+static int	merge_to(t_sort_run *run, int with_runs, int fd)
+{
+	t_sort_src	*srcs;
+	int			k;
+	int			ret;
+
+	srcs = sort_sources(run, with_runs, &k);
+	if (!srcs)
+		return (-1);
+	ret = sort_merge(run->sort, srcs, k, fd);
+	free(srcs);
+	return (ret);
+}
+
+/**
+ * @brief Writes the batch out as a new sorted run
+ *
+ * An empty batch means the runs themselves are being merged.
+ *
+ * @param run Sort run
+ * @return File descriptor of the run, rewound, or -1 on error
+ */
+static int	spill_run(t_sort_run *run)
+{
+	int	fd;
+
+	fd = open_tmpfile(run->sort->tmpdir);
+	if (fd < 0)
+		return (-builtin_error("sort", "cannot create temporary file"));
+	if (merge_to(run, run->tasks == 0, fd) < 0)
+	{
+		close(fd);
+		return (-1);
+	}
+	if (lseek(fd, 0, SEEK_SET) < 0)
+	{
+		close(fd);
+		return (-builtin_error("sort", "temporary file"));
+	}
+	return (fd);
+}
+
+/**
+ * @brief Spills the full batch to a temporary run
+ *
+ * When SORT_MAX_RUNS runs have piled up, spilling again with an empty
+ * batch merges them into one, so the final merge never holds more than
+ * that many files open.
+ *
+ * @param run Sort run whose batch reached the memory budget
+ * @return 0 on success, -1 on error
+ */
+int	sort_spill(t_sort_run *run)
+{
+	int	fd;
+
+	if (sort_batch(run) < 0)
+		return (-1);
+	fd = spill_run(run);
+	if (fd < 0)
+		return (-1);
+	while (run->tasks == 0 && run->nruns > 0)
+	{
+		run->nruns--;
+		close(run->runs[run->nruns].fd);
+		reader_free(&run->runs[run->nruns]);
+	}
+	if (reader_init(&run->runs[run->nruns], fd) < 0)
+	{
+		close(fd);
+		return (-builtin_error("sort", "memory exhausted"));
+	}
+	run->nruns++;
+	sort_reset(run);
+	if (run->nruns == SORT_MAX_RUNS)
+		return (sort_spill(run));
+	return (0);
+}
+
+/**
+ * @brief Sorts what is left and merges it with the runs into out_fd
+ *
+ * @param run Sort run at end of input
+ * @param out_fd Destination file descriptor
+ * @return 0 on success, -1 on error
+ */
+int	sort_finish(t_sort_run *run, int out_fd)
+{
+	if (sort_batch(run) < 0)
+		return (-1);
+	return (merge_to(run, 1, out_fd));
+}
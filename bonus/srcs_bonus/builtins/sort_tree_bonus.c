@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sort_tree_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:40:35 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 13:40:35 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Advances a merge source to its next line
+ *
+ * A source is either a sorted slice of the in-memory batch or a spilled
+ * run read back through a line reader.
+ *
+ * @param src Merge source
+ * @return 1 if src->line holds a line, 0 once the source is exhausted,
+ * -1 on read error
+ */
+int	src_next(t_sort_src *src)
+{
+	int	ret;
+
+	if (src->done)
+		return (0);
+	if (src->reader)
+	{
+		ret = next_line(src->reader, &src->line.data, &src->line.len);
+		if (ret < 0)
+			return (-builtin_error("sort", "read failed"));
+		src->done = (ret == 0);
+		return (ret);
+	}
+	src->done = (src->rec == src->end);
+	if (src->done)
+		return (0);
+	src->line = src->rec->line;
+	src->rec++;
+	return (1);
+}
+
+/**
+ * @brief Tells whether source a beats source b
+ *
+ * An exhausted source always loses; equal lines go to the lower index so
+ * that the merge stays stable.
+ *
+ * @param m Merge state
+ * @param a First source index
+ * @param b Second source index
+ * @return 1 if a comes out first, 0 otherwise
+ */
+static int	src_wins(t_sort_merge *m, int a, int b)
+{
+	int	diff;
+
+	if (m->srcs[b].done)
+		return (1);
+	if (m->srcs[a].done)
+		return (0);
+	diff = sort_compare(m->sort, &m->srcs[a].line, &m->srcs[b].line);
+	return (diff < 0 || (diff == 0 && a < b));
+}
+
+/**
+ * @brief Plays the matches below a node, storing each loser
+ *
+ * Node n has children 2n and 2n + 1; index k + i stands for source i.
+ *
+ * @param m Merge state
+ * @param node Internal node (1 to k - 1) or leaf (k to 2k - 1)
+ * @return The winner below node
+ */
+static int	loser_build(t_sort_merge *m, int node)
+{
+	int	left;
+	int	right;
+
+	if (node >= m->k)
+		return (node - m->k);
+	left = loser_build(m, node * 2);
+	right = loser_build(m, node * 2 + 1);
+	if (src_wins(m, left, right))
+	{
+		m->tree[node] = right;
+		return (left);
+	}
+	m->tree[node] = left;
+	return (right);
+}
+
+/**
+ * @brief Builds the loser tree over the primed sources
+ *
+ * tree[0] holds the overall winner.
+ *
+ * @param m Merge state with tree sized for 2k entries
+ */
+void	loser_init(t_sort_merge *m)
+{
+	m->tree[0] = loser_build(m, 1);
+}
+
+/**
+ * @brief Replays the matches on the path of a leaf after it advanced
+ *
+ * Only the log2(k) stored losers on the way to the root are compared
+ * against, one comparison per level.
+ *
+ * @param m Merge state
+ * @param leaf Source that just moved to its next line
+ */
+void	loser_replay(t_sort_merge *m, int leaf)
+{
+	int	winner;
+	int	node;
+	int	tmp;
+
+	winner = leaf;
+	node = (leaf + m->k) / 2;
+	while (node > 0)
+	{
+		if (src_wins(m, m->tree[node], winner))
+		{
+			tmp = m->tree[node];
+			m->tree[node] = winner;
+			winner = tmp;
+		}
+		node /= 2;
+	}
+	m->tree[0] = winner;
+}
@@ -0,0 +1,153 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   topk_heap_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:34:44 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:27:30 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Tells whether record a comes after record b in the output order
+ *
+ * Records the sort options find equal (with -s) keep their input order,
+ * as in a stable sort.
+ *
+ * @param topk Heap (for the sort options)
+ * @param a First record
+ * @param b Second record
+ * @return 1 if a sorts after b, 0 otherwise
+ */
+static int	after(t_topk *topk, const t_topk_rec *a, const t_topk_rec *b)
+{
+	int	c;
+
+	c = sort_rec_cmp(&topk->sort, &a->rec, &b->rec);
+	if (c == 0)
+		return (a->seq > b->seq);
+	return (c > 0);
+}
+
+/**
+ * @brief Restores the heap order below i (the last line sits at the root)
+ *
+ * @param topk Heap
+ * @param i Index of the line to move down
+ * @param n Number of lines in the heap
+ */
+void	topk_sift_down(t_topk *topk, size_t i, size_t n)
+{
+	t_topk_rec	tmp;
+	size_t	child;
+
+	while (2 * i + 1 < n)
+	{
+		child = 2 * i + 1;
+		if (child + 1 < n
+			&& after(topk, &topk->recs[child + 1], &topk->recs[child]))
+			child++;
+		if (!after(topk, &topk->recs[child], &topk->recs[i]))
+			return ;
+		tmp = topk->recs[i];
+		topk->recs[i] = topk->recs[child];
+		topk->recs[child] = tmp;
+		i = child;
+	}
+}
+
+/**
+ * @brief Restores the heap order above i
+ *
+ * @param topk Heap
+ * @param i Index of the line to move up
+ */
+static void	sift_up(t_topk *topk, size_t i)
+{
+	t_topk_rec	tmp;
+	size_t	parent;
+
+	while (i > 0)
+	{
+		parent = (i - 1) / 2;
+		if (!after(topk, &topk->recs[i], &topk->recs[parent]))
+			return ;
+		tmp = topk->recs[i];
+		topk->recs[i] = topk->recs[parent];
+		topk->recs[parent] = tmp;
+		i = parent;
+	}
+}
+
+/**
+ * @brief Doubles the heap storage, never beyond k lines
+ *
+ * @param topk Heap
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	grow(t_topk *topk)
+{
+	t_topk_rec	*recs;
+	size_t		cap;
+
+	cap = topk->cap * 2;
+	if (cap < 64)
+		cap = 64;
+	if (cap > topk->k)
+		cap = topk->k;
+	recs = malloc(sizeof(t_topk_rec) * cap);
+	if (!recs)
+		return (-1);
+	if (topk->len)
+		memcpy(recs, topk->recs, sizeof(t_topk_rec) * topk->len);
+	free(topk->recs);
+	topk->recs = recs;
+	topk->cap = cap;
+	return (0);
+}
+
+/**
+ * @brief Offers one input line to the bounded heap
+ *
+ * The root is the line that would be output last; once k lines are kept
+ * a new line only gets in (and evicts the root) if it comes before it.
+ * Lines are compared as records of the sort builtin, so once the heap is
+ * full most of them are turned away on the key prefix alone.
+ *
+ * @param topk Heap
+ * @param line Line (copied if kept)
+ * @param len Length of the line
+ * @return 0 on success, -1 on allocation failure
+ */
+int	topk_offer(t_topk *topk, const char *line, size_t len)
+{
+	t_topk_rec	candidate;
+	char		*data;
+
+	sort_rec_init(&topk->sort, &candidate.rec, (char *)line, len);
+	candidate.seq = topk->seq++;
+	if (topk->len == topk->k)
+	{
+		if (topk->k == 0 || !after(topk, &topk->recs[0], &candidate))
+			return (0);
+		free(topk->recs[0].rec.line.data);
+		topk->len--;
+		topk->recs[0] = topk->recs[topk->len];
+		topk_sift_down(topk, 0, topk->len);
+	}
+	if (topk->len == topk->cap && grow(topk) < 0)
+		return (-1);
+	data = malloc(len + 1);
+	if (!data)
+		return (-1);
+	memcpy(data, line, len);
+	sort_rec_init(&topk->sort, &candidate.rec, data, len);
+	topk->recs[topk->len] = candidate;
+	sift_up(topk, topk->len);
+	topk->len++;
+	return (0);
+}
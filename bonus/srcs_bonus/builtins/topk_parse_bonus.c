@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   topk_parse_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:27:30 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:27:30 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Parses "@topk K [sort options]"
+ *
+ * The options are those of the sort builtin (-b, -n, -r, -s, -k, -t and
+ * the ignored tuning options); -u is not, since it would keep fewer lines.
+ *
+ * @param argv Stage argument vector
+ * @param topk Receives k and the sort options (zeroed by the caller)
+ * @return 0 on success, -1 on malformed arguments
+ */
+int	parse_topk(char **argv, t_topk *topk)
+{
+	int	k;
+	int	used;
+	int	i;
+
+	if (!argv[1] || parse_count(argv[1], INT_MAX, &k) < 0)
+		return (-1);
+	topk->k = k;
+	topk->sort.tab = -1;
+	topk->sort.global.eword = SK_NONE;
+	i = 2;
+	while (argv[i])
+	{
+		if (argv[i][0] != '-' || !argv[i][1])
+			return (-1);
+		used = parse_sort_option(&topk->sort, argv, i);
+		if (used <= 0)
+			return (-1);
+		i += used;
+	}
+	if (topk->sort.flags & SORT_UNIQUE)
+		return (-1);
+	return (sort_inherit(&topk->sort));
+}
+
+/**
+ * @brief Frees the state built by match_topk()
+ *
+ * @param state t_topk to free
+ */
+void	free_topk(void *state)
+{
+	t_topk	*topk;
+
+	topk = state;
+	free(topk->sort.keys);
+	free(topk->sort.tmpdir);
+	free(topk);
+}
+
+/**
+ * @brief Accepts a well formed @topk stage
+ *
+ * @param stage Stage whose argv is examined; its state becomes the t_topk
+ * @return 1 on match, 0 otherwise
+ */
+int	match_topk(t_stage *stage)
+{
+	t_topk	*topk;
+
+	topk = ft_calloc(1, sizeof(t_topk));
+	if (!topk)
+		return (0);
+	if (parse_topk(stage->argv, topk) < 0)
+	{
+		free_topk(topk);
+		return (0);
+	}
+	stage->state = topk;
+	return (1);
+}
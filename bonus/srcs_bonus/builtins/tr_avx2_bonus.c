@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tr_avx2_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:58:52 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:58:52 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+
+# include <immintrin.h>
+
+/**
+ * @brief Translates one 32 byte block with nibble shuffles (AVX2)
+ *
+ * Each byte's low nibble indexes a 16 entry row of the table with
+ * vpshufb; the row is blended in where the high nibble selects it. Only
+ * rows that differ from the identity are visited.
+ *
+ * @param rows Table rows, each broadcast to both lanes
+ * @param his High nibble of each row
+ * @param n Number of rows
+ * @param p Start of the block, translated in place
+ */
+__attribute__((target("avx2")))
+static void	tr_block_avx2(const __m256i *rows, const __m256i *his, int n,
+		unsigned char *p)
+{
+	__m256i	v;
+	__m256i	lo;
+	__m256i	hi;
+	__m256i	out;
+	int		k;
+
+	v = _mm256_loadu_si256((const __m256i *)p);
+	lo = _mm256_and_si256(v, _mm256_set1_epi8(0x0F));
+	hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0F));
+	out = v;
+	k = 0;
+	while (k < n)
+	{
+		out = _mm256_blendv_epi8(out, _mm256_shuffle_epi8(rows[k], lo),
+				_mm256_cmpeq_epi8(hi, his[k]));
+		k++;
+	}
+	_mm256_storeu_si256((__m256i *)p, out);
+}
+
+/**
+ * @brief Translates a block in place 32 bytes at a time (AVX2)
+ *
+ * @param tr Compiled tr
+ * @param p Block
+ * @param len Size of the block
+ */
+__attribute__((target("avx2")))
+void	tr_translate_avx2(const t_tr *tr, unsigned char *p, size_t len)
+{
+	__m256i	rows[16];
+	__m256i	his[16];
+	size_t	i;
+	int		n;
+	int		k;
+
+	n = 0;
+	k = -1;
+	while (++k < 16)
+	{
+		if (!(tr->dirty & (1 << k)))
+			continue ;
+		rows[n] = _mm256_broadcastsi128_si256(
+				_mm_loadu_si128((const __m128i *)(tr->map + 16 * k)));
+		his[n++] = _mm256_set1_epi8(k);
+	}
+	i = 0;
+	while (i + 32 <= len)
+	{
+		tr_block_avx2(rows, his, n, p + i);
+		i += 32;
+	}
+	tr_translate_scalar(tr, p + i, len - i);
+}
+
+#else
+
+/**
+ * @brief AVX2 is x86 only; translates with the scalar kernel
+ *
+ * @param tr Compiled tr
+ * @param p Block
+ * @param len Size of the block
+ */
+void	tr_translate_avx2(const t_tr *tr, unsigned char *p, size_t len)
+{
+	tr_translate_scalar(tr, p, len);
+}
+
+#endif
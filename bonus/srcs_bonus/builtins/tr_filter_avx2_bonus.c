@@ -0,0 +1,171 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tr_filter_avx2_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:58:52 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:58:52 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+
+# include <immintrin.h>
+
+/**
+ * @brief Tests 32 bytes for membership in a set stored as nibble bitmaps
+ *
+ * The low nibble picks a bitmap byte (from the first or second half of
+ * the bitmap depending on the top bit), the high nibble picks its bit.
+ *
+ * @param v Input bytes
+ * @param bits Set bitmap, see tr_members()
+ * @return 0xFF in every member byte, 0 elsewhere
+ */
+__attribute__((target("avx2")))
+static __m256i	member_avx2(__m256i v, const unsigned char *bits)
+{
+	static const unsigned char	bit_of[16] = {1, 2, 4, 8, 16, 32, 64, 128,
+		1, 2, 4, 8, 16, 32, 64, 128};
+	__m256i						lo;
+	__m256i						row;
+	__m256i						bit;
+
+	lo = _mm256_and_si256(v, _mm256_set1_epi8(0x0F));
+	row = _mm256_blendv_epi8(
+			_mm256_shuffle_epi8(_mm256_broadcastsi128_si256(
+					_mm_loadu_si128((const __m128i *)bits)), lo),
+			_mm256_shuffle_epi8(_mm256_broadcastsi128_si256(
+					_mm_loadu_si128((const __m128i *)(bits + 16))), lo), v);
+	bit = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(
+				_mm_loadu_si128((const __m128i *)bit_of)),
+			_mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0F)));
+	return (_mm256_cmpeq_epi8(_mm256_and_si256(row, bit), bit));
+}
+
+/**
+ * @brief Flags the bytes of a block that -d or -s drops
+ *
+ * -d drops the members of set 1. -s (without translation) drops a member
+ * equal to the byte before it, which is the last byte written since the
+ * bytes dropped before it had the same value.
+ *
+ * @param tr Compiled tr
+ * @param v Block
+ * @param prev Previous block (only its last byte is used)
+ * @return One bit per dropped byte
+ */
+__attribute__((target("avx2")))
+static unsigned int	drop_mask(const t_tr *tr, __m256i v, __m256i prev)
+{
+	__m256i	before;
+
+	if (tr->flags & TR_DELETE)
+		return (_mm256_movemask_epi8(member_avx2(v, tr->del_bits)));
+	before = _mm256_alignr_epi8(v, _mm256_permute2x128_si256(prev, v, 0x21),
+			15);
+	return (_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(v,
+					before), member_avx2(v, tr->squeeze_bits))));
+}
+
+/**
+ * @brief Writes the kept bytes of a block at the output position
+ *
+ * Each 8 byte group is packed with pext; the output never passes the
+ * input already loaded, so the block can be compacted in place.
+ *
+ * @param out Output position
+ * @param v Block
+ * @param drop One bit per dropped byte
+ * @return Number of bytes written
+ */
+__attribute__((target("avx2,bmi2,popcnt")))
+static size_t	compact_avx2(unsigned char *out, __m256i v, unsigned int drop)
+{
+	unsigned long	words[4];
+	unsigned long	keep;
+	unsigned long	word;
+	size_t			n;
+	int				g;
+
+	_mm256_storeu_si256((__m256i *)words, v);
+	if (drop == 0)
+	{
+		memcpy(out, words, 32);
+		return (32);
+	}
+	n = 0;
+	g = -1;
+	while (++g < 4)
+	{
+		keep = _pdep_u64(~drop >> (8 * g) & 0xFF, 0x0101010101010101UL)
+			* 0xFF;
+		word = _pext_u64(words[g], keep);
+		memcpy(out + n, &word, 8);
+		n += __builtin_popcountl(keep) / 8;
+	}
+	return (n);
+}
+
+/**
+ * @brief Runs -d alone, or -s alone without translation, 32 bytes at a
+ * time (AVX2 + BMI2)
+ *
+ * @param tr Compiled tr
+ * @param p Block, compacted in place
+ * @param len Size of the block
+ * @param last Last byte written so far (-1 before any), updated
+ * @return Size of the output left at the start of the block
+ */
+__attribute__((target("avx2,bmi2,popcnt")))
+size_t	tr_filter_avx2(const t_tr *tr, unsigned char *p, size_t len,
+		int *last)
+{
+	__m256i			prev;
+	__m256i			v;
+	unsigned int	drop;
+	size_t			i;
+	size_t			j;
+
+	prev = _mm256_set1_epi8((char)*last);
+	i = 0;
+	j = 0;
+	while (i + 32 <= len)
+	{
+		v = _mm256_loadu_si256((const __m256i *)(p + i));
+		drop = drop_mask(tr, v, prev);
+		if (*last < 0 && i == 0 && !(tr->flags & TR_DELETE))
+			drop &= ~1u;
+		j += compact_avx2(p + j, v, drop);
+		prev = v;
+		i += 32;
+	}
+	if (i > 0 && !(tr->flags & TR_DELETE))
+		*last = (unsigned char)_mm256_extract_epi8(prev, 31);
+	len = tr_filter_scalar(tr, p + i, len - i, last);
+	memmove(p + j, p + i, len);
+	return (j + len);
+}
+
+#else
+
+/**
+ * @brief AVX2 is x86 only; filters with the scalar kernel
+ *
+ * @param tr Compiled tr
+ * @param p Block
+ * @param len Size of the block
+ * @param last Squeeze state, updated
+ * @return Size of the output left at the start of the block
+ */
+size_t	tr_filter_avx2(const t_tr *tr, unsigned char *p, size_t len,
+		int *last)
+{
+	return (tr_filter_scalar(tr, p, len, last));
+}
+
+#endif
@@ -0,0 +1,173 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tr_parse_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:58:52 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:58:52 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Parses one tr option ("-ds", "--delete", ...)
+ *
+ * @param arg Argument starting with '-'
+ * @return TR_* bits of the option, or -1 if it is not supported
+ */
+static int	tr_option(const char *arg)
+{
+	static const char	*names[] = {"--complement", "--delete",
+		"--squeeze-repeats", "--truncate-set1", NULL};
+	static const char	letters[] = "cdstC";
+	int					flags;
+	int					i;
+
+	i = -1;
+	while (names[++i])
+		if (ft_strncmp(arg, names[i], ft_strlen(names[i]) + 1) == 0)
+			return (1 << i);
+	flags = 0;
+	i = 0;
+	while (arg[++i])
+	{
+		if (!ft_strchr(letters, arg[i]))
+			return (-1);
+		flags |= 1 << ((ft_strchr(letters, arg[i]) - letters) % 4);
+	}
+	return (flags);
+}
+
+/**
+ * @brief Recognizes a tr argv and checks its operand count
+ *
+ * tr takes its options before the sets only. Translating needs two sets,
+ * -d one (two with -s), -s alone one or two.
+ *
+ * @param argv Stage argument vector, argv[0] being "tr"
+ * @param flags Receives the TR_* option bits
+ * @param sets Receives set 1 and set 2 (NULL when absent)
+ * @return 0 on success, -1 for anything unsupported or invalid
+ */
+int	parse_tr(char **argv, int *flags, char **sets)
+{
+	int	opt;
+	int	i;
+
+	*flags = 0;
+	i = 1;
+	while (argv[i] && argv[i][0] == '-' && argv[i][1])
+	{
+		if (ft_strncmp(argv[i++], "--", 3) == 0)
+			break ;
+		opt = tr_option(argv[i - 1]);
+		if (opt < 0)
+			return (-1);
+		*flags |= opt;
+	}
+	if (!argv[i] || (argv[i + 1] && argv[i + 2]))
+		return (-1);
+	sets[0] = argv[i];
+	sets[1] = argv[i + 1];
+	if ((*flags & TR_DELETE) && !(*flags & TR_SQUEEZE))
+		return (-(sets[1] != NULL));
+	if (!(*flags & (TR_DELETE | TR_SQUEEZE)))
+		return (-(sets[1] == NULL));
+	if (*flags & TR_DELETE)
+		return (-(sets[1] == NULL));
+	return (0);
+}
+
+/**
+ * @brief Expands one byte, or a c-d range, of a set
+ *
+ * @param set Set being expanded
+ * @param s Set string
+ * @param i Position, advanced past the byte or range
+ * @return 0 on success, -1 for a bad escape or a reversed range
+ */
+static int	tr_range(t_tr_set *set, const char *s, size_t *i)
+{
+	int	c;
+	int	last;
+
+	c = tr_byte(s, i);
+	last = c;
+	if (c >= 0 && s[*i] == '-' && s[*i + 1])
+	{
+		(*i)++;
+		last = tr_byte(s, i);
+	}
+	if (c < 0 || last < c)
+		return (-1);
+	while (c <= last)
+		tr_push(set, c++, TR_PLAIN);
+	return (0);
+}
+
+/**
+ * @brief Expands a tr set string into the sequence of bytes it denotes
+ *
+ * @param set Set to fill in (chars and kinds empty, fill_at -1)
+ * @param s Set string
+ * @return 0 on success, -1 if tr would reject the set or allocation
+ * failed
+ */
+int	tr_expand(t_tr_set *set, const char *s)
+{
+	size_t	i;
+	int		r;
+
+	i = 0;
+	while (s[i])
+	{
+		r = 0;
+		if (s[i] == '[')
+			r = tr_bracket(set, s, &i);
+		if (r == 0)
+			r = tr_range(set, s, &i);
+		if (r < 0)
+			return (-1);
+	}
+	return (-(set->chars.failed || set->kinds.failed));
+}
+
+/**
+ * @brief Fills the delete and squeeze membership tables
+ *
+ * -d deletes the bytes of set 1; -s squeezes those of the last set given.
+ * For the vector kernels, the rows of the translation table that differ
+ * from the identity are noted, and both sets are also stored as nibble
+ * bitmaps: byte k (k < 16) has bit b set when 16 * b + k is a member,
+ * byte 16 + k the same for 16 * (b + 8) + k.
+ *
+ * @param tr Compiled tr
+ * @param s Expanded sets (set 1 already complemented under -c)
+ * @param two Whether two sets were given
+ */
+void	tr_members(t_tr *tr, t_tr_set *s, int two)
+{
+	size_t	i;
+
+	if ((tr->flags & TR_DELETE) && s[1].fill_at >= 0)
+		tr_push(&s[1], s[1].fill_char, TR_PLAIN);
+	i = 0;
+	while ((tr->flags & TR_DELETE) && i < s[0].chars.len)
+		tr->del[(unsigned char)s[0].chars.data[i++]] = 1;
+	i = 0;
+	while ((tr->flags & TR_SQUEEZE) && i < s[two].chars.len)
+		tr->squeeze[(unsigned char)s[two].chars.data[i++]] = 1;
+	i = 0;
+	while (i < 256)
+	{
+		if (tr->map[i] != i)
+			tr->dirty |= 1 << (i / 16);
+		tr->del_bits[(i & 15) + 16 * (i >= 128)] |= tr->del[i] << (i / 16 % 8);
+		tr->squeeze_bits[(i & 15) + 16 * (i >= 128)]
+			|= tr->squeeze[i] << (i / 16 % 8);
+		i++;
+	}
+}
@@ -0,0 +1,183 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tr_sets_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:58:52 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:58:52 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Appends one byte to an expanded set, with the construct it
+ * came from
+ *
+ * @param set Set being expanded
+ * @param c Byte
+ * @param kind TR_PLAIN, TR_UPPER, TR_LOWER or TR_CLASS
+ */
+void	tr_push(t_tr_set *set, int c, char kind)
+{
+	char	byte;
+
+	byte = c;
+	buf_append(&set->chars, &byte, 1);
+	buf_append(&set->kinds, &kind, 1);
+}
+
+/**
+ * @brief Reads one byte of a set, decoding backslash escapes
+ *
+ * \\NNN (one to three octal digits) and \\a \\b \\f \\n \\r \\t \\v are
+ * decoded; any other escaped byte stands for itself.
+ *
+ * @param s Set string
+ * @param i Position, advanced past the byte
+ * @return Byte value, or -1 for a trailing backslash or an octal value
+ * past 0377
+ */
+int	tr_byte(const char *s, size_t *i)
+{
+	static const char	*from = "abfnrtv";
+	static const char	*to = "\a\b\f\n\r\t\v";
+	int					c;
+	int					n;
+
+	if (s[*i] != '\\')
+		return ((unsigned char)s[(*i)++]);
+	if (!s[++*i])
+		return (-1);
+	if (ft_strchr(from, s[*i]))
+		return (to[ft_strchr(from, s[(*i)++]) - from]);
+	if (s[*i] < '0' || s[*i] > '7')
+		return ((unsigned char)s[(*i)++]);
+	c = 0;
+	n = 0;
+	while (n++ < 3 && s[*i] >= '0' && s[*i] <= '7')
+		c = c * 8 + s[(*i)++] - '0';
+	if (c > 0377)
+		return (-1);
+	return (c);
+}
+
+/**
+ * @brief Appends the members of a [:name:] class in ascending order
+ *
+ * The stages run in the C locale (or a UTF-8 one, where no byte past
+ * 0x7F belongs to a class), so the <ctype.h> tests apply byte by byte.
+ *
+ * @param set Set being expanded
+ * @param name Class name, terminated by ":]"
+ * @return 0 on success, -1 for an unknown class
+ */
+static int	tr_class(t_tr_set *set, const char *name)
+{
+	static const char	*names[] = {"alnum:]", "alpha:]", "blank:]",
+		"cntrl:]", "digit:]", "graph:]", "lower:]", "print:]", "punct:]",
+		"space:]", "upper:]", "xdigit:]", NULL};
+	static int			(*const tests[])(int) = {isalnum, isalpha, isblank,
+		iscntrl, isdigit, isgraph, islower, isprint, ispunct, isspace,
+		isupper, isxdigit};
+	int					k;
+	int					c;
+
+	k = 0;
+	while (names[k] && ft_strncmp(name, names[k], ft_strlen(names[k])))
+		k++;
+	if (!names[k])
+		return (-1);
+	c = -1;
+	while (++c < 256)
+	{
+		if (tests[k](c) && k == 6)
+			tr_push(set, c, TR_LOWER);
+		else if (tests[k](c) && k == 10)
+			tr_push(set, c, TR_UPPER);
+		else if (tests[k](c))
+			tr_push(set, c, TR_CLASS);
+	}
+	return (0);
+}
+
+/**
+ * @brief Expands a [c*n] repeat, or records a [c*] fill
+ *
+ * The count is octal when it starts with 0; [c*] and [c*0] fill set 2 up
+ * to the length of set 1. Repeats are only valid in set 2.
+ *
+ * @param set Set being expanded
+ * @param s Set string
+ * @param i Position of the '[', advanced past the construct
+ * @return 1 if a repeat was read, 0 if the '[' is a plain byte, -1 for
+ * anything tr would reject
+ */
+static int	tr_repeat(t_tr_set *set, const char *s, size_t *i)
+{
+	size_t	j;
+	long	n;
+	int		c;
+	int		base;
+
+	j = *i + 1;
+	c = tr_byte(s, &j);
+	if (c < 0 || s[j] != '*')
+		return (-(c < 0));
+	base = 10 - 2 * (s[j + 1] == '0');
+	n = 0;
+	while (s[++j] >= '0' && s[j] < '0' + base && n <= TR_MAX_REPEAT)
+		n = n * base + s[j] - '0';
+	if (s[j] != ']' || !set->is_set2 || n > TR_MAX_REPEAT
+		|| (n == 0 && set->fill_at >= 0))
+		return (-1);
+	*i = j + 1;
+	if (n == 0)
+	{
+		set->fill_at = set->chars.len;
+		set->fill_char = c;
+	}
+	while (n-- > 0)
+		tr_push(set, c, TR_PLAIN);
+	return (1);
+}
+
+/**
+ * @brief Expands a bracket construct: [:class:], [=c=] or [c*n]
+ *
+ * A '[' that starts none of them is a plain byte, as in tr.
+ *
+ * @param set Set being expanded
+ * @param s Set string
+ * @param i Position of the '[', advanced past the construct
+ * @return 1 if a construct was expanded, 0 if the '[' is a plain byte,
+ * -1 for a construct the builtin leaves to tr
+ */
+int	tr_bracket(t_tr_set *set, const char *s, size_t *i)
+{
+	const char	*end;
+
+	if (s[*i + 1] == ':')
+	{
+		end = strstr(s + *i + 2, ":]");
+		if (!end)
+			return (0);
+		if (tr_class(set, s + *i + 2) < 0)
+			return (-1);
+		*i = end + 2 - s;
+		return (1);
+	}
+	if (s[*i + 1] == '=')
+	{
+		if (s[*i + 2] && s[*i + 3] == '=' && s[*i + 4] == ']')
+		{
+			tr_push(set, (unsigned char)s[*i + 2], TR_EQUIV);
+			*i += 5;
+			return (1);
+		}
+		return (-(strstr(s + *i + 2, "=]") != NULL));
+	}
+	return (tr_repeat(set, s, i));
+}
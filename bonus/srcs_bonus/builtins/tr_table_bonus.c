@@ -0,0 +1,179 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   tr_table_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:58:52 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:58:52 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Replaces set 1 with its complement, in ascending byte order
+ *
+ * @param set Expanded set 1
+ * @return 1 if set 1 held a character class, 0 otherwise
+ */
+static int	tr_complement(t_tr_set *set)
+{
+	unsigned char	member[256];
+	int				had_class;
+	size_t			i;
+	int				c;
+
+	ft_memset(member, 0, sizeof(member));
+	had_class = 0;
+	i = 0;
+	while (i < set->chars.len)
+	{
+		member[(unsigned char)set->chars.data[i]] = 1;
+		had_class |= (set->kinds.data[i++] != TR_PLAIN);
+	}
+	set->chars.len = 0;
+	set->kinds.len = 0;
+	c = -1;
+	while (++c < 256)
+		if (!member[c])
+			tr_push(set, c, TR_PLAIN);
+	return (had_class);
+}
+
+/**
+ * @brief Expands the [c*] of set 2 so that it is as long as set 1
+ *
+ * @param set Expanded set 2
+ * @param len1 Length of set 1
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	tr_fill(t_tr_set *set, size_t len1)
+{
+	size_t	n;
+	size_t	tail;
+
+	if (set->fill_at < 0 || set->chars.len >= len1)
+		return (0);
+	n = len1 - set->chars.len;
+	tail = set->chars.len - set->fill_at;
+	while (set->chars.len < len1)
+		tr_push(set, set->fill_char, TR_PLAIN);
+	if (set->chars.failed || set->kinds.failed)
+		return (-1);
+	memmove(set->chars.data + set->fill_at + n,
+		set->chars.data + set->fill_at, tail);
+	memmove(set->kinds.data + set->fill_at + n,
+		set->kinds.data + set->fill_at, tail);
+	ft_memset(set->chars.data + set->fill_at, set->fill_char, n);
+	ft_memset(set->kinds.data + set->fill_at, TR_PLAIN, n);
+	return (0);
+}
+
+/**
+ * @brief Rejects the translations tr refuses
+ *
+ * Set 2 may only use [:upper:] and [:lower:], each aligned with one of
+ * them in set 1, and must not be empty. A complemented set 1 holding a
+ * class must map everything to a single byte.
+ *
+ * @param s Expanded sets
+ * @param complement_class Whether set 1 was a complemented class
+ * @return 0 if tr accepts the sets, -1 otherwise
+ */
+static int	tr_check(t_tr_set *s, int complement_class)
+{
+	size_t	i;
+
+	if (s[1].chars.len == 0)
+		return (-1);
+	i = 0;
+	while (i < s[1].chars.len)
+	{
+		if (s[1].kinds.data[i] == TR_CLASS || s[1].kinds.data[i] == TR_EQUIV)
+			return (-1);
+		if ((s[1].kinds.data[i] == TR_UPPER || s[1].kinds.data[i] == TR_LOWER)
+			&& (i >= s[0].kinds.len || (s[0].kinds.data[i] != TR_UPPER
+					&& s[0].kinds.data[i] != TR_LOWER)))
+			return (-1);
+		if (complement_class && s[1].chars.data[i] != s[1].chars.data[0])
+			return (-1);
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Fills the translation table, the identity unless translating
+ *
+ * A short set 2 is extended with its last byte, unless -t truncates set 1
+ * instead. Later pairs win, as in tr.
+ *
+ * @param tr Compiled tr
+ * @param s Expanded sets
+ * @param translate Whether the sets describe a translation
+ */
+static void	tr_map(t_tr *tr, t_tr_set *s, int translate)
+{
+	size_t	len;
+	size_t	i;
+	size_t	j;
+
+	i = 0;
+	while (i < 256)
+	{
+		tr->map[i] = i;
+		i++;
+	}
+	if (!translate)
+		return ;
+	len = s[0].chars.len;
+	if ((tr->flags & TR_TRUNCATE) && s[1].chars.len < len)
+		len = s[1].chars.len;
+	i = 0;
+	while (i < len)
+	{
+		j = i;
+		if (j >= s[1].chars.len)
+			j = s[1].chars.len - 1;
+		tr->map[(unsigned char)s[0].chars.data[i]] = s[1].chars.data[j];
+		i++;
+	}
+}
+
+/**
+ * @brief Compiles tr sets into 256 entry translate, delete and squeeze
+ * tables
+ *
+ * @param tr Compiled tr (flags set, the rest zeroed)
+ * @param sets Set 1 and set 2 strings (set 2 may be NULL)
+ * @return 0 on success, -1 if the sets are unsupported or invalid
+ */
+int	tr_compile(t_tr *tr, char **sets)
+{
+	t_tr_set	s[2];
+	int			status;
+	int			complement_class;
+
+	ft_memset(s, 0, sizeof(s));
+	s[0].fill_at = -1;
+	s[1].fill_at = -1;
+	s[1].is_set2 = 1;
+	status = tr_expand(&s[0], sets[0]);
+	if (status == 0 && sets[1])
+		status = tr_expand(&s[1], sets[1]);
+	complement_class = 0;
+	if (status == 0 && (tr->flags & TR_COMPLEMENT))
+		complement_class = tr_complement(&s[0]);
+	if (status == 0 && sets[1] && !(tr->flags & TR_DELETE))
+		status = tr_fill(&s[1], s[0].chars.len) | tr_check(s,
+				complement_class);
+	tr_map(tr, s, status == 0 && sets[1] && !(tr->flags & TR_DELETE));
+	tr_members(tr, s, sets[1] != NULL);
+	free(s[0].chars.data);
+	free(s[0].kinds.data);
+	free(s[1].chars.data);
+	free(s[1].kinds.data);
+	return (status | -(s[0].chars.failed || s[1].chars.failed));
+}
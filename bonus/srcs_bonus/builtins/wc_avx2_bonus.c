@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wc_avx2_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:39:44 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:39:44 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+
+# include <immintrin.h>
+
+/**
+ * @brief Selects the bytes of v in [lo, lo + span] (unsigned compare)
+ *
+ * @param v Input bytes
+ * @param lo Lower bound
+ * @param span Width of the range
+ * @return 0xFF in every selected byte, 0 elsewhere
+ */
+__attribute__((target("avx2")))
+static __m256i	in_range_avx2(__m256i v, char lo, char span)
+{
+	__m256i	x;
+
+	x = _mm256_sub_epi8(v, _mm256_set1_epi8(lo));
+	return (_mm256_cmpeq_epi8(_mm256_max_epu8(x, _mm256_set1_epi8(span)),
+			_mm256_set1_epi8(span)));
+}
+
+/**
+ * @brief Adds up the byte counters of acc
+ *
+ * @param acc Per byte counters (each at most 255)
+ * @return Sum of all the counters
+ */
+__attribute__((target("avx2")))
+static long	sum_bytes_avx2(__m256i acc)
+{
+	__m256i	sad;
+
+	sad = _mm256_sad_epu8(acc, _mm256_setzero_si256());
+	return (_mm256_extract_epi64(sad, 0) + _mm256_extract_epi64(sad, 1)
+		+ _mm256_extract_epi64(sad, 2) + _mm256_extract_epi64(sad, 3));
+}
+
+/**
+ * @brief Counts newlines 32 bytes at a time (AVX2)
+ *
+ * Matches are accumulated in per byte counters that are summed every 255
+ * vectors, so the inner loop is a load, a compare and a subtract.
+ *
+ * @param wc Counts to update
+ * @param p Block to scan
+ * @param len Size of the block
+ */
+__attribute__((target("avx2")))
+void	wc_lines_avx2(t_wc *wc, const unsigned char *p, size_t len)
+{
+	__m256i	nl;
+	__m256i	acc;
+	size_t	i;
+	int		n;
+
+	nl = _mm256_set1_epi8('\n');
+	i = 0;
+	while (i + 32 <= len)
+	{
+		acc = _mm256_setzero_si256();
+		n = 0;
+		while (n++ < 255 && i + 32 <= len)
+		{
+			acc = _mm256_sub_epi8(acc, _mm256_cmpeq_epi8(
+						_mm256_loadu_si256((const __m256i *)(p + i)), nl));
+			i += 32;
+		}
+		wc->lines += sum_bytes_avx2(acc);
+	}
+	wc_lines_scalar(wc, p + i, len - i);
+}
+
+/**
+ * @brief Counts newlines and words in one 32 byte block (AVX2)
+ *
+ * When every byte is white space or printable, a word starts at each
+ * printable byte that follows white space (or the block start outside a
+ * word). Blocks with other bytes go through the scalar state machine.
+ *
+ * @param wc Counts and word state to update
+ * @param p Start of the block
+ */
+__attribute__((target("avx2,popcnt")))
+static void	word_block_avx2(t_wc *wc, const unsigned char *p)
+{
+	__m256i		v;
+	unsigned	space;
+	unsigned	print;
+
+	v = _mm256_loadu_si256((const __m256i *)p);
+	space = _mm256_movemask_epi8(_mm256_or_si256(in_range_avx2(v, '\t', 4),
+				_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' '))));
+	print = _mm256_movemask_epi8(in_range_avx2(v, '!', '~' - '!'));
+	if ((space | print) != 0xFFFFFFFFu)
+	{
+		wc_words_scalar(wc, p, 32);
+		return ;
+	}
+	wc->words += __builtin_popcount(print & ((space << 1) | !wc->in_word));
+	wc->in_word = !(space >> 31);
+	wc->lines += __builtin_popcount(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v,
+					_mm256_set1_epi8('\n'))));
+}
+
+/**
+ * @brief Counts newlines and words 32 bytes at a time (AVX2)
+ *
+ * @param wc Counts and word state to update
+ * @param p Block to scan
+ * @param len Size of the block
+ */
+__attribute__((target("avx2,popcnt")))
+void	wc_words_avx2(t_wc *wc, const unsigned char *p, size_t len)
+{
+	size_t	i;
+
+	i = 0;
+	while (i + 32 <= len)
+	{
+		word_block_avx2(wc, p + i);
+		i += 32;
+	}
+	wc_words_scalar(wc, p + i, len - i);
+}
+
+#endif
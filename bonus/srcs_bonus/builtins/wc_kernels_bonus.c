@@ -0,0 +1,137 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wc_kernels_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:39:44 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:50:49 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Counts newlines one memchr() hop at a time
+ *
+ * @param wc Counts to update
+ * @param p Block to scan
+ * @param len Size of the block
+ */
+void	wc_lines_scalar(t_wc *wc, const unsigned char *p, size_t len)
+{
+	const unsigned char	*end;
+
+	end = p + len;
+	p = memchr(p, '\n', len);
+	while (p)
+	{
+		wc->lines++;
+		p++;
+		p = memchr(p, '\n', end - p);
+	}
+}
+
+/**
+ * @brief Counts newlines and words byte by byte
+ *
+ * Same rules as coreutils wc in the C locale: white space ends a word,
+ * a printable character starts one, anything else changes nothing.
+ *
+ * @param wc Counts and word state to update
+ * @param p Block to scan
+ * @param len Size of the block
+ */
+void	wc_words_scalar(t_wc *wc, const unsigned char *p, size_t len)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < len)
+	{
+		if (p[i] == '\n')
+			wc->lines++;
+		if (p[i] == ' ' || (p[i] >= '\t' && p[i] <= '\r'))
+			wc->in_word = 0;
+		else if (p[i] > ' ' && p[i] < 127 && !wc->in_word)
+		{
+			wc->in_word = 1;
+			wc->words++;
+		}
+		i++;
+	}
+}
+
+#if defined(__x86_64__) && defined(__GNUC__)
+
+/**
+ * @brief Picks the widest vector kernel the CPU supports
+ *
+ * The answer is looked up once and kept; the kernels call this for
+ * every block, from as many threads as --steal runs.
+ *
+ * @return 2 for AVX2, 1 for SSE2
+ */
+int	simd_level(void)
+{
+	static int	cached = -1;
+	int			level;
+
+	level = __atomic_load_n(&cached, __ATOMIC_RELAXED);
+	if (level >= 0)
+		return (level);
+	__builtin_cpu_init();
+	level = 1;
+	if (__builtin_cpu_supports("avx2"))
+		level = 2;
+	__atomic_store_n(&cached, level, __ATOMIC_RELAXED);
+	return (level);
+}
+
+#else
+
+/**
+ * @brief No vector kernels outside x86-64
+ *
+ * @return Always 0 (scalar)
+ */
+int	simd_level(void)
+{
+	return (0);
+}
+
+#endif
+
+/**
+ * @brief Counts one block with the fastest available kernel
+ *
+ * @param wc Counts to update
+ * @param p Block to scan
+ * @param len Size of the block
+ * @param flags WC_* bits to count
+ */
+void	wc_scan(t_wc *wc, const unsigned char *p, size_t len, int flags)
+{
+	int	level;
+
+	level = simd_level();
+	if (flags & WC_WORDS)
+	{
+		if (level == 2)
+			wc_words_avx2(wc, p, len);
+		else if (level == 1)
+			wc_words_sse2(wc, p, len);
+		else
+			wc_words_scalar(wc, p, len);
+	}
+	else if (flags & WC_LINES)
+	{
+		if (level == 2)
+			wc_lines_avx2(wc, p, len);
+		else if (level == 1)
+			wc_lines_sse2(wc, p, len);
+		else
+			wc_lines_scalar(wc, p, len);
+	}
+}
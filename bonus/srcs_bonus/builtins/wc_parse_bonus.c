@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wc_parse_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:39:44 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:50:49 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Parses one wc option ("-lw", "--lines", ...)
+ *
+ * @param arg Argument starting with '-' (WC_* bits follow "lwc")
+ * @return WC_* bits of the option, or -1 if it is not supported
+ */
+static int	wc_option(const char *arg)
+{
+	static const char	letters[] = "lwc";
+	char				*bit;
+	int					flags;
+	int					i;
+
+	if (ft_strncmp(arg, "--lines", 8) == 0)
+		return (WC_LINES);
+	if (ft_strncmp(arg, "--words", 8) == 0)
+		return (WC_WORDS);
+	if (ft_strncmp(arg, "--bytes", 8) == 0)
+		return (WC_BYTES);
+	if (!arg[1])
+		return (-1);
+	flags = 0;
+	i = 1;
+	while (arg[i])
+	{
+		bit = ft_strchr(letters, arg[i]);
+		if (!bit)
+			return (-1);
+		flags |= 1 << (bit - letters);
+		i++;
+	}
+	return (flags);
+}
+
+/**
+ * @brief Recognizes a wc stage counting stdin with -l, -w and/or -c
+ *
+ * @param argv Stage argument vector
+ * @return WC_* bits (all three without options), or -1 for anything
+ * else (-m, -L, file operands...)
+ */
+int	parse_wc(char **argv)
+{
+	int	flags;
+	int	opt;
+	int	i;
+
+	if (!argv || !argv[0] || ft_strncmp(argv[0], "wc", 3) != 0)
+		return (-1);
+	flags = 0;
+	i = 1;
+	while (argv[i] && ft_strncmp(argv[i], "--", 3) != 0)
+	{
+		if (argv[i][0] != '-')
+			return (-1);
+		opt = wc_option(argv[i]);
+		if (opt < 0)
+			return (-1);
+		flags |= opt;
+		i++;
+	}
+	if (argv[i] && argv[i + 1])
+		return (-1);
+	if (flags == 0)
+		flags = WC_LINES | WC_WORDS | WC_BYTES;
+	return (flags);
+}
+
+/**
+ * @brief Accepts wc stages the builtin reproduces byte for byte
+ *
+ * Line and byte counts do not depend on the locale; word counts are only
+ * taken over in the C locale, where a word is a run of printable
+ * characters started after white space.
+ *
+ * @param stage Stage whose argv is examined
+ * @return 1 on match, 0 otherwise
+ */
+int	match_wc(t_stage *stage)
+{
+	int	flags;
+
+	flags = parse_wc(stage->argv);
+	if (flags < 0)
+		return (0);
+	return (!(flags & WC_WORDS) || ctype_locale() == CTYPE_C);
+}
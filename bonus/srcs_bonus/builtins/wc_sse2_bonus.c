@@ -0,0 +1,136 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wc_sse2_bonus.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:39:44 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:39:44 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+
+# include <emmintrin.h>
+
+/**
+ * @brief Selects the bytes of v in [lo, lo + span] (unsigned compare)
+ *
+ * @param v Input bytes
+ * @param lo Lower bound
+ * @param span Width of the range
+ * @return 0xFF in every selected byte, 0 elsewhere
+ */
+static __m128i	in_range_sse2(__m128i v, char lo, char span)
+{
+	__m128i	x;
+
+	x = _mm_sub_epi8(v, _mm_set1_epi8(lo));
+	return (_mm_cmpeq_epi8(_mm_max_epu8(x, _mm_set1_epi8(span)),
+			_mm_set1_epi8(span)));
+}
+
+/**
+ * @brief Adds up the byte counters of acc
+ *
+ * @param acc Per byte counters (each at most 255)
+ * @return Sum of all the counters
+ */
+static long	sum_bytes_sse2(__m128i acc)
+{
+	__m128i	sad;
+
+	sad = _mm_sad_epu8(acc, _mm_setzero_si128());
+	return (_mm_cvtsi128_si64(sad)
+		+ _mm_cvtsi128_si64(_mm_unpackhi_epi64(sad, sad)));
+}
+
+/**
+ * @brief Counts newlines 16 bytes at a time (SSE2)
+ *
+ * Matches are accumulated in per byte counters that are summed every 255
+ * vectors, so the inner loop is a load, a compare and a subtract.
+ *
+ * @param wc Counts to update
+ * @param p Block to scan
+ * @param len Size of the block
+ */
+void	wc_lines_sse2(t_wc *wc, const unsigned char *p, size_t len)
+{
+	__m128i	nl;
+	__m128i	acc;
+	size_t	i;
+	int		n;
+
+	nl = _mm_set1_epi8('\n');
+	i = 0;
+	while (i + 16 <= len)
+	{
+		acc = _mm_setzero_si128();
+		n = 0;
+		while (n++ < 255 && i + 16 <= len)
+		{
+			acc = _mm_sub_epi8(acc, _mm_cmpeq_epi8(
+						_mm_loadu_si128((const __m128i *)(p + i)), nl));
+			i += 16;
+		}
+		wc->lines += sum_bytes_sse2(acc);
+	}
+	wc_lines_scalar(wc, p + i, len - i);
+}
+
+/**
+ * @brief Counts newlines and words in one 16 byte block (SSE2)
+ *
+ * When every byte is white space or printable, a word starts at each
+ * printable byte that follows white space (or the block start outside a
+ * word). Blocks with other bytes go through the scalar state machine.
+ *
+ * @param wc Counts and word state to update
+ * @param p Start of the block
+ */
+static void	word_block_sse2(t_wc *wc, const unsigned char *p)
+{
+	__m128i		v;
+	unsigned	space;
+	unsigned	print;
+
+	v = _mm_loadu_si128((const __m128i *)p);
+	space = _mm_movemask_epi8(_mm_or_si128(in_range_sse2(v, '\t', 4),
+				_mm_cmpeq_epi8(v, _mm_set1_epi8(' '))));
+	print = _mm_movemask_epi8(in_range_sse2(v, '!', '~' - '!'));
+	if ((space | print) != 0xFFFFu)
+	{
+		wc_words_scalar(wc, p, 16);
+		return ;
+	}
+	wc->words += __builtin_popcount(print & ((space << 1) | !wc->in_word));
+	wc->in_word = !(space >> 15);
+	wc->lines += __builtin_popcount(_mm_movemask_epi8(_mm_cmpeq_epi8(v,
+					_mm_set1_epi8('\n'))));
+}
+
+/**
+ * @brief Counts newlines and words 16 bytes at a time (SSE2)
+ *
+ * @param wc Counts and word state to update
+ * @param p Block to scan
+ * @param len Size of the block
+ */
+void	wc_words_sse2(t_wc *wc, const unsigned char *p, size_t len)
+{
+	size_t	i;
+
+	i = 0;
+	while (i + 16 <= len)
+	{
+		word_block_sse2(wc, p + i);
+		i += 16;
+	}
+	wc_words_scalar(wc, p + i, len - i);
+}
+
+#endif
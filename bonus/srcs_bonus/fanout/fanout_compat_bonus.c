@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fanout_compat_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:27:09 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:30:19 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+#ifdef __linux__
+
+/**
+ * @brief Duplicates up to len bytes of a pipe into another pipe
+ *
+ * The data stays in in_fd; nothing is copied to user space.
+ *
+ * @param in_fd Source pipe
+ * @param out_fd Destination pipe
+ * @param len Maximum number of bytes to duplicate
+ * @param nonblock Fail with EAGAIN instead of waiting for room
+ * @return Bytes duplicated, 0 at EOF, -1 on error (errno is set)
+ */
+ssize_t	dup_pipe(int in_fd, int out_fd, size_t len, int nonblock)
+{
+	if (nonblock)
+		return (tee(in_fd, out_fd, len, SPLICE_F_NONBLOCK));
+	return (tee(in_fd, out_fd, len, 0));
+}
+
+#else
+
+/**
+ * @brief tee() is Linux only; callers fall back to read/write
+ *
+ * @param in_fd Unused
+ * @param out_fd Unused
+ * @param len Unused
+ * @param nonblock Unused
+ * @return Always -1 with errno set to ENOSYS
+ */
+ssize_t	dup_pipe(int in_fd, int out_fd, size_t len, int nonblock)
+{
+	(void)in_fd;
+	(void)out_fd;
+	(void)len;
+	(void)nonblock;
+	errno = ENOSYS;
+	return (-1);
+}
+
+#endif
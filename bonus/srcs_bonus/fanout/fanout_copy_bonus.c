@@ -0,0 +1,154 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fanout_copy_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:27:09 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:30:19 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Writes to a consumer unless it has gone away
+ *
+ * @param fd Consumer descriptor, set to -1 once it reports EPIPE
+ * @param buf Bytes to write
+ * @param len Number of bytes
+ * @return 0 on success or EPIPE, -1 on another write error
+ */
+static int	fan_write(int *fd, const char *buf, size_t len)
+{
+	if (*fd >= 0 && write_all(*fd, buf, len) < 0)
+	{
+		if (errno != EPIPE)
+			return (-1);
+		*fd = -1;
+	}
+	return (0);
+}
+
+/**
+ * @brief Copies the rest of the stream through a user buffer
+ *
+ * Used without tee(), and once one consumer has gone away.
+ *
+ * @param in Source pipe
+ * @param out Next stage, or -1
+ * @param branch Branch pipe, or -1
+ * @return 0 at EOF or when no consumer is left, -1 on error
+ */
+static int	fan_user(int in, int out, int branch)
+{
+	char	buf[IO_CHUNK];
+	ssize_t	n;
+
+	while (out >= 0 || branch >= 0)
+	{
+		n = read(in, buf, IO_CHUNK);
+		if (n < 0 && errno == EINTR)
+			continue ;
+		if (n <= 0)
+			return (-(n < 0));
+		if (fan_write(&out, buf, n) < 0 || fan_write(&branch, buf, n) < 0)
+			return (-1);
+	}
+	return (0);
+}
+
+/**
+ * @brief Discards bytes the branch already got but the next stage won't
+ *
+ * @param in Source pipe
+ * @param len Number of bytes to drop
+ * @return 0 on success, -1 on error
+ */
+static int	fan_drop(int in, size_t len)
+{
+	char	buf[IO_CHUNK];
+	ssize_t	n;
+
+	while (len > 0)
+	{
+		n = IO_CHUNK;
+		if (len < IO_CHUNK)
+			n = len;
+		n = read(in, buf, n);
+		if (n < 0 && errno == EINTR)
+			continue ;
+		if (n <= 0)
+			return (-1);
+		len -= n;
+	}
+	return (0);
+}
+
+/**
+ * @brief Moves len bytes from the source pipe to the next stage
+ *
+ * @param in Source pipe
+ * @param out Next stage
+ * @param len Number of bytes to move
+ * @return Bytes moved; fewer than len on error (errno is set)
+ */
+size_t	fan_move(int in, int out, size_t len)
+{
+	ssize_t	n;
+	size_t	done;
+
+	done = 0;
+	while (done < len)
+	{
+		n = move_pipe(in, out, len - done);
+		if (n < 0 && errno == EINTR)
+			continue ;
+		if (n <= 0)
+			return (done);
+		done += n;
+	}
+	return (done);
+}
+
+/**
+ * @brief Feeds a stage's output to the next stage and to a branch
+ *
+ * Each round tee()s what the source pipe holds into the branch pipe,
+ * then splice()s the same bytes on to the next stage, so the data never
+ * enters user space. The slower consumer sets the pace. When the
+ * branch goes away the next stage still gets the whole stream, and the
+ * other way round unless the branch is a tap.
+ *
+ * @param in Source pipe (output of the stage)
+ * @param out Pipe read by the next stage
+ * @param branch Pipe read by the branch
+ * @param tap Nonzero when the branch is a --tap
+ * @return 0 on success, -1 on error
+ */
+int	fan_copy(int in, int out, int branch, int tap)
+{
+	ssize_t	n;
+	size_t	moved;
+
+	while (1)
+	{
+		n = dup_pipe(in, branch, FANOUT_CHUNK, 0);
+		if (n < 0 && errno == EINTR)
+			continue ;
+		if (n < 0 && errno == EPIPE)
+			return (fan_user(in, out, -1));
+		if (n < 0)
+			return (fan_user(in, out, branch));
+		if (n == 0)
+			return (0);
+		moved = fan_move(in, out, n);
+		if (moved < (size_t)n && (errno != EPIPE || tap))
+			return (-(errno != EPIPE));
+		if (moved < (size_t)n && fan_drop(in, n - moved) < 0)
+			return (-1);
+		if (moved < (size_t)n)
+			return (fan_user(in, -1, branch));
+	}
+}
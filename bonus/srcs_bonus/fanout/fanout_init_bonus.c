@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fanout_init_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:30:19 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:30:19 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Parses one --fanout or --tap and marks its stage
+ *
+ * @param context Pointer to the pipex context structure
+ * @param k Index of the option
+ */
+static void	init_fanout(t_pipex *context, int k)
+{
+	t_fanout	*f;
+	const char	*spec;
+	int			failed;
+
+	spec = context->opts.fanout_specs[k];
+	f = &context->fanouts[k];
+	f->stage = ft_atoi(spec) - 1;
+	if (f->stage < 0 || f->stage >= context->cmd_count - 1)
+		cleanup_and_exit(context, "--fanout/--tap: no such stage", 1);
+	if ((context->opts.tap_mask >> k) & 1)
+	{
+		f->tap = TAP_BLOCK + context->opts.tap_drop;
+		failed = parse_tap(f, ft_strchr(spec, '=') + 1);
+		context->stages[f->stage].fanout |= FANOUT_TAP;
+	}
+	else
+	{
+		failed = parse_branch(f, ft_strchr(spec, '=') + 1);
+		context->stages[f->stage].fanout |= FANOUT_BRANCH;
+	}
+	if (failed)
+		cleanup_and_exit(context, "--fanout: bad branch", 1);
+}
+
+/**
+ * @brief Parses the --fanout branches and --tap files
+ *
+ * @param context Pointer to the pipex context structure
+ */
+void	init_fanouts(t_pipex *context)
+{
+	int	k;
+
+	if (!context->opts.fanout_count)
+		return ;
+	context->fanouts = ft_calloc(context->opts.fanout_count, sizeof(t_fanout));
+	if (!context->fanouts)
+		cleanup_and_exit(context, "malloc failed", 1);
+	k = 0;
+	while (k < context->opts.fanout_count)
+	{
+		context->fanouts[k].source = -1;
+		context->fanouts[k].sink = -1;
+		context->fanouts[k].branch = -1;
+		context->fanouts[k].branch_in = -1;
+		k++;
+	}
+	k = 0;
+	while (k < context->opts.fanout_count)
+		init_fanout(context, k++);
+}
+
+/**
+ * @brief Frees the parsed --fanout branches
+ *
+ * @param context Pointer to the pipex context structure
+ */
+void	free_fanouts(t_pipex *context)
+{
+	int	k;
+
+	k = 0;
+	while (context->fanouts && k < context->opts.fanout_count)
+	{
+		free_tab(context->fanouts[k].cmds);
+		free(context->fanouts[k].outfile);
+		k++;
+	}
+	free(context->fanouts);
+	context->fanouts = NULL;
+}
@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fanout_parse_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:27:09 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:30:19 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Finds the first c outside of quotes in [s, end)
+ *
+ * @param s Start of the text
+ * @param c Character to look for
+ * @param end End of the text
+ * @return Pointer to the character, or end when there is none
+ */
+static const char	*find_unquoted(const char *s, char c, const char *end)
+{
+	char	quote;
+
+	quote = 0;
+	while (s < end)
+	{
+		if (quote && *s == quote)
+			quote = 0;
+		else if (!quote && (*s == '\'' || *s == '"'))
+			quote = *s;
+		else if (!quote && *s == c)
+			return (s);
+		s++;
+	}
+	return (end);
+}
+
+/**
+ * @brief Copies [s, s + len) without its surrounding blanks
+ *
+ * @param s Start of the text
+ * @param len Length of the text
+ * @return Newly allocated string (maybe empty), NULL on malloc failure
+ */
+static char	*trim_dup(const char *s, size_t len)
+{
+	while (len > 0 && (*s == ' ' || *s == '\t'))
+	{
+		s++;
+		len--;
+	}
+	while (len > 0 && (s[len - 1] == ' ' || s[len - 1] == '\t'))
+		len--;
+	return (ft_substr(s, 0, len));
+}
+
+/**
+ * @brief Splits the commands of a branch at the unquoted '|'
+ *
+ * @param f Fan-out to fill
+ * @param p Start of the commands
+ * @param end Position of the '>' that ends them
+ * @return 0 on success, -1 on an empty command or malloc failure
+ */
+static int	parse_cmds(t_fanout *f, const char *p, const char *end)
+{
+	const char	*bar;
+
+	f->cmds = ft_calloc(end - p + 2, sizeof(char *));
+	if (!f->cmds)
+		return (-1);
+	while (1)
+	{
+		bar = find_unquoted(p, '|', end);
+		f->cmds[f->ncmds] = trim_dup(p, bar - p);
+		if (!f->cmds[f->ncmds] || !f->cmds[f->ncmds][0])
+			return (-1);
+		f->ncmds++;
+		if (bar == end)
+			return (0);
+		p = bar + 1;
+	}
+}
+
+/**
+ * @brief Parses "cmd | cmd > FILE" into the commands and the outfile
+ *
+ * A branch without commands ("> FILE") copies the stream with cat.
+ *
+ * @param f Fan-out to fill
+ * @param spec Branch text
+ * @return 0 on success, -1 on a syntax error or malloc failure
+ */
+int	parse_branch(t_fanout *f, const char *spec)
+{
+	static const char	copy[] = "cat";
+	const char			*end;
+	const char			*gt;
+	char				*cmds;
+	int					empty;
+
+	end = spec + ft_strlen(spec);
+	gt = find_unquoted(spec, '>', end);
+	if (gt == end)
+		return (-1);
+	f->outfile = trim_dup(gt + 1, end - gt - 1);
+	if (!f->outfile || !f->outfile[0])
+		return (-1);
+	cmds = trim_dup(spec, gt - spec);
+	if (!cmds)
+		return (-1);
+	empty = !cmds[0];
+	free(cmds);
+	if (empty)
+		return (parse_cmds(f, copy, copy + 3));
+	return (parse_cmds(f, spec, gt));
+}
+
+/**
+ * @brief Sets up a --tap as a branch that copies the stream into file
+ *
+ * The file name is used as given, blanks included.
+ *
+ * @param f Fan-out to fill
+ * @param file Tap file
+ * @return 0 on success, -1 on malloc failure
+ */
+int	parse_tap(t_fanout *f, const char *file)
+{
+	f->outfile = ft_strdup(file);
+	f->cmds = ft_calloc(2, sizeof(char *));
+	if (!f->outfile || !f->cmds)
+		return (-1);
+	f->cmds[0] = ft_strdup("cat");
+	f->ncmds = 1;
+	if (!f->cmds[0])
+		return (-1);
+	return (0);
+}
@@ -0,0 +1,164 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fanout_start_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:27:09 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:30:19 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Builds the context of a branch pipeline
+ *
+ * The branch is set up like "pipex /dev/null cmd ... FILE"; its input
+ * is replaced by the caller. It keeps the execution options of the
+ * main pipeline but none of its per-run outputs.
+ *
+ * @param context Pointer to the main pipex context
+ * @param f Fan-out whose branch to build
+ * @return Branch context, NULL on failure
+ */
+static t_pipex	*make_branch(t_pipex *context, t_fanout *f)
+{
+	t_pipex	*branch;
+	char	**argv;
+	int		i;
+
+	argv = ft_calloc(f->ncmds + 4, sizeof(char *));
+	if (!argv)
+		return (NULL);
+	argv[0] = "pipex_bonus";
+	argv[1] = "/dev/null";
+	i = -1;
+	while (++i < f->ncmds)
+		argv[i + 2] = f->cmds[i];
+	argv[i + 2] = f->outfile;
+	branch = init_context(f->ncmds + 3, argv, context->env_vars, 1);
+	if (!branch)
+		return (NULL);
+	branch->opts = context->opts;
+	branch->opts.fanout_count = 0;
+	branch->opts.parallel_stage = 0;
+	branch->opts.sample_ms = 0;
+	branch->opts.metrics_file = NULL;
+	branch->opts.report_json = 0;
+	branch->opts.explain = 0;
+	return (branch);
+}
+
+/**
+ * @brief Runs a branch pipeline on the read end of its pipe (child)
+ *
+ * @param context Pointer to the main pipex context
+ * @param f Fan-out whose branch to run
+ */
+static void	run_branch(t_pipex *context, t_fanout *f)
+{
+	t_pipex	*branch;
+	int		in_fd;
+	int		code;
+
+	context->is_child = 1;
+	in_fd = f->branch_in;
+	f->branch_in = -1;
+	close_fanout_fds(context);
+	close_all_pipe_fds(context);
+	branch = make_branch(context, f);
+	if (!branch)
+		cleanup_and_exit(context, NULL, 1);
+	close(branch->in_fd);
+	branch->in_fd = in_fd;
+	code = handle_processes(branch);
+	free_context(branch);
+	cleanup_and_exit(context, NULL, code);
+}
+
+/**
+ * @brief Copies the output of the stage to both consumers (child)
+ *
+ * SIGPIPE is ignored so that a consumer going away only ends its own
+ * copy. A tap with the drop policy never waits for its file.
+ *
+ * @param context Pointer to the main pipex context
+ * @param f Fan-out to drive
+ */
+static void	run_driver(t_pipex *context, t_fanout *f)
+{
+	int	fds[3];
+
+	context->is_child = 1;
+	fds[0] = f->source;
+	fds[1] = f->sink;
+	fds[2] = f->branch;
+	f->source = -1;
+	f->sink = -1;
+	f->branch = -1;
+	close_fanout_fds(context);
+	close_all_pipe_fds(context);
+	signal(SIGPIPE, SIG_IGN);
+	if (f->tap == TAP_DROP)
+		cleanup_and_exit(context, NULL, tap_copy(fds, f->stage + 1) < 0);
+	cleanup_and_exit(context, NULL,
+		fan_copy(fds[0], fds[1], fds[2], f->tap) < 0);
+}
+
+/**
+ * @brief Puts a fan-out driver on the pipe after the stage
+ *
+ * The stage keeps writing its pipe, whose read end goes to the driver;
+ * the next stage reads a new pipe fed by the driver, and the branch
+ * reads a third one. A tap's pipe is grown to TAP_BUFFER, the bytes
+ * it may lag behind.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param f Fan-out to start
+ */
+static void	start_fanout(t_pipex *context, t_fanout *f)
+{
+	int	main_pipe[2];
+	int	branch_pipe[2];
+
+	if (pipe(main_pipe) < 0 || pipe(branch_pipe) < 0)
+		cleanup_and_exit(context, "pipe failed", 1);
+	if (f->tap)
+		fcntl(branch_pipe[1], F_SETPIPE_SZ, TAP_BUFFER);
+	f->source = context->pipes[f->stage * 2];
+	context->pipes[f->stage * 2] = main_pipe[0];
+	f->sink = main_pipe[1];
+	f->branch = branch_pipe[1];
+	f->branch_in = branch_pipe[0];
+	f->pid = fork();
+	if (f->pid < 0)
+		cleanup_and_exit(context, "fork failed", 1);
+	if (f->pid == 0)
+		run_branch(context, f);
+	close(f->branch_in);
+	f->branch_in = -1;
+	f->driver = fork();
+	if (f->driver < 0)
+		cleanup_and_exit(context, "fork failed", 1);
+	if (f->driver == 0)
+		run_driver(context, f);
+}
+
+/**
+ * @brief Starts the drivers and branches of every --fanout
+ *
+ * Several fan-outs after the same stage are chained, each driver
+ * feeding the next one.
+ *
+ * @param context Pointer to the pipex context structure
+ */
+void	start_fanouts(t_pipex *context)
+{
+	int	k;
+
+	k = 0;
+	while (context->fanouts && k < context->opts.fanout_count)
+		start_fanout(context, &context->fanouts[k++]);
+}
@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fanout_tap_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:30:19 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:30:19 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Waits until the source pipe has data or its writers are gone
+ *
+ * @param in Source pipe
+ * @return 0 when it is readable, -1 on error
+ */
+static int	wait_input(int in)
+{
+	struct pollfd	pfd;
+
+	pfd.fd = in;
+	pfd.events = POLLIN;
+	while (poll(&pfd, 1, -1) < 0)
+	{
+		if (errno != EINTR)
+			return (-1);
+	}
+	return (0);
+}
+
+/**
+ * @brief Feeds the next stage and, when it has room, the tap
+ *
+ * What the source pipe holds is tee()d into the tap without waiting;
+ * those bytes are then moved on to the next stage. When the tap is
+ * full (or gone) one splice() passes the data on without it. Without
+ * tee() the tap blocks instead.
+ *
+ * @param fds Source pipe, next stage and tap pipe
+ * @param dropped Where to count the bytes left out of the tap
+ * @return 0 at EOF or once the next stage is gone, -1 on error
+ */
+static int	tap_loop(int fds[3], long *dropped)
+{
+	ssize_t	n;
+
+	while (wait_input(fds[0]) == 0)
+	{
+		n = -1;
+		if (fds[2] >= 0)
+			n = dup_pipe(fds[0], fds[2], FANOUT_CHUNK, 1);
+		if (n < 0 && errno == ENOSYS)
+			return (fan_copy(fds[0], fds[1], fds[2], 1));
+		if (n < 0 && errno == EPIPE)
+			fds[2] = -1;
+		if (n > 0 && fan_move(fds[0], fds[1], n) < (size_t)n)
+			return (-(errno != EPIPE));
+		if (n > 0)
+			continue ;
+		n = move_pipe(fds[0], fds[1], FANOUT_CHUNK);
+		if (n == 0 || (n < 0 && errno == EPIPE))
+			return (0);
+		if (n < 0 && errno != EINTR && errno != EAGAIN)
+			return (-1);
+		if (n > 0 && fds[2] >= 0)
+			*dropped += n;
+	}
+	return (-1);
+}
+
+/**
+ * @brief Runs a tap with the drop policy and reports what it left out
+ *
+ * @param fds Source pipe, next stage and tap pipe
+ * @param stage Tapped stage, counted from 1
+ * @return 0 on success, -1 on error
+ */
+int	tap_copy(int fds[3], int stage)
+{
+	long	dropped;
+	int		ret;
+
+	dropped = 0;
+	ret = tap_loop(fds, &dropped);
+	if (dropped > 0)
+	{
+		ft_putstr_fd("pipex_bonus: tap ", STDERR_FILENO);
+		put_long_fd(stage, STDERR_FILENO);
+		ft_putstr_fd(": dropped ", STDERR_FILENO);
+		put_long_fd(dropped, STDERR_FILENO);
+		ft_putendl_fd(" bytes", STDERR_FILENO);
+	}
+	return (ret);
+}
@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fanout_wait_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:27:09 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:30:19 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Closes the fan-out descriptors this process still holds
+ *
+ * Called by every child, and by the parent once the stages are forked,
+ * so that each pipe sees EOF when its real writers are done.
+ *
+ * @param context Pointer to the pipex context structure
+ */
+void	close_fanout_fds(t_pipex *context)
+{
+	t_fanout	*f;
+	int			k;
+
+	k = 0;
+	while (context->fanouts && k < context->opts.fanout_count)
+	{
+		f = &context->fanouts[k++];
+		if (f->source >= 0)
+			close(f->source);
+		if (f->sink >= 0)
+			close(f->sink);
+		if (f->branch >= 0)
+			close(f->branch);
+		if (f->branch_in >= 0)
+			close(f->branch_in);
+		f->source = -1;
+		f->sink = -1;
+		f->branch = -1;
+		f->branch_in = -1;
+	}
+}
+
+/**
+ * @brief Records the status of a branch or driver reaped with the stages
+ *
+ * @param context Pointer to the pipex context structure
+ * @param pid Reaped process
+ * @param status Status as filled by wait4
+ */
+void	fanout_reaped(t_pipex *context, pid_t pid, int status)
+{
+	t_fanout	*f;
+	int			k;
+
+	k = 0;
+	while (context->fanouts && k < context->opts.fanout_count)
+	{
+		f = &context->fanouts[k++];
+		if (f->pid == pid)
+		{
+			f->status = status;
+			f->pid = 0;
+		}
+		else if (f->driver == pid)
+		{
+			f->driver_status = status;
+			f->driver = 0;
+		}
+	}
+}
+
+/**
+ * @brief Waits for the branches and applies the multi-sink exit policy
+ *
+ * A failing main pipeline keeps its exit code. Otherwise the first
+ * branch (in option order) that failed gives its exit code, and a
+ * driver that failed gives 1. Taps never change the exit code.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param exit_code Exit code of the main pipeline
+ * @return Exit code of the whole graph
+ */
+int	fanout_exit_code(t_pipex *context, int exit_code)
+{
+	t_fanout	*f;
+	int			status;
+	int			k;
+
+	k = 0;
+	while (context->fanouts && k < context->opts.fanout_count)
+	{
+		f = &context->fanouts[k++];
+		if (f->pid > 0 && waitpid(f->pid, &status, 0) == f->pid)
+			fanout_reaped(context, f->pid, status);
+		if (f->driver > 0 && waitpid(f->driver, &status, 0) == f->driver)
+			fanout_reaped(context, f->driver, status);
+		if (exit_code == 0 && !f->tap)
+			exit_code = status_exit_code(f->status);
+		if (exit_code == 0 && !f->tap && status_exit_code(f->driver_status))
+			exit_code = 1;
+	}
+	return (exit_code);
+}
+
+/**
+ * @brief Tells whether stages j and j + 1 must stay in separate processes
+ *
+ * @param context Pointer to the pipex context structure
+ * @param j Index of the first stage
+ * @return 1 when either stage runs as replicas or a fan-out follows
+ * stage j, 0 otherwise
+ */
+int	group_break(t_pipex *context, int j)
+{
+	return (parallel_stage(context, j) || parallel_stage(context, j + 1)
+		|| (j < context->cmd_count && context->stages[j].fanout));
+}
@@ -6,7 +6,7 @@
 /*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/09 04:26:05 by lakdogan          #+#    #+#             */
-/*   Updated: 2025/05/10 04:16:27 by lakdogan         ###   ########.fr       */
+/*   Updated: 2026/10/19 12:23:58 by lakdogan         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -41,6 +41,7 @@ static int	is_limiter_line(char *line, char *limiter)
 static void	read_heredoc_input(t_pipex *context, int write_fd)
 {
 	char	*line;
+	size_t	len;
 
 	write(STDOUT_FILENO, "heredoc> ", 9);
 	line = get_next_line(STDIN_FILENO);
@@ -51,7 +52,9 @@ static void	read_heredoc_input(t_pipex *context, int write_fd)
 			free(line);
 			break ;
 		}
-		write(write_fd, line, ft_strlen(line));
+		len = ft_strlen(line);
+		write(write_fd, line, len);
+		context->stats.heredoc_bytes += len;
 		free(line);
 		write(STDOUT_FILENO, "heredoc> ", 9);
 		line = get_next_line(STDIN_FILENO);
@@ -81,10 +84,13 @@ static void	setup_heredoc_files(t_pipex *context, int heredoc_pipe[2])
  */
 void	handle_heredoc(t_pipex *context)
 {
-	int	heredoc_pipe[2];
+	int		heredoc_pipe[2];
+	long	start;
 
 	if (pipe(heredoc_pipe) < 0)
 		cleanup_and_exit(context, "pipe failed", 1);
+	start = now_ns(CLOCK_MONOTONIC);
 	read_heredoc_input(context, heredoc_pipe[1]);
+	context->stats.heredoc_ns = now_ns(CLOCK_MONOTONIC) - start;
 	setup_heredoc_files(context, heredoc_pipe);
 }
@@ -6,75 +6,82 @@
 /*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/09 04:24:10 by lakdogan          #+#    #+#             */
-/*   Updated: 2025/05/10 04:32:17 by lakdogan         ###   ########.fr       */
+/*   Updated: 2026/10/19 15:27:09 by lakdogan         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../inc_bonus/pipex_bonus.h"
 
+/**
+ * @brief Converts the raw wait status of the last stage to an exit code
+ *
+ * @param context Pointer to the pipex context structure
+ * @param last_raw_status Status of the last command as filled by waitpid
+ * @return Exit code of the last command or 1 if input was missing
+ */
+int	pipeline_exit_code(t_pipex *context, int last_raw_status)
+{
+	int	last_status;
+
+	last_status = status_exit_code(last_raw_status);
+	if (context->input_missing && last_status == 0)
+		return (1);
+	return (last_status);
+}
+
 /**
  * @brief Waits for all child processes 
  * to complete and returns the last exit code
  *
+ * Children are reaped in the order they exit so that every stage gets
+ * an accurate exit time and resource usage.
+ *
  * @param context Pointer to the pipex context structure
  * @param pids Array of process IDs to wait for
  * @return Exit code of the last command or 1 if input was missing
  */
 int	wait_children(t_pipex *context, pid_t *pids)
 {
-	int	status;
+	int	reaped;
 	int	i;
-	int	last_status;
 
-	i = 0;
-	last_status = 0;
-	while (i < context->cmd_count)
+	reaped = 0;
+	while (reaped < context->cmd_count)
 	{
-		waitpid(pids[i], &status, 0);
-		if (WIFEXITED(status))
-		{
-			if (i == context->cmd_count - 1)
-				last_status = WEXITSTATUS(status);
-		}
-		else if (WIFSIGNALED(status))
-		{
-			if (i == context->cmd_count - 1)
-				last_status = 128 + WTERMSIG(status);
-		}
-		i++;
+		i = reap_stage(context, pids, 0);
+		if (i == REAP_ERROR)
+			break ;
+		if (i < context->cmd_count)
+			reaped += group_size(context, i);
 	}
-	if (context->input_missing && last_status == 0)
-		return (1);
-	return (last_status);
+	return (pipeline_exit_code(context,
+			context->stages[context->cmd_count - 1].raw_status));
 }
 
 /**
  * @brief Sets up standard input and output for a child process
  *
+ * The first stage reads the infile and the last one writes the outfile,
+ * which may be the same stage (a one-command --fanout branch).
+ *
  * @param context Pointer to the pipex context structure
  * @param i Index of the current command
  */
 void	setup_stdin_stdout(t_pipex *context, int i)
 {
 	if (i == 0)
-	{
 		dup2(context->in_fd, STDIN_FILENO);
-		dup2(context->pipes[1], STDOUT_FILENO);
-	}
-	else if (i == context->cmd_count - 1)
-	{
+	else
 		dup2(context->pipes[(i - 1) * 2], STDIN_FILENO);
+	if (i == context->cmd_count - 1)
 		dup2(context->out_fd, STDOUT_FILENO);
-	}
 	else
-	{
-		dup2(context->pipes[(i - 1) * 2], STDIN_FILENO);
 		dup2(context->pipes[i * 2 + 1], STDOUT_FILENO);
-	}
 }
 
 /**
- * @brief Closes all pipe file descriptors in a child process
+ * @brief Closes all pipe file descriptors (in a child, or in the parent
+ * once every stage is forked)
  *
  * @param context Pointer to the pipex context structure
  */
@@ -93,18 +100,35 @@ void	close_all_pipe_fds(t_pipex *context)
 /**
  * @brief Executes a command in a child process
  *
+ * Builtin stages, and the process feeding the replicas of a --parallel
+ * stage, run in the child without exec; closing their exec probe marks
+ * the start of the run. A stage hosting a thread group (or run
+ * as block tasks) runs the whole group. Otherwise the path
+ * resolved by the parent is exec'ed; when there is none (or that execve
+ * fails) launch_command_bonus() retries and reports the error.
+ *
  * @param context Pointer to the pipex context structure
- * @param argv Array of command line arguments
  * @param i Index of the current command
  */
-void	execute_command(t_pipex *context, char **argv, int i)
+void	execute_command(t_pipex *context, int i)
 {
-	char	*cmd_str;
+	t_stage	*stage;
 
-	if (context->is_heredoc)
-		cmd_str = argv[i + 3];
-	else
-		cmd_str = argv[i + 2];
-	launch_command_bonus(context, cmd_str, context->env_vars);
+	stage = &context->stages[i];
+	if (stage->builtin || stage->replicas > 1)
+	{
+		if (stage->probe[1] >= 0)
+			close(stage->probe[1]);
+		stage->probe[1] = -1;
+		if (stage->replicas > 1)
+			cleanup_and_exit(context, NULL, run_parallel(context, i));
+		if (group_size(context, i) > 1 || steal_stage(context, i))
+			cleanup_and_exit(context, NULL, run_thread_group(context, i));
+		cleanup_and_exit(context, NULL, stage->builtin->run(stage,
+				STDIN_FILENO, STDOUT_FILENO));
+	}
+	if (stage->path)
+		execve(stage->path, stage->argv, context->env_vars);
+	launch_command_bonus(context, stage->cmd_str, context->env_vars);
 	cleanup_and_exit(context, "command execution failed", 1);
 }
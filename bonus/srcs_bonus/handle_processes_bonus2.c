@@ -6,7 +6,7 @@
 /*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/09 06:05:21 by lakdogan          #+#    #+#             */
-/*   Updated: 2025/05/10 04:16:27 by lakdogan         ###   ########.fr       */
+/*   Updated: 2026/10/19 15:27:09 by lakdogan         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,70 +15,111 @@
 /**
  * @brief Sets up stdin/stdout and executes command in a child process
  *
+ * A process hosting a thread group reads the input of the group's
+ * first stage.
+ *
  * @param context Pointer to the pipex context structure
- * @param argv Array of command line arguments
  * @param i Index of the current command
  */
-static void	setup_child_process(t_pipex *context, char **argv, int i)
+static void	setup_child_process(t_pipex *context, int i)
 {
+	int	first;
+
 	setup_stdin_stdout(context, i);
+	first = group_first(context, i);
+	if (first != i && first == 0)
+		dup2(context->in_fd, STDIN_FILENO);
+	else if (first != i)
+		dup2(context->pipes[(first - 1) * 2], STDIN_FILENO);
 	close_all_pipe_fds(context);
-	execute_command(context, argv, i);
+	close_fanout_fds(context);
+	execute_command(context, i);
 }
 
 /**
- * @brief Closes all pipe file descriptors in the parent process
+ * @brief Forks the process of stage i
  *
  * @param context Pointer to the pipex context structure
+ * @param pids Array to store process IDs
+ * @param i Index of the stage
  */
-static void	close_all_pipes(t_pipex *context)
+static void	spawn_stage(t_pipex *context, pid_t *pids, int i)
 {
-	int	j;
+	pid_t	pid;
 
-	j = 0;
-	while (j < 2 * context->pipe_count)
+	open_exec_probe(context, i);
+	pid = fork();
+	if (pid < 0)
+		cleanup_and_exit(context, "fork failed", 1);
+	close_exec_probe(context, i, pid);
+	pids[i] = pid;
+	context->stages[i].pid = pid;
+	if (pid == 0)
 	{
-		close(context->pipes[j]);
-		j++;
+		context->is_child = 1;
+		setup_child_process(context, i);
 	}
 }
 
 /**
  * @brief Creates child processes for each command
  *
+ * Stages that run as threads of a later stage get no process of their
+ * own; their pid stays 0.
+ *
  * @param context Pointer to the pipex context structure
- * @param argv Array of command line arguments
  * @param pids Array to store process IDs
  */
-static void	create_processes(t_pipex *context, char **argv, pid_t *pids)
+static void	create_processes(t_pipex *context, pid_t *pids)
 {
-	pid_t	pid;
-	int		i;
+	int	i;
 
 	i = 0;
 	while (i < context->cmd_count)
 	{
-		pid = fork();
-		if (pid < 0)
-			cleanup_and_exit(context, "fork failed", 1);
-		pids[i] = pid;
-		if (pid == 0)
-		{
-			context->is_child = 1;
-			setup_child_process(context, argv, i);
-		}
+		pids[i] = 0;
+		if (context->stages[i].host == i)
+			spawn_stage(context, pids, i);
 		i++;
 	}
+	close_fanout_fds(context);
+	context->stats.spawned_ns = now_ns(CLOCK_MONOTONIC);
+}
+
+/**
+ * @brief Starts the run statistics and prepares the stage table
+ *
+ * The --fanout branches and their drivers are started last, before any
+ * stage is forked.
+ *
+ * @param context Pointer to the pipex context structure
+ */
+static void	prepare_run(t_pipex *context)
+{
+	begin_run_stats(context);
+	init_stages(context);
+	if (context->infile_count > 1)
+		merge_inputs(context);
+	init_fanouts(context);
+	optimize_pipeline(context);
+	plan_thread_groups(context);
+	context->stats.parsed_ns = now_ns(CLOCK_MONOTONIC);
+	if (context->opts.sample_ms)
+		init_sampler(context);
+	start_fanouts(context);
 }
 
 /**
  * @brief Handles the creation and management of child processes
  *
+ * Stages are tokenized, resolved and optimized once in the parent, then forked;
+ * run statistics are collected for the exporters.
+ *
  * @param context Pointer to the pipex context structure
- * @param argv Array of command line arguments
- * @return Exit code of the last command
+ * @return Exit code of the last command, or of a failed --fanout
+ * branch (see fanout_exit_code())
  */
-int	handle_processes(t_pipex *context, char **argv)
+int	handle_processes(t_pipex *context)
 {
 	pid_t	*pids;
 	int		exit_code;
@@ -86,9 +127,22 @@ int	handle_processes(t_pipex *context, char **argv)
 	pids = malloc(sizeof(pid_t) * context->cmd_count);
 	if (!pids)
 		cleanup_and_exit(context, "malloc failed", 1);
-	create_processes(context, argv, pids);
-	close_all_pipes(context);
-	exit_code = wait_children(context, pids);
+	prepare_run(context);
+	create_processes(context, pids);
+	wait_exec_probes(context);
+	if (context->opts.sample_ms)
+		exit_code = sample_pipes(context, pids);
+	else
+	{
+		close_all_pipe_fds(context);
+		exit_code = wait_children(context, pids);
+	}
+	exit_code = fanout_exit_code(context, exit_code);
 	free(pids);
+	end_run_stats(context, exit_code);
+	if (context->opts.metrics_file)
+		write_metrics(context);
+	if (context->opts.report_json)
+		write_report(context);
 	return (exit_code);
 }
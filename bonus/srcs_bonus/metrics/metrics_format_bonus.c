@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   metrics_format_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:21:43 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:54:29 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Writes a signed 64-bit integer in decimal
+ *
+ * @param n Number to write
+ * @param fd File descriptor to write to
+ */
+void	put_long_fd(long n, int fd)
+{
+	char			buf[21];
+	int				i;
+	unsigned long	u;
+
+	u = (unsigned long)n;
+	if (n < 0)
+		u = -(unsigned long)n;
+	i = 20;
+	buf[i] = '0';
+	if (u == 0)
+		i--;
+	while (u > 0)
+	{
+		buf[i--] = '0' + u % 10;
+		u /= 10;
+	}
+	if (n < 0)
+		buf[i--] = '-';
+	write_all(fd, buf + i + 1, 20 - i);
+}
+
+/**
+ * @brief Writes a nanosecond duration as seconds with 9 decimals
+ *
+ * @param ns Duration in nanoseconds
+ * @param fd File descriptor to write to
+ */
+void	put_seconds_fd(long ns, int fd)
+{
+	char	frac[10];
+	long	rest;
+	int		i;
+
+	if (ns < 0)
+	{
+		write(fd, "-", 1);
+		ns = -ns;
+	}
+	put_long_fd(ns / 1000000000L, fd);
+	rest = ns % 1000000000L;
+	frac[0] = '.';
+	i = 9;
+	while (i > 0)
+	{
+		frac[i--] = '0' + rest % 10;
+		rest /= 10;
+	}
+	write(fd, frac, 10);
+}
+
+/**
+ * @brief Writes a label value with OpenMetrics escaping
+ *
+ * Backslash, double quote and newline are escaped as \\, \" and \n.
+ *
+ * @param value Label value
+ * @param fd File descriptor to write to
+ */
+void	put_label_fd(const char *value, int fd)
+{
+	size_t	start;
+	size_t	i;
+
+	start = 0;
+	i = 0;
+	while (value[i])
+	{
+		if (value[i] == '\\' || value[i] == '"' || value[i] == '\n')
+		{
+			write(fd, value + start, i - start);
+			write(fd, "\\", 1);
+			if (value[i] == '\n')
+				write(fd, "n", 1);
+			else
+				write(fd, value + i, 1);
+			start = i + 1;
+		}
+		i++;
+	}
+	write(fd, value + start, i - start);
+}
+
+/**
+ * @brief Writes the "# TYPE" and "# HELP" lines of a gauge family
+ *
+ * @param metric Metric family description
+ * @param fd File descriptor to write to
+ */
+void	put_metric_header(const t_metric *metric, int fd)
+{
+	ft_putstr_fd("# TYPE ", fd);
+	ft_putstr_fd((char *)metric->name, fd);
+	ft_putstr_fd(" gauge\n# HELP ", fd);
+	ft_putstr_fd((char *)metric->name, fd);
+	ft_putstr_fd(" ", fd);
+	ft_putendl_fd((char *)metric->help, fd);
+}
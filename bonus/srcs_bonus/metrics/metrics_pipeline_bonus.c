@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   metrics_pipeline_bonus.c                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:21:43 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:34:44 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Collects the pipeline level values in table order
+ *
+ * @param context Pointer to the pipex context structure
+ * @param values Array receiving one value per pipeline metric
+ */
+static void	fill_values(t_pipex *context, long *values)
+{
+	t_run_stats	*stats;
+
+	stats = &context->stats;
+	values[0] = stats->end_ns - stats->start_ns;
+	values[1] = stats->exit_code;
+	values[2] = context->cmd_count;
+	values[3] = stats->bytes_in;
+	values[4] = stats->bytes_out;
+	values[5] = stats->heredoc_bytes;
+	values[6] = stats->cache_hits;
+	values[7] = stats->cache_misses;
+	values[8] = stats->start_epoch_ns;
+	values[9] = stats->elided;
+	values[10] = stats->rewrites;
+}
+
+/**
+ * @brief Writes one pipeline level gauge (skipped if the value is unknown)
+ *
+ * @param context Pointer to the pipex context structure
+ * @param metric Metric family description
+ * @param value Value, nanoseconds for time metrics, -1 if unknown
+ * @param fd File descriptor to write to
+ */
+static void	put_pipeline_gauge(t_pipex *context, const t_metric *metric,
+		long value, int fd)
+{
+	if (value < 0)
+		return ;
+	put_metric_header(metric, fd);
+	ft_putstr_fd((char *)metric->name, fd);
+	ft_putstr_fd("{pipeline=\"", fd);
+	put_label_fd(context->opts.pipeline_name, fd);
+	ft_putstr_fd("\"} ", fd);
+	if (metric->is_ns)
+		put_seconds_fd(value, fd);
+	else
+		put_long_fd(value, fd);
+	write(fd, "\n", 1);
+}
+
+/**
+ * @brief Writes the pipeline level series of the last run
+ *
+ * @param context Pointer to the pipex context structure
+ * @param fd File descriptor to write to
+ */
+void	write_pipeline_series(t_pipex *context, int fd)
+{
+	static const t_metric	metrics[] = {
+	{"pipex_pipeline_wall_seconds", "Wall clock time of the last run.", 1},
+	{"pipex_pipeline_exit_code", "Exit code of the last run.", 0},
+	{"pipex_pipeline_stages", "Number of stages of the last run.", 0},
+	{"pipex_input_bytes", "Bytes read from the infile or here_doc.", 0},
+	{"pipex_output_bytes", "Bytes written to the outfile.", 0},
+	{"pipex_heredoc_bytes", "Bytes read from the here_doc.", 0},
+	{"pipex_command_cache_hits", "Stages resolved from the cache.", 0},
+	{"pipex_command_cache_misses", "Stages that needed a PATH lookup.", 0},
+	{"pipex_last_run_timestamp_seconds", "Start time of the last run.", 1},
+	{"pipex_elided_stages", "Stages removed before forking.", 0},
+	{"pipex_rewrites", "Optimizer rewrites applied to the pipeline.", 0}
+	};
+	long					values[11];
+	int						i;
+
+	fill_values(context, values);
+	i = 0;
+	while (i < 11)
+	{
+		put_pipeline_gauge(context, &metrics[i], values[i], fd);
+		i++;
+	}
+}
@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   metrics_stage_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:21:43 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:01:35 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Converts a struct timeval to nanoseconds
+ *
+ * @param tv Time value
+ * @return Time in nanoseconds
+ */
+static long	tv_ns(struct timeval tv)
+{
+	return (tv.tv_sec * 1000000000L + tv.tv_usec * 1000L);
+}
+
+/**
+ * @brief Returns the value of stage metric k for one stage
+ *
+ * @param stage Stage to read
+ * @param k Index of the metric in the stage metric table
+ * @return Value, nanoseconds for time metrics, -1 if unknown
+ */
+static long	stage_value(t_stage *stage, int k)
+{
+	if (!stage->reaped && k < 5)
+		return (-1);
+	if (k == 0)
+		return (tv_ns(stage->usage.ru_utime));
+	if (k == 1)
+		return (tv_ns(stage->usage.ru_stime));
+	if (k == 2)
+		return ((long)stage->usage.ru_maxrss * MAXRSS_UNIT);
+	if (k == 3)
+		return (status_exit_code(stage->raw_status));
+	if (k == 4 && stage->exec_ns)
+		return (stage->exec_ns - stage->fork_ns);
+	if (k == 5)
+		return (stage->cache_hit);
+	if (k == 6)
+		return (stage->builtin != NULL);
+	return (-1);
+}
+
+/**
+ * @brief Writes the label set {pipeline,stage,command} of stage i
+ *
+ * @param context Pointer to the pipex context structure
+ * @param i Index of the stage
+ * @param fd File descriptor to write to
+ */
+static void	put_stage_labels(t_pipex *context, int i, int fd)
+{
+	t_stage	*stage;
+
+	stage = &context->stages[i];
+	ft_putstr_fd("{pipeline=\"", fd);
+	put_label_fd(context->opts.pipeline_name, fd);
+	ft_putstr_fd("\",stage=\"", fd);
+	put_long_fd(i + 1, fd);
+	ft_putstr_fd("\",command=\"", fd);
+	if (stage->argv && stage->argv[0])
+		put_label_fd(stage->argv[0], fd);
+	ft_putstr_fd("\"} ", fd);
+}
+
+/**
+ * @brief Writes one sample line of stage metric k for every stage
+ *
+ * @param context Pointer to the pipex context structure
+ * @param metric Metric family description
+ * @param k Index of the metric in the stage metric table
+ * @param fd File descriptor to write to
+ */
+static void	put_stage_gauges(t_pipex *context, const t_metric *metric, int k,
+		int fd)
+{
+	long	value;
+	int		i;
+
+	put_metric_header(metric, fd);
+	i = 0;
+	while (i < context->cmd_count)
+	{
+		value = stage_value(&context->stages[i], k);
+		if (value >= 0)
+		{
+			ft_putstr_fd((char *)metric->name, fd);
+			put_stage_labels(context, i, fd);
+			if (metric->is_ns)
+				put_seconds_fd(value, fd);
+			else
+				put_long_fd(value, fd);
+			write(fd, "\n", 1);
+		}
+		i++;
+	}
+}
+
+/**
+ * @brief Writes the per-stage series of the last run
+ *
+ * @param context Pointer to the pipex context structure
+ * @param fd File descriptor to write to
+ */
+void	write_stage_series(t_pipex *context, int fd)
+{
+	static const t_metric	metrics[] = {
+	{"pipex_stage_cpu_user_seconds", "User CPU time of the stage.", 1},
+	{"pipex_stage_cpu_system_seconds", "System CPU time of the stage.", 1},
+	{"pipex_stage_max_rss_bytes", "Peak resident set size of the stage.", 0},
+	{"pipex_stage_exit_code", "Exit code of the stage.", 0},
+	{"pipex_stage_spawn_seconds", "Time from fork to exec of the stage.", 1},
+	{"pipex_stage_command_cache_hit", "1 if the command was cached.", 0},
+	{"pipex_stage_builtin", "1 if the stage ran as an in-process builtin.",
+		0}
+	};
+	int						k;
+
+	k = 0;
+	while (k < 7)
+	{
+		put_stage_gauges(context, &metrics[k], k, fd);
+		k++;
+	}
+}
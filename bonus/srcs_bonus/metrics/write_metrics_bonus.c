@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   write_metrics_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:21:43 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:21:43 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Builds the temporary path "<path>.tmp.<pid>"
+ *
+ * The temporary file lives next to the target so rename() stays atomic,
+ * and does not end in .prom so the textfile collector ignores it.
+ *
+ * @param path Final metrics file path
+ * @return Allocated temporary path or NULL on allocation failure
+ */
+static char	*temp_path(const char *path)
+{
+	char	*pid;
+	char	*prefix;
+	char	*tmp;
+
+	pid = ft_itoa((int)getpid());
+	if (!pid)
+		return (NULL);
+	prefix = ft_strjoin(path, ".tmp.");
+	tmp = NULL;
+	if (prefix)
+		tmp = ft_strjoin(prefix, pid);
+	free(prefix);
+	free(pid);
+	return (tmp);
+}
+
+/**
+ * @brief Reports a metrics export failure without failing the pipeline
+ *
+ * @param context Pointer to the pipex context structure
+ */
+static void	metrics_error(t_pipex *context)
+{
+	ft_putstr_fd("pipex_bonus: metrics: ", STDERR_FILENO);
+	perror(context->opts.metrics_file);
+}
+
+/**
+ * @brief Atomically replaces the metrics file with this run's series
+ *
+ * The series are written to a temporary file which is then renamed over
+ * the target, so node_exporter never reads a partial file.
+ *
+ * @param context Pointer to the pipex context structure
+ */
+void	write_metrics(t_pipex *context)
+{
+	char	*tmp;
+	int		fd;
+
+	tmp = temp_path(context->opts.metrics_file);
+	fd = -1;
+	if (tmp)
+		fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+	{
+		metrics_error(context);
+		free(tmp);
+		return ;
+	}
+	write_pipeline_series(context, fd);
+	write_stage_series(context, fd);
+	ft_putstr_fd("# EOF\n", fd);
+	if (close(fd) < 0 || rename(tmp, context->opts.metrics_file) < 0)
+	{
+		metrics_error(context);
+		unlink(tmp);
+	}
+	free(tmp);
+}
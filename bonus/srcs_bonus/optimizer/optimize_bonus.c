@@ -0,0 +1,151 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   optimize_bonus.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:34:44 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:45:04 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Returns the rewrite table, in the order the rules are tried
+ *
+ * @return NULL terminated array of rewrite rules
+ */
+static const t_rule	*rule_table(void)
+{
+	static const t_rule	rules[] = {
+	{"drop-cat", RW_DROP_CAT, rule_drop_cat},
+	{"merge-grep", RW_MERGE_GREP, rule_merge_grep},
+	{"hoist-filter", RW_HOIST_FILTER, rule_hoist_filter},
+	{"sort-uniq", RW_SORT_UNIQ, rule_sort_uniq},
+	{"topk", RW_TOPK, rule_topk},
+	{"distinct", RW_DISTINCT, rule_distinct},
+	{NULL, 0, NULL}
+	};
+
+	return (rules);
+}
+
+/**
+ * @brief Maps a rewrite name (as shown by --explain) to its option bit
+ *
+ * @param name Rewrite name
+ * @return The RW_* bit of the rewrite, or 0 if unknown
+ */
+int	rewrite_bit(const char *name)
+{
+	const t_rule	*rules;
+	int				i;
+
+	rules = rule_table();
+	i = 0;
+	while (rules[i].name)
+	{
+		if (ft_strncmp(rules[i].name, name, ft_strlen(rules[i].name) + 1) == 0)
+			return (rules[i].bit);
+		i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Applies one rule at every position where it matches
+ *
+ * A rule that fired is retried at the same position, since the stage
+ * there has changed.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param rule Rule to apply
+ * @return 1 if the plan changed, 0 otherwise
+ */
+static int	apply_rule(t_pipex *context, const t_rule *rule)
+{
+	int	changed;
+	int	i;
+
+	changed = 0;
+	i = 0;
+	while (i < context->cmd_count)
+	{
+		if (rule->apply(context, i))
+		{
+			changed = 1;
+			context->stats.rewrites++;
+			explain_plan(context, rule->name);
+		}
+		else
+			i++;
+	}
+	return (changed);
+}
+
+/**
+ * @brief Rewrites the tokenized stage list before anything is forked
+ *
+ * Every rule preserves the pipeline's output and exit status; rules are
+ * run to a fixed point because one rewrite can enable another (a hoisted
+ * filter can leave sort next to uniq or head).
+ *
+ * @param context Pointer to the pipex context structure
+ */
+void	optimize_pipeline(t_pipex *context)
+{
+	const t_rule	*rules;
+	int				changed;
+	int				k;
+
+	rules = rule_table();
+	explain_plan(context, "input");
+	changed = 1;
+	while (changed)
+	{
+		changed = 0;
+		k = 0;
+		while (rules[k].name)
+		{
+			if ((context->opts.rewrites & rules[k].bit)
+				&& apply_rule(context, &rules[k]))
+				changed = 1;
+			k++;
+		}
+	}
+	explain_plan(context, "plan");
+}
+
+/**
+ * @brief Prints the current stage list for --explain
+ *
+ * @param context Pointer to the pipex context structure
+ * @param step "input", the name of the rewrite that just fired, or "plan"
+ */
+void	explain_plan(t_pipex *context, const char *step)
+{
+	t_buf	buf;
+	int		i;
+
+	if (!context->opts.explain)
+		return ;
+	ft_memset(&buf, 0, sizeof(t_buf));
+	buf_puts(&buf, "pipex_bonus: explain: ");
+	buf_puts(&buf, step);
+	buf_puts(&buf, ": ");
+	i = 0;
+	while (i < context->cmd_count)
+	{
+		if (i > 0)
+			buf_puts(&buf, " | ");
+		buf_puts(&buf, context->stages[i].cmd_str);
+		buf_puts(&buf, stage_tag(context, i));
+		i++;
+	}
+	buf_puts(&buf, "\n");
+	if (!buf.failed)
+		write(STDERR_FILENO, buf.data, buf.len);
+	free(buf.data);
+}
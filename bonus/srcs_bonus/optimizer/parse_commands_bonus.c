@@ -0,0 +1,165 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_commands_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:34:44 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:34:44 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Parses one grep option cluster ("-vF", "-e PAT", "-ePAT")
+ *
+ * Only options that keep grep a pure line filter are accepted.
+ *
+ * @param argv grep argument vector
+ * @param i Index of the cluster, advanced past it (and its value)
+ * @param args Parsed flags and patterns
+ * @return 0 on success, -1 on an unsupported option
+ */
+static int	grep_option(char **argv, int *i, t_grep_args *args)
+{
+	static const char	letters[] = "vFEiwx";
+	const char			*opt;
+	char				*bit;
+
+	opt = argv[*i] + 1;
+	while (*opt && *opt != 'e')
+	{
+		bit = ft_strchr(letters, *opt);
+		if (!bit)
+			return (-1);
+		args->flags |= 1 << (bit - letters);
+		opt++;
+	}
+	(*i)++;
+	if (*opt != 'e')
+		return (0);
+	if (opt[1])
+		args->patterns[args->count++] = (char *)opt + 1;
+	else if (argv[*i])
+		args->patterns[args->count++] = argv[(*i)++];
+	else
+		return (-1);
+	return (0);
+}
+
+/**
+ * @brief Skips the option clusters of a grep stage
+ *
+ * @param argv grep argument vector
+ * @param args Parsed flags and patterns
+ * @return Index of the first operand, or -1 on an unsupported option
+ */
+static int	grep_options(char **argv, t_grep_args *args)
+{
+	int	i;
+
+	i = 1;
+	while (argv[i] && argv[i][0] == '-' && argv[i][1])
+	{
+		if (ft_strncmp(argv[i], "--", 3) == 0)
+			return (i + 1);
+		if (grep_option(argv, &i, args) < 0)
+			return (-1);
+	}
+	return (i);
+}
+
+/**
+ * @brief Recognizes a grep stage that only filters stdin line by line
+ *
+ * @param argv Stage argument vector
+ * @param args Receives the flags and an allocated array of pattern
+ * pointers (into argv) the caller frees on success
+ * @return 0 for a plain filter, -1 otherwise
+ */
+int	parse_grep(char **argv, t_grep_args *args)
+{
+	int	i;
+
+	ft_memset(args, 0, sizeof(t_grep_args));
+	if (!argv || !argv[0] || ft_strncmp(argv[0], "grep", 5) != 0)
+		return (-1);
+	i = 0;
+	while (argv[i])
+		i++;
+	args->patterns = ft_calloc(i + 1, sizeof(char *));
+	if (!args->patterns)
+		return (-1);
+	i = grep_options(argv, args);
+	if (i > 0 && args->count == 0 && argv[i])
+		args->patterns[args->count++] = argv[i++];
+	if (i > 0 && !argv[i] && args->count > 0
+		&& (args->flags & (GREP_FIXED | GREP_EXTENDED))
+		!= (GREP_FIXED | GREP_EXTENDED))
+		return (0);
+	free(args->patterns);
+	args->patterns = NULL;
+	return (-1);
+}
+
+/**
+ * @brief Parses one sort option cluster
+ *
+ * @param argv sort argument vector
+ * @param i Index of the cluster, advanced past it (and its value)
+ * @param flags SORT_* bits collected so far
+ * @return 0 on success, -1 on an unsupported option
+ */
+static int	sort_option(char **argv, int *i, int *flags)
+{
+	const char	*opt;
+
+	opt = argv[*i] + 1;
+	while (*opt)
+	{
+		if (*opt == 'r')
+			*flags |= SORT_REVERSE;
+		else if (*opt == 'u')
+			*flags |= SORT_UNIQUE;
+		else if (*opt != '-' && ft_strchr("nfbdgMhVskt", *opt))
+			*flags |= SORT_KEYED;
+		else
+			return (-1);
+		if (*opt == 'k' || *opt == 't')
+			break ;
+		opt++;
+	}
+	if (*opt && !opt[1])
+		(*i)++;
+	if (!argv[*i])
+		return (-1);
+	(*i)++;
+	return (0);
+}
+
+/**
+ * @brief Recognizes a sort stage reading stdin and writing stdout
+ *
+ * @param argv Stage argument vector
+ * @return SORT_* bits (SORT_KEYED for any ordering option besides -r),
+ * or -1 if the stage is not such a sort
+ */
+int	parse_sort(char **argv)
+{
+	int	flags;
+	int	i;
+
+	if (!argv || !argv[0] || ft_strncmp(argv[0], "sort", 5) != 0)
+		return (-1);
+	flags = 0;
+	i = 1;
+	while (argv[i])
+	{
+		if (argv[i][0] != '-' || !argv[i][1]
+			|| sort_option(argv, &i, &flags) < 0)
+			return (-1);
+	}
+	return (flags);
+}
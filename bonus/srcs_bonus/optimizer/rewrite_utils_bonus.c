@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rewrite_utils_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:34:44 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:34:44 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Appends a copy of arg to the first free slot of argv
+ *
+ * @param context Pointer to the pipex context structure
+ * @param argv Vector from new_argv() with at least one free slot
+ * @param arg Argument to copy
+ */
+void	push_arg(t_pipex *context, char **argv, const char *arg)
+{
+	int	i;
+
+	i = 0;
+	while (argv[i])
+		i++;
+	argv[i] = ft_strdup(arg);
+	if (!argv[i])
+	{
+		free_shell_split(argv);
+		cleanup_and_exit(context, "malloc failed", 1);
+	}
+}
+
+/**
+ * @brief Allocates an argument vector for a rewritten stage
+ *
+ * @param context Pointer to the pipex context structure
+ * @param src Arguments to copy first (may be NULL)
+ * @param extra Number of free slots to leave for push_arg()
+ * @return NULL terminated vector owning its strings
+ */
+char	**new_argv(t_pipex *context, char **src, int extra)
+{
+	char	**argv;
+	int		n;
+
+	n = 0;
+	while (src && src[n])
+		n++;
+	argv = ft_calloc(n + extra + 1, sizeof(char *));
+	if (!argv)
+		cleanup_and_exit(context, "malloc failed", 1);
+	n = 0;
+	while (src && src[n])
+	{
+		push_arg(context, argv, src[n]);
+		n++;
+	}
+	return (argv);
+}
+
+/**
+ * @brief Looks up a variable in the environment passed to the stages
+ *
+ * @param envp Environment array
+ * @param name Variable name
+ * @return Pointer to the value, or NULL if unset
+ */
+static const char	*env_value(char **envp, const char *name)
+{
+	size_t	len;
+	int		i;
+
+	len = ft_strlen(name);
+	i = 0;
+	while (envp && envp[i])
+	{
+		if (ft_strncmp(envp[i], name, len) == 0 && envp[i][len] == '=')
+			return (envp[i] + len + 1);
+		i++;
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Tells whether sort would compare lines byte by byte
+ *
+ * Rewrites that replace sort's comparison (sort -u, the top-K builtin)
+ * are only exact when the stages collate in the C locale; C.UTF-8 sorts
+ * by code point, which is byte order for UTF-8.
+ *
+ * @param context Pointer to the pipex context structure
+ * @return 1 if LC_COLLATE resolves to C, POSIX or C.*, 0 otherwise
+ */
+int	bytewise_collation(t_pipex *context)
+{
+	static const char	*vars[] = {"LC_ALL", "LC_COLLATE", "LANG", NULL};
+	const char			*value;
+	int					i;
+
+	i = 0;
+	while (vars[i])
+	{
+		value = env_value(context->env_vars, vars[i]);
+		if (value && value[0])
+			return (ft_strncmp(value, "C", 2) == 0
+				|| ft_strncmp(value, "C.", 2) == 0
+				|| ft_strncmp(value, "POSIX", 6) == 0);
+		i++;
+	}
+	return (1);
+}
@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rule_distinct_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:45:48 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 13:45:48 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Tells whether a stage is "uniq" or "uniq -c"
+ *
+ * @param stage Stage to examine
+ * @return 0 for uniq, DIST_COUNT for uniq -c, -1 for anything else
+ */
+static int	uniq_kind(t_stage *stage)
+{
+	char	**argv;
+
+	argv = stage->argv;
+	if (argv_is(stage, "uniq"))
+		return (0);
+	if (argv && argv[0] && ft_strncmp(argv[0], "uniq", 5) == 0 && argv[1]
+		&& ft_strncmp(argv[1], "-c", 3) == 0 && !argv[2])
+		return (DIST_COUNT);
+	return (-1);
+}
+
+/**
+ * @brief Tells whether a stage sorts its input into an order that only
+ * depends on the set of lines it reads
+ *
+ * Any sort that ends with the whole-line comparison qualifies; -s, and
+ * -u with keys, keep whichever equal line came first and do not.
+ *
+ * @param argv Stage argument vector
+ * @return 1 if the input order cannot show in the output, 0 otherwise
+ */
+static int	order_free(char **argv)
+{
+	t_sort	sort;
+	int		ok;
+
+	ft_memset(&sort, 0, sizeof(t_sort));
+	ok = (parse_sort_argv(argv, &sort) == 0 && !(sort.flags & SORT_STABLE)
+			&& !((sort.flags & SORT_UNIQUE) && sort.nkeys));
+	free(sort.keys);
+	free(sort.tmpdir);
+	return (ok);
+}
+
+/**
+ * @brief Builds the argv of the distinct builtin
+ *
+ * @param context Pointer to the pipex context structure
+ * @param flags DIST_COUNT to print the counts
+ * @return New argument vector
+ */
+static char	**distinct_argv(t_pipex *context, int flags)
+{
+	char	**argv;
+
+	argv = new_argv(context, NULL, 2);
+	push_arg(context, argv, "@distinct");
+	if (flags & DIST_COUNT)
+		push_arg(context, argv, "-c");
+	return (argv);
+}
+
+/**
+ * @brief distinct: turns "sort | uniq [-c]" and "sort -u" into the
+ * @distinct builtin when the order of its output does not matter
+ *
+ * The builtin counts lines in a hash table instead of sorting them. The
+ * order only doesn't matter when the next stage sorts again (as in
+ * "sort | uniq -c | sort -rn") or when --unordered says so. Same
+ * restrictions on the sort as sort-uniq, and builtins must be enabled.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param i Index of the sort stage
+ * @return 1 if the plan changed, 0 otherwise
+ */
+int	rule_distinct(t_pipex *context, int i)
+{
+	int	flags;
+	int	kind;
+	int	next;
+
+	flags = parse_sort(context->stages[i].argv);
+	if (context->opts.no_builtins || flags < 0
+		|| (flags & ~(SORT_REVERSE | SORT_UNIQUE))
+		|| !bytewise_collation(context))
+		return (0);
+	kind = 0;
+	next = i + 1;
+	if (!(flags & SORT_UNIQUE) && next < context->cmd_count)
+		kind = uniq_kind(&context->stages[next]);
+	if (!(flags & SORT_UNIQUE) && (next >= context->cmd_count || kind < 0))
+		return (0);
+	next += !(flags & SORT_UNIQUE);
+	if (!context->opts.unordered && (next >= context->cmd_count
+			|| !order_free(context->stages[next].argv)))
+		return (0);
+	set_stage_argv(context, i, distinct_argv(context, kind));
+	if (!(flags & SORT_UNIQUE))
+		drop_stage(context, i + 1);
+	return (1);
+}
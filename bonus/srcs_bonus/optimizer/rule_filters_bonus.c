@@ -0,0 +1,152 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rule_filters_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:34:44 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:38:28 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief drop-cat: removes a bare cat, which copies stdin to stdout
+ *
+ * The neighbours are connected directly (or the next stage reads the
+ * file the cat was moving data for). A last cat stays, since its exit
+ * status is the pipeline's, and so do the cats of two stage pipelines,
+ * where it runs as a builtin anyway.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param i Index of the stage to examine
+ * @return 1 if the stage was removed, 0 otherwise
+ */
+int	rule_drop_cat(t_pipex *context, int i)
+{
+	if (context->cmd_count <= 2 || i == context->cmd_count - 1
+		|| !argv_is(&context->stages[i], "cat"))
+		return (0);
+	remove_stage(context, i);
+	return (1);
+}
+
+/**
+ * @brief Compares two argument vectors
+ *
+ * @param a First vector
+ * @param b Second vector
+ * @return 1 if both have the same arguments, 0 otherwise
+ */
+static int	same_argv(char **a, char **b)
+{
+	int	i;
+
+	i = 0;
+	while (a[i] && b[i])
+	{
+		if (ft_strncmp(a[i], b[i], ft_strlen(a[i]) + 1) != 0)
+			return (0);
+		i++;
+	}
+	return (a[i] == b[i]);
+}
+
+/**
+ * @brief Appends "-e PATTERN" for every pattern of a grep stage
+ *
+ * @param context Pointer to the pipex context structure
+ * @param argv Vector being built
+ * @param args Parsed grep stage
+ */
+static void	push_patterns(t_pipex *context, char **argv, t_grep_args *args)
+{
+	int	k;
+
+	k = 0;
+	while (k < args->count)
+	{
+		push_arg(context, argv, "-e");
+		push_arg(context, argv, args->patterns[k]);
+		k++;
+	}
+}
+
+/**
+ * @brief Builds "grep -vF... -e A1 ... -e B1 ..." from two -vF filters
+ *
+ * Dropping lines matching any of A and then any of B is dropping lines
+ * matching any of A or B, which a single grep does in one pass.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param a First filter
+ * @param b Second filter (same flags as a)
+ * @return New argument vector
+ */
+static char	**merged_grep(t_pipex *context, t_grep_args *a, t_grep_args *b)
+{
+	static const char	letters[] = "vFEiwx";
+	char				opts[sizeof(letters) + 1];
+	char				**argv;
+	int					k;
+	int					n;
+
+	opts[0] = '-';
+	n = 1;
+	k = 0;
+	while (letters[k])
+	{
+		if (a->flags & (1 << k))
+			opts[n++] = letters[k];
+		k++;
+	}
+	opts[n] = '\0';
+	argv = new_argv(context, NULL, 2 + 2 * (a->count + b->count));
+	push_arg(context, argv, "grep");
+	push_arg(context, argv, opts);
+	push_patterns(context, argv, a);
+	push_patterns(context, argv, b);
+	return (argv);
+}
+
+/**
+ * @brief merge-grep: collapses adjacent grep filters
+ *
+ * An identical filter repeated right after itself is dropped, and two
+ * inverted fixed-string filters with the same flags become one grep with
+ * all the patterns. Positive filters are left alone: their conjunction
+ * is not expressible as a single grep. The second grep is the one kept,
+ * so a trailing grep still sets the exit status.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param i Index of the first grep
+ * @return 1 if the plan changed, 0 otherwise
+ */
+int	rule_merge_grep(t_pipex *context, int i)
+{
+	t_grep_args	a;
+	t_grep_args	b;
+	int			ret;
+
+	if (i + 1 >= context->cmd_count
+		|| parse_grep(context->stages[i].argv, &a) < 0)
+		return (0);
+	ret = 0;
+	if (parse_grep(context->stages[i + 1].argv, &b) == 0)
+	{
+		ret = same_argv(context->stages[i].argv, context->stages[i + 1].argv);
+		if (!ret && a.flags == b.flags && (a.flags & GREP_INVERT)
+			&& (a.flags & GREP_FIXED))
+		{
+			set_stage_argv(context, i + 1, merged_grep(context, &a, &b));
+			ret = 1;
+		}
+		free(b.patterns);
+	}
+	free(a.patterns);
+	if (ret)
+		drop_stage(context, i);
+	return (ret);
+}
@@ -0,0 +1,157 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   rule_sort_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:34:44 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:27:30 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief hoist-filter: moves a grep filter in front of the sort before it
+ *
+ * sort only permutes lines and a filter decides on each line alone, so
+ * filtering first gives the same lines in the same order while sort has
+ * less to do. sort -u is not a permutation and is left in place, and a
+ * filter in last position keeps it so the exit status stays grep's.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param i Index of the sort stage
+ * @return 1 if the stages were swapped, 0 otherwise
+ */
+int	rule_hoist_filter(t_pipex *context, int i)
+{
+	t_grep_args	args;
+	t_stage		tmp;
+	int			flags;
+
+	if (i + 2 >= context->cmd_count)
+		return (0);
+	flags = parse_sort(context->stages[i].argv);
+	if (flags < 0 || (flags & SORT_UNIQUE)
+		|| parse_grep(context->stages[i + 1].argv, &args) < 0)
+		return (0);
+	free(args.patterns);
+	tmp = context->stages[i];
+	context->stages[i] = context->stages[i + 1];
+	context->stages[i + 1] = tmp;
+	return (1);
+}
+
+/**
+ * @brief sort-uniq: turns "sort | uniq" into "sort -u"
+ *
+ * Only for a whole-line sort (optionally -r) in the C locale, where
+ * sort -u and uniq agree on which lines are equal.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param i Index of the sort stage
+ * @return 1 if the plan changed, 0 otherwise
+ */
+int	rule_sort_uniq(t_pipex *context, int i)
+{
+	char	**argv;
+	int		flags;
+
+	if (i + 1 >= context->cmd_count
+		|| !argv_is(&context->stages[i + 1], "uniq"))
+		return (0);
+	flags = parse_sort(context->stages[i].argv);
+	if (flags < 0 || (flags & ~SORT_REVERSE) || !bytewise_collation(context))
+		return (0);
+	argv = new_argv(context, context->stages[i].argv, 1);
+	push_arg(context, argv, "-u");
+	set_stage_argv(context, i, argv);
+	drop_stage(context, i + 1);
+	return (1);
+}
+
+/**
+ * @brief Builds the argv of the top-K builtin: K then the sort options
+ *
+ * @param context Pointer to the pipex context structure
+ * @param k Number of lines to keep
+ * @param sort Argument vector of the sort stage
+ * @return New argument vector
+ */
+static char	**topk_argv(t_pipex *context, int k, char **sort)
+{
+	char	**argv;
+	char	*count;
+	int		n;
+
+	n = 0;
+	while (sort[n])
+		n++;
+	argv = new_argv(context, NULL, n + 1);
+	push_arg(context, argv, "@topk");
+	count = ft_itoa(k);
+	if (!count)
+	{
+		free_shell_split(argv);
+		cleanup_and_exit(context, "malloc failed", 1);
+	}
+	push_arg(context, argv, count);
+	free(count);
+	n = 1;
+	while (sort[n])
+	{
+		if (ft_strncmp(sort[n], "--", 3) != 0)
+			push_arg(context, argv, sort[n]);
+		n++;
+	}
+	return (argv);
+}
+
+/**
+ * @brief topk: turns "sort ... | head -n K" into the @topk K builtin
+ *
+ * The builtin keeps the K first lines in a bounded heap instead of
+ * sorting (and spilling) the whole input, comparing them like the sort
+ * builtin does. So the sort stage must be one the sort builtin took
+ * (bytewise collation, supported options), without -u.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param i Index of the sort stage
+ * @return 1 if the plan changed, 0 otherwise
+ */
+int	rule_topk(t_pipex *context, int i)
+{
+	t_stage	*stage;
+	int		k;
+
+	if (context->opts.no_builtins || i + 1 >= context->cmd_count
+		|| parse_head(context->stages[i + 1].argv, &k) < 0
+		|| !bytewise_collation(context))
+		return (0);
+	stage = &context->stages[i];
+	if (!stage->builtin || ft_strncmp(stage->builtin->name, "sort", 5) != 0
+		|| (((t_sort *)stage->state)->flags & SORT_UNIQUE))
+		return (0);
+	set_stage_argv(context, i, topk_argv(context, k, stage->argv));
+	drop_stage(context, i + 1);
+	return (1);
+}
+
+/**
+ * @brief Recognizes a head stage printing its first K lines
+ *
+ * @param argv Stage argument vector
+ * @param count Receives the number of lines
+ * @return 0 on success, -1 if the stage is not such a head
+ */
+int	parse_head(char **argv, int *count)
+{
+	t_head	head;
+
+	if (parse_head_argv(argv, &head) < 0 || head.bytes
+		|| head.count < 1 || head.count > INT_MAX)
+		return (-1);
+	*count = (int)head.count;
+	return (0);
+}
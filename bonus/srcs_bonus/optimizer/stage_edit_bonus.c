@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stage_edit_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:34:44 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:34:44 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Builds the display string of a rewritten stage
+ *
+ * @param context Pointer to the pipex context structure
+ * @param argv NULL terminated argument vector
+ * @return Allocated "argv[0] argv[1] ..." string
+ */
+static char	*join_argv(t_pipex *context, char **argv)
+{
+	t_buf	buf;
+	int		i;
+
+	ft_memset(&buf, 0, sizeof(t_buf));
+	i = 0;
+	while (argv[i])
+	{
+		if (i > 0)
+			buf_puts(&buf, " ");
+		buf_puts(&buf, argv[i]);
+		i++;
+	}
+	buf_append(&buf, "", 1);
+	if (buf.failed)
+	{
+		free(buf.data);
+		cleanup_and_exit(context, "malloc failed", 1);
+	}
+	return (buf.data);
+}
+
+/**
+ * @brief Replaces the argv of stage i and binds it again
+ *
+ * The stage takes ownership of argv. The resolved path is kept when the
+ * command name did not change; otherwise the stage goes through the
+ * builtin table and the PATH lookup like a freshly parsed one.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param i Index of the stage
+ * @param argv New argument vector (as built by new_argv())
+ */
+void	set_stage_argv(t_pipex *context, int i, char **argv)
+{
+	t_stage	*stage;
+	int		renamed;
+
+	stage = &context->stages[i];
+	renamed = !stage->argv || !stage->argv[0] || ft_strncmp(stage->argv[0],
+			argv[0], ft_strlen(argv[0]) + 1) != 0;
+	free_builtin_state(stage);
+	stage->builtin = NULL;
+	free_shell_split(stage->argv);
+	stage->argv = argv;
+	free(stage->label);
+	stage->label = join_argv(context, argv);
+	stage->cmd_str = stage->label;
+	if ((!context->opts.no_builtins && match_builtin(stage))
+		|| renamed || !stage->path)
+	{
+		free(stage->path);
+		stage->path = NULL;
+		stage->cache_hit = 0;
+	}
+	if (!stage->builtin && !stage->path)
+		resolve_stage(context, i);
+}
+
+/**
+ * @brief Drops stage i from the pipeline together with one pipe
+ *
+ * A middle or leading stage loses its output pipe (its reader takes over
+ * its input), the last stage loses its input pipe (its writer takes over
+ * the outfile). The caller makes sure at least two stages remain.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param i Index of the stage
+ */
+void	remove_stage(t_pipex *context, int i)
+{
+	t_stage	*stage;
+	int		p;
+
+	p = i;
+	if (i == context->cmd_count - 1)
+		p = i - 1;
+	stage = &context->stages[i];
+	clear_stage(stage);
+	close(context->pipes[p * 2]);
+	close(context->pipes[p * 2 + 1]);
+	ft_memmove(stage, stage + 1,
+		sizeof(t_stage) * (context->cmd_count - i - 1));
+	ft_memmove(context->pipes + p * 2, context->pipes + p * 2 + 2,
+		sizeof(int) * 2 * (context->pipe_count - p - 1));
+	context->cmd_count--;
+	context->pipe_count--;
+	context->stats.elided++;
+}
+
+/**
+ * @brief Removes a stage made redundant by a rewrite
+ *
+ * pipex needs at least two stages, so in a two stage pipeline the stage
+ * becomes a bare cat (a splice() builtin) instead.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param i Index of the stage
+ */
+void	drop_stage(t_pipex *context, int i)
+{
+	char	**argv;
+
+	if (context->cmd_count > 2)
+	{
+		remove_stage(context, i);
+		return ;
+	}
+	argv = new_argv(context, NULL, 1);
+	push_arg(context, argv, "cat");
+	set_stage_argv(context, i, argv);
+}
+
+/**
+ * @brief Tells whether a stage is exactly the given command, no arguments
+ *
+ * @param stage Stage to check
+ * @param cmd Command name
+ * @return 1 on match, 0 otherwise
+ */
+int	argv_is(t_stage *stage, const char *cmd)
+{
+	return (stage->argv && stage->argv[0] && !stage->argv[1]
+		&& ft_strncmp(stage->argv[0], cmd, ft_strlen(cmd) + 1) == 0);
+}
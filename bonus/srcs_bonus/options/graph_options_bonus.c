@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   graph_options_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:27:09 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:30:19 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Handles --fanout 'i=cmd | cmd > FILE' (a branch after stage i)
+ *
+ * The output of stage i (counted from 1) also feeds the branch, a
+ * pipeline of its own that writes FILE. The option may be repeated;
+ * rewrites are disabled since they could move work across the branch
+ * point.
+ *
+ * @param opts Options structure to fill
+ * @param value "i=BRANCH"; the branch is checked once the stages exist
+ * @return 0 on success, -1 on invalid value
+ */
+int	opt_fanout(t_opts *opts, const char *value)
+{
+	int	i;
+
+	if (!value || !ft_isdigit(value[0]) || opts->fanout_count >= FANOUT_MAX)
+		return (-1);
+	i = 0;
+	while (ft_isdigit(value[i]))
+		i++;
+	if (value[i] != '=' || !ft_strchr(value + i, '>'))
+		return (-1);
+	opts->fanout_specs[opts->fanout_count++] = value;
+	opts->rewrites = 0;
+	return (0);
+}
+
+/**
+ * @brief Handles --tap i=FILE (a copy of stage i's output in FILE)
+ *
+ * A tap is a fan-out whose branch only writes FILE; unlike a branch it
+ * never changes the exit code nor keeps the stages before it running.
+ *
+ * @param opts Options structure to fill
+ * @param value "i=FILE"
+ * @return 0 on success, -1 on invalid value
+ */
+int	opt_tap(t_opts *opts, const char *value)
+{
+	int	i;
+
+	if (!value || !ft_isdigit(value[0]) || opts->fanout_count >= FANOUT_MAX)
+		return (-1);
+	i = 0;
+	while (ft_isdigit(value[i]))
+		i++;
+	if (value[i] != '=' || !value[i + 1])
+		return (-1);
+	opts->tap_mask |= 1 << opts->fanout_count;
+	opts->fanout_specs[opts->fanout_count++] = value;
+	opts->rewrites = 0;
+	return (0);
+}
+
+/**
+ * @brief Handles --tap-policy block|drop (a tap that can't keep up)
+ *
+ * With block the pipeline waits once the tap buffer is full; with drop
+ * the bytes that do not fit are left out of the tap file.
+ *
+ * @param opts Options structure to fill
+ * @param value "block" or "drop"
+ * @return 0 on success, -1 on invalid value
+ */
+int	opt_tap_policy(t_opts *opts, const char *value)
+{
+	if (value && ft_strncmp(value, "block", 6) == 0)
+		opts->tap_drop = 0;
+	else if (value && ft_strncmp(value, "drop", 5) == 0)
+		opts->tap_drop = 1;
+	else
+		return (-1);
+	return (0);
+}
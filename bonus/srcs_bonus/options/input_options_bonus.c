@@ -0,0 +1,28 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   input_options_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:18:35 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:18:35 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Handles --inputs N (the first N arguments are infiles)
+ *
+ * The infiles are read by the first stage, which must then be a @merge
+ * without file operands.
+ *
+ * @param opts Options structure to fill
+ * @param value Number of infiles, at most MERGE_MAX_INPUTS
+ * @return 0 on success, -1 on invalid value
+ */
+int	opt_inputs(t_opts *opts, const char *value)
+{
+	return (parse_count(value, MERGE_MAX_INPUTS, &opts->inputs));
+}
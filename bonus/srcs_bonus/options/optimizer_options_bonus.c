@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   optimizer_options_bonus.c                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:34:44 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:05:46 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Handles --no-rewrite NAME (disable one optimizer rewrite)
+ *
+ * May be repeated; "all" disables the optimizer entirely.
+ *
+ * @param opts Options structure to fill
+ * @param value Rewrite name as printed by --explain
+ * @return 0 on success, -1 on unknown name
+ */
+int	opt_no_rewrite(t_opts *opts, const char *value)
+{
+	int	bit;
+
+	if (!value)
+		return (-1);
+	if (ft_strncmp(value, "all", 4) == 0)
+		bit = RW_ALL;
+	else
+		bit = rewrite_bit(value);
+	if (!bit)
+		return (-1);
+	opts->rewrites &= ~bit;
+	return (0);
+}
+
+/**
+ * @brief Handles --explain (print the rewritten plan before running)
+ *
+ * @param opts Options structure to fill
+ * @param value Must be NULL, the flag takes no value
+ * @return 0 on success, -1 if a value was given
+ */
+int	opt_explain(t_opts *opts, const char *value)
+{
+	if (value)
+		return (-1);
+	opts->explain = 1;
+	return (0);
+}
+
+/**
+ * @brief Handles --unordered (the order of the output lines is irrelevant)
+ *
+ * Lets the optimizer replace a sort that only groups equal lines with a
+ * hashing builtin.
+ *
+ * @param opts Options structure to fill
+ * @param value Must be NULL, the flag takes no value
+ * @return 0 on success, -1 if a value was given
+ */
+int	opt_unordered(t_opts *opts, const char *value)
+{
+	if (value)
+		return (-1);
+	opts->unordered = 1;
+	return (0);
+}
@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   option_handlers_bonus.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:17:59 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:27:56 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Parses a strictly positive decimal number
+ *
+ * @param value String to parse
+ * @param max Largest accepted value
+ * @param out Where to store the parsed number
+ * @return 0 on success, -1 if the value is missing, malformed or out of range
+ */
+int	parse_count(const char *value, int max, int *out)
+{
+	long	n;
+	int		i;
+
+	if (!value || !value[0])
+		return (-1);
+	n = 0;
+	i = 0;
+	while (value[i])
+	{
+		if (!ft_isdigit(value[i]))
+			return (-1);
+		n = n * 10 + (value[i] - '0');
+		if (n > max)
+			return (-1);
+		i++;
+	}
+	if (n == 0)
+		return (-1);
+	*out = (int)n;
+	return (0);
+}
+
+/**
+ * @brief Handles --sample-ms N (pipe fill sampling interval)
+ *
+ * @param opts Options structure to fill
+ * @param value Sampling interval in milliseconds
+ * @return 0 on success, -1 on invalid value
+ */
+int	opt_sample_ms(t_opts *opts, const char *value)
+{
+	return (parse_count(value, 60000, &opts->sample_ms));
+}
+
+/**
+ * @brief Handles --metrics-file PATH (OpenMetrics textfile output)
+ *
+ * @param opts Options structure to fill
+ * @param value Path of the .prom file to (atomically) replace after the run
+ * @return 0 on success, -1 on invalid value
+ */
+int	opt_metrics_file(t_opts *opts, const char *value)
+{
+	if (!value || !value[0])
+		return (-1);
+	opts->metrics_file = value;
+	return (0);
+}
+
+/**
+ * @brief Handles --report=json (one JSON object per run)
+ *
+ * @param opts Options structure to fill
+ * @param value Report format, only "json" is supported
+ * @return 0 on success, -1 on invalid value
+ */
+int	opt_report(t_opts *opts, const char *value)
+{
+	if (!value || ft_strncmp(value, "json", 5) != 0)
+		return (-1);
+	opts->report_json = 1;
+	return (0);
+}
+
+/**
+ * @brief Handles --no-builtins (always exec the external commands)
+ *
+ * @param opts Options structure to fill
+ * @param value Must be NULL, the flag takes no value
+ * @return 0 on success, -1 if a value was given
+ */
+int	opt_no_builtins(t_opts *opts, const char *value)
+{
+	if (value)
+		return (-1);
+	opts->no_builtins = 1;
+	return (0);
+}
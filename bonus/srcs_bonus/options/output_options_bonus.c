@@ -0,0 +1,45 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   output_options_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:23:58 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:23:58 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Handles --pipeline-name NAME (label of the exported series)
+ *
+ * @param opts Options structure to fill
+ * @param value Pipeline name
+ * @return 0 on success, -1 on invalid value
+ */
+int	opt_pipeline_name(t_opts *opts, const char *value)
+{
+	if (!value || !value[0])
+		return (-1);
+	opts->pipeline_name = value;
+	return (0);
+}
+
+/**
+ * @brief Handles --report-file PATH (append the JSON report to PATH)
+ *
+ * Without it the report goes to stderr.
+ *
+ * @param opts Options structure to fill
+ * @param value Path of the JSON lines file
+ * @return 0 on success, -1 on invalid value
+ */
+int	opt_report_file(t_opts *opts, const char *value)
+{
+	if (!value || !value[0])
+		return (-1);
+	opts->report_file = value;
+	return (0);
+}
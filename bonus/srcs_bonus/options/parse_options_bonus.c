@@ -0,0 +1,145 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_options_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:17:59 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:43:51 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Long options: name, whether a value follows, handler
+ */
+static const t_option	g_options[] = {
+	{"--sample-ms", 1, opt_sample_ms},
+	{"--metrics-file", 1, opt_metrics_file},
+	{"--pipeline-name", 1, opt_pipeline_name},
+	{"--report", 1, opt_report},
+	{"--report-file", 1, opt_report_file},
+	{"--no-builtins", 0, opt_no_builtins},
+	{"--no-rewrite", 1, opt_no_rewrite},
+	{"--explain", 0, opt_explain},
+	{"--unordered", 0, opt_unordered},
+	{"--threaded", 0, opt_threaded},
+	{"--fuse", 0, opt_fuse},
+	{"--steal", 0, opt_steal},
+	{"--shards", 1, opt_shards},
+	{"--parallel", 1, opt_parallel},
+	{"--inputs", 1, opt_inputs},
+	{"--fanout", 1, opt_fanout},
+	{"--tap", 1, opt_tap},
+	{"--tap-policy", 1, opt_tap_policy},
+	{NULL, 0, NULL}
+};
+
+/**
+ * @brief Looks up a long option in the option table
+ *
+ * @param arg Command line argument (e.g. "--sample-ms" or "--report=json")
+ * @return Pointer to the matching table entry or NULL if unknown
+ */
+static const t_option	*find_option(const char *arg)
+{
+	size_t	len;
+	int		i;
+
+	len = 0;
+	while (arg[len] && arg[len] != '=')
+		len++;
+	i = 0;
+	while (g_options[i].name)
+	{
+		if (ft_strlen(g_options[i].name) == len
+			&& ft_strncmp(g_options[i].name, arg, len) == 0)
+			return (&g_options[i]);
+		i++;
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Reports an invalid option on stderr
+ *
+ * @param arg The offending argument
+ * @return Always -1
+ */
+static int	option_error(const char *arg)
+{
+	ft_putstr_fd("pipex_bonus: invalid option: ", STDERR_FILENO);
+	ft_putendl_fd((char *)arg, STDERR_FILENO);
+	return (-1);
+}
+
+/**
+ * @brief Applies a single option and its value
+ *
+ * The value is taken from "--name=value" or from the next argument.
+ *
+ * @param opts Options structure to fill
+ * @param argc Number of command line arguments
+ * @param argv Array of command line arguments
+ * @param i Index of the option in argv
+ * @return Number of arguments consumed, or -1 on error
+ */
+static int	apply_option(t_opts *opts, int argc, char **argv, int i)
+{
+	const t_option	*option;
+	const char		*value;
+	int				consumed;
+
+	option = find_option(argv[i]);
+	if (!option)
+		return (option_error(argv[i]));
+	consumed = 1;
+	value = ft_strchr(argv[i], '=');
+	if (value)
+		value++;
+	else if (option->takes_value)
+	{
+		if (i + 1 >= argc)
+			return (option_error(argv[i]));
+		value = argv[i + 1];
+		consumed = 2;
+	}
+	if (option->apply(opts, value) < 0)
+		return (option_error(argv[i]));
+	return (consumed);
+}
+
+/**
+ * @brief Parses the leading "--" options of the command line
+ *
+ * Options must come before the infile (or here_doc). A lone "--"
+ * ends the option list.
+ *
+ * @param opts Options structure to fill
+ * @param argc Number of command line arguments
+ * @param argv Array of command line arguments
+ * @return Number of arguments consumed, or -1 on error
+ */
+int	parse_options(t_opts *opts, int argc, char **argv)
+{
+	int	i;
+	int	consumed;
+
+	ft_memset(opts, 0, sizeof(t_opts));
+	opts->pipeline_name = "pipex";
+	opts->rewrites = RW_ALL;
+	opts->inputs = 1;
+	i = 1;
+	while (i < argc && ft_strncmp(argv[i], "--", 2) == 0)
+	{
+		if (argv[i][2] == '\0')
+			return (i);
+		consumed = apply_option(opts, argc, argv, i);
+		if (consumed < 0)
+			return (-1);
+		i += consumed;
+	}
+	return (i - 1);
+}
@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   runtime_options_bonus.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:05:46 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:15:17 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Handles --threaded (run adjacent builtins as threads)
+ *
+ * Each run of adjacent builtin stages becomes a single process whose
+ * stages pass buffers over in-memory rings instead of pipes.
+ *
+ * @param opts Options structure to fill
+ * @param value Must be NULL, the flag takes no value
+ * @return 0 on success, -1 if a value was given
+ */
+int	opt_threaded(t_opts *opts, const char *value)
+{
+	if (value)
+		return (-1);
+	opts->threaded = 1;
+	return (0);
+}
+
+/**
+ * @brief Handles --fuse (run adjacent streaming builtins in one loop)
+ *
+ * Runs of cat, tr, head, grep, cut, sed, awk and a final wc become a
+ * single pass over each block read, without a pipe between them.
+ *
+ * @param opts Options structure to fill
+ * @param value Must be NULL, the flag takes no value
+ * @return 0 on success, -1 if a value was given
+ */
+int	opt_fuse(t_opts *opts, const char *value)
+{
+	if (value)
+		return (-1);
+	opts->fuse = 1;
+	return (0);
+}
+
+/**
+ * @brief Handles --steal (run builtin stages on a work-stealing pool)
+ *
+ * Implies --threaded and --fuse: the stateless head of each fused
+ * segment runs as block tasks spread over one worker per CPU.
+ *
+ * @param opts Options structure to fill
+ * @param value Must be NULL, the flag takes no value
+ * @return 0 on success, -1 if a value was given
+ */
+int	opt_steal(t_opts *opts, const char *value)
+{
+	if (value)
+		return (-1);
+	opts->steal = 1;
+	opts->threaded = 1;
+	opts->fuse = 1;
+	return (0);
+}
+
+/**
+ * @brief Handles --shards N (run the pipeline over N slices of infile)
+ *
+ * The infile is cut into N newline-aligned byte ranges, each fed to its
+ * own copy of the pipeline; the outputs are concatenated in order.
+ *
+ * @param opts Options structure to fill
+ * @param value Number of shards, at most SHARD_MAX
+ * @return 0 on success, -1 on invalid value
+ */
+int	opt_shards(t_opts *opts, const char *value)
+{
+	return (parse_count(value, SHARD_MAX, &opts->shards));
+}
+
+/**
+ * @brief Handles --parallel i=N (run N replicas of stage i)
+ *
+ * Stage i (counted from 1, as cmd1 cmd2 ...) gets its input in
+ * newline-aligned chunks spread over N replicas; their outputs are
+ * put back in input order.
+ *
+ * @param opts Options structure to fill
+ * @param value "i=N", N at most PARALLEL_MAX
+ * @return 0 on success, -1 on invalid value
+ */
+int	opt_parallel(t_opts *opts, const char *value)
+{
+	int	stage;
+	int	i;
+
+	if (!value || !ft_isdigit(value[0]))
+		return (-1);
+	stage = 0;
+	i = 0;
+	while (ft_isdigit(value[i]) && stage < 100000)
+		stage = stage * 10 + (value[i++] - '0');
+	if (value[i] != '=' || stage == 0)
+		return (-1);
+	opts->parallel_stage = stage;
+	return (parse_count(value + i + 1, PARALLEL_MAX, &opts->replicas));
+}
@@ -6,26 +6,12 @@
 /*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/09 04:25:23 by lakdogan          #+#    #+#             */
-/*   Updated: 2025/05/10 07:56:00 by lakdogan         ###   ########.fr       */
+/*   Updated: 2026/10/19 15:39:20 by lakdogan         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../inc_bonus/pipex_bonus.h"
 
-/**
- * @brief Prints usage instructions to stderr
- *
- * @param exit_code The exit code to return
- * @return The exit code provided
- */
-static int	print_usage(int exit_code)
-{
-	write(STDERR_FILENO, "Usage: ./pipex file1 cmd1 cmd2 ... cmdn file2\n", 47);
-	write(STDERR_FILENO, "   or: ./pipex here_doc LIMITER cmd1 cmd2 file\n",
-		47);
-	return (exit_code);
-}
-
 /**
  * @brief Initializes the context structure for heredoc mode
  *
@@ -50,6 +36,7 @@ static int	init_heredoc_context(t_pipex **context, char **argv, char **envp,
 	(*context)->cleaned = 0;
 	(*context)->cmd_count = argc - 4;
 	(*context)->pipe_count = (*context)->cmd_count - 1;
+	(*context)->cmd_strs = argv + 3;
 	return (EXIT_SUCCESS);
 }
 
@@ -89,16 +76,17 @@ static int	setup_heredoc_pipes(t_pipex *context)
 /**
  * @brief Handles the here_doc special case
  *
- * @param context Double pointer to the context structure
+ * @param opts Options parsed from the command line
  * @param argv Array of command line arguments
  * @param envp Array of environment variables
  * @param argc Number of command line arguments
  * @return Exit code from executing the commands
  */
-static int	handle_heredoc_case(t_pipex **context, char **argv, char **envp,
+static int	handle_heredoc_case(t_opts *opts, char **argv, char **envp,
 		int argc)
 {
-	int	exit_code;
+	t_pipex	*context;
+	int		exit_code;
 
 	exit_code = 0;
 	if (argc < 6)
@@ -108,19 +96,25 @@ static int	handle_heredoc_case(t_pipex **context, char **argv, char **envp,
 			60);
 		return (exit_code);
 	}
-	if (init_heredoc_context(context, argv, envp, argc) == EXIT_FAILURE)
+	if (init_heredoc_context(&context, argv, envp, argc) == EXIT_FAILURE)
 		return (exit_code);
-	if (setup_heredoc_pipes(*context) == EXIT_FAILURE)
+	if (setup_heredoc_pipes(context) == EXIT_FAILURE)
 		return (exit_code);
-	handle_heredoc(*context);
-	exit_code = handle_processes(*context, argv);
-	free_context(*context);
+	context->opts = *opts;
+	handle_heredoc(context);
+	exit_code = handle_processes(context);
+	free_context(context);
 	return (exit_code);
 }
 
 /**
  * @brief Main function of the pipex program
  *
+ * Leading "--" options are consumed first, the remaining arguments are
+ * then interpreted exactly as without options. Without --shards (or
+ * with an infile that cannot be split) run_shards() runs the pipeline
+ * once.
+ *
  * @param argc Number of command line arguments
  * @param argv Array of command line arguments
  * @param envp Array of environment variables
@@ -129,17 +123,25 @@ static int	handle_heredoc_case(t_pipex **context, char **argv, char **envp,
 int	main(int argc, char **argv, char **envp)
 {
 	t_pipex	*context;
+	t_opts	opts;
+	int		consumed;
 	int		exit_code;
 
 	exit_code = 0;
-	if (argc < 5)
+	consumed = parse_options(&opts, argc, argv);
+	if (consumed < 0)
+		return (print_usage(EXIT_FAILURE));
+	argc -= consumed;
+	argv += consumed;
+	if (argc < 4 + opts.inputs)
 		return (print_usage(exit_code));
 	if (ft_strncmp(argv[1], "here_doc", 8) == 0)
-		return (handle_heredoc_case(&context, argv, envp, argc));
-	context = init_context(argc, argv, envp);
+		return (handle_heredoc_case(&opts, argv, envp, argc));
+	context = init_context(argc, argv, envp, opts.inputs);
 	if (!context)
 		return (EXIT_FAILURE);
-	exit_code = handle_processes(context, argv);
+	context->opts = opts;
+	exit_code = run_shards(context);
 	free_context(context);
 	return (exit_code);
 }
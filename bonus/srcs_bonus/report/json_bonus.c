@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   json_bonus.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:23:58 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:23:58 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Appends a control character as a \u00XX escape
+ *
+ * @param buf Buffer to append to
+ * @param c Character to escape
+ */
+static void	json_escape_control(t_buf *buf, unsigned char c)
+{
+	static const char	hex[] = "0123456789abcdef";
+	char				esc[6];
+
+	ft_memcpy(esc, "\\u00", 4);
+	esc[4] = hex[c >> 4];
+	esc[5] = hex[c & 0xf];
+	buf_append(buf, esc, 6);
+}
+
+/**
+ * @brief Appends a JSON string literal with escaping
+ *
+ * Quote, backslash and control characters are escaped; other bytes are
+ * copied as is. A NULL string is written as null.
+ *
+ * @param buf Buffer to append to
+ * @param str String to encode
+ */
+void	json_string(t_buf *buf, const char *str)
+{
+	size_t	i;
+
+	if (!str)
+	{
+		buf_puts(buf, "null");
+		return ;
+	}
+	buf_puts(buf, "\"");
+	i = 0;
+	while (str[i])
+	{
+		if (str[i] == '"' || str[i] == '\\')
+			buf_append(buf, "\\", 1);
+		if ((unsigned char)str[i] < 0x20)
+			json_escape_control(buf, (unsigned char)str[i]);
+		else
+			buf_append(buf, str + i, 1);
+		i++;
+	}
+	buf_puts(buf, "\"");
+}
+
+/**
+ * @brief Appends ,"key":"value" (or null)
+ *
+ * @param buf Buffer to append to
+ * @param key Field name
+ * @param str Field value
+ */
+void	json_str(t_buf *buf, const char *key, const char *str)
+{
+	buf_puts(buf, ",\"");
+	buf_puts(buf, key);
+	buf_puts(buf, "\":");
+	json_string(buf, str);
+}
+
+/**
+ * @brief Appends ,"key":n, or null when n is negative (unknown)
+ *
+ * @param buf Buffer to append to
+ * @param key Field name
+ * @param n Field value
+ */
+void	json_long(t_buf *buf, const char *key, long n)
+{
+	buf_puts(buf, ",\"");
+	buf_puts(buf, key);
+	buf_puts(buf, "\":");
+	if (n < 0)
+		buf_puts(buf, "null");
+	else
+		buf_long(buf, n);
+}
+
+/**
+ * @brief Appends ,"key":true or ,"key":false
+ *
+ * @param buf Buffer to append to
+ * @param key Field name
+ * @param value Truth value
+ */
+void	json_bool(t_buf *buf, const char *key, int value)
+{
+	buf_puts(buf, ",\"");
+	buf_puts(buf, key);
+	buf_puts(buf, "\":");
+	if (value)
+		buf_puts(buf, "true");
+	else
+		buf_puts(buf, "false");
+}
@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   report_stage_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:23:58 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:27:56 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Appends ,"argv":[...] with the resolved arguments of a stage
+ *
+ * @param buf Buffer to append to
+ * @param argv NULL terminated argument vector
+ */
+static void	report_argv(t_buf *buf, char **argv)
+{
+	int	i;
+
+	buf_puts(buf, ",\"argv\":[");
+	i = 0;
+	while (argv && argv[i])
+	{
+		if (i > 0)
+			buf_puts(buf, ",");
+		json_string(buf, argv[i]);
+		i++;
+	}
+	buf_puts(buf, "]");
+}
+
+/**
+ * @brief Appends ,"rusage":{...} of a reaped stage
+ *
+ * @param buf Buffer to append to
+ * @param ru Resource usage as returned by wait4
+ */
+static void	report_rusage(t_buf *buf, struct rusage *ru)
+{
+	buf_puts(buf, ",\"rusage\":{\"utime_ns\":");
+	buf_long(buf, ru->ru_utime.tv_sec * 1000000000L
+		+ ru->ru_utime.tv_usec * 1000L);
+	json_long(buf, "stime_ns", ru->ru_stime.tv_sec * 1000000000L
+		+ ru->ru_stime.tv_usec * 1000L);
+	json_long(buf, "maxrss_bytes", (long)ru->ru_maxrss * MAXRSS_UNIT);
+	json_long(buf, "minflt", ru->ru_minflt);
+	json_long(buf, "majflt", ru->ru_majflt);
+	json_long(buf, "inblock", ru->ru_inblock);
+	json_long(buf, "oublock", ru->ru_oublock);
+	json_long(buf, "nvcsw", ru->ru_nvcsw);
+	json_long(buf, "nivcsw", ru->ru_nivcsw);
+	buf_puts(buf, "}");
+}
+
+/**
+ * @brief Appends the exit or signal status of a stage
+ *
+ * @param buf Buffer to append to
+ * @param stage Stage to describe
+ */
+static void	report_status(t_buf *buf, t_stage *stage)
+{
+	int	exit_code;
+	int	signal;
+
+	json_bool(buf, "reaped", stage->reaped);
+	if (!stage->reaped)
+		return ;
+	exit_code = -1;
+	signal = -1;
+	if (WIFEXITED(stage->raw_status))
+		exit_code = WEXITSTATUS(stage->raw_status);
+	if (WIFSIGNALED(stage->raw_status))
+		signal = WTERMSIG(stage->raw_status);
+	json_long(buf, "exit_code", exit_code);
+	json_long(buf, "signal", signal);
+	json_bool(buf, "core_dumped", signal >= 0
+		&& WCOREDUMP(stage->raw_status));
+	report_rusage(buf, &stage->usage);
+}
+
+/**
+ * @brief Appends how a stage was resolved: PATH lookup or builtin
+ *
+ * @param buf Buffer to append to
+ * @param stage Stage to describe
+ */
+static void	report_resolution(t_buf *buf, t_stage *stage)
+{
+	json_str(buf, "path", stage->path);
+	json_bool(buf, "cache_hit", stage->cache_hit);
+	if (stage->builtin)
+		json_str(buf, "builtin", stage->builtin->name);
+	else
+		json_str(buf, "builtin", NULL);
+}
+
+/**
+ * @brief Appends ,"stages":[...] with one object per stage
+ *
+ * @param context Pointer to the pipex context structure
+ * @param buf Buffer to append to
+ */
+void	report_stages(t_pipex *context, t_buf *buf)
+{
+	t_stage	*stage;
+	int		i;
+
+	buf_puts(buf, ",\"stages\":[");
+	i = 0;
+	while (i < context->cmd_count)
+	{
+		stage = &context->stages[i];
+		if (i > 0)
+			buf_puts(buf, ",");
+		buf_puts(buf, "{\"index\":");
+		buf_long(buf, i + 1);
+		json_str(buf, "command", stage->cmd_str);
+		report_argv(buf, stage->argv);
+		report_resolution(buf, stage);
+		json_long(buf, "pid", stage->pid);
+		json_long(buf, "fork_ns", epoch_ns(context, stage->fork_ns));
+		json_long(buf, "exec_ns", epoch_ns(context, stage->exec_ns));
+		json_long(buf, "exit_ns", epoch_ns(context, stage->exit_ns));
+		report_status(buf, stage);
+		buf_puts(buf, "}");
+		i++;
+	}
+	buf_puts(buf, "]");
+}
@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   write_report_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:23:58 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:34:44 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Converts a CLOCK_MONOTONIC reading to Unix epoch nanoseconds
+ *
+ * @param context Pointer to the pipex context structure
+ * @param mono_ns Monotonic time in nanoseconds, 0 if never recorded
+ * @return Epoch time in nanoseconds, or -1 if unknown
+ */
+long	epoch_ns(t_pipex *context, long mono_ns)
+{
+	if (mono_ns <= 0)
+		return (-1);
+	return (context->stats.start_epoch_ns
+		+ (mono_ns - context->stats.start_ns));
+}
+
+/**
+ * @brief Returns the size of a regular file
+ *
+ * @param fd Open file descriptor
+ * @return Size in bytes, or -1 if fd is not a regular file
+ */
+static long	file_size(int fd)
+{
+	struct stat	st;
+
+	if (fd < 0 || fstat(fd, &st) < 0 || !S_ISREG(st.st_mode))
+		return (-1);
+	return (st.st_size);
+}
+
+/**
+ * @brief Appends the infile and outfile objects
+ *
+ * @param context Pointer to the pipex context structure
+ * @param buf Buffer to append to
+ */
+static void	report_files(t_pipex *context, t_buf *buf)
+{
+	buf_puts(buf, ",\"infile\":{\"path\":");
+	if (context->is_heredoc)
+		json_string(buf, NULL);
+	else
+		json_string(buf, context->infile_path);
+	json_long(buf, "size", file_size(context->in_fd));
+	json_long(buf, "bytes_read", context->stats.bytes_in);
+	buf_puts(buf, "},\"outfile\":{\"path\":");
+	json_string(buf, context->outfile_path);
+	json_long(buf, "size", file_size(context->out_fd));
+	json_long(buf, "bytes_written", context->stats.bytes_out);
+	buf_puts(buf, "}");
+}
+
+/**
+ * @brief Appends the phase timestamps (epoch ns) and durations
+ *
+ * @param context Pointer to the pipex context structure
+ * @param buf Buffer to append to
+ */
+static void	report_times(t_pipex *context, t_buf *buf)
+{
+	t_run_stats	*stats;
+
+	stats = &context->stats;
+	buf_puts(buf, ",\"timestamps_ns\":{\"start\":");
+	buf_long(buf, stats->start_epoch_ns);
+	json_long(buf, "parsed", epoch_ns(context, stats->parsed_ns));
+	json_long(buf, "spawned", epoch_ns(context, stats->spawned_ns));
+	json_long(buf, "execed", epoch_ns(context, stats->execed_ns));
+	json_long(buf, "end", epoch_ns(context, stats->end_ns));
+	buf_puts(buf, "},\"durations_ns\":{\"heredoc\":");
+	buf_long(buf, stats->heredoc_ns);
+	json_long(buf, "wall", stats->end_ns - stats->start_ns);
+	buf_puts(buf, "}");
+}
+
+/**
+ * @brief Writes the JSON run record as a single line
+ *
+ * The record goes to stderr, or is appended to --report-file with a
+ * single write() so concurrent runs never interleave their lines.
+ *
+ * @param context Pointer to the pipex context structure
+ */
+void	write_report(t_pipex *context)
+{
+	t_buf	buf;
+	int		fd;
+
+	ft_memset(&buf, 0, sizeof(t_buf));
+	buf_puts(&buf, "{\"pipeline\":");
+	json_string(&buf, context->opts.pipeline_name);
+	json_long(&buf, "exit_code", context->stats.exit_code);
+	json_bool(&buf, "input_missing", context->input_missing);
+	json_bool(&buf, "heredoc", context->is_heredoc);
+	json_long(&buf, "heredoc_bytes", context->stats.heredoc_bytes);
+	json_long(&buf, "elided_stages", context->stats.elided);
+	json_long(&buf, "rewrites", context->stats.rewrites);
+	report_files(context, &buf);
+	report_times(context, &buf);
+	report_stages(context, &buf);
+	buf_puts(&buf, "}\n");
+	fd = STDERR_FILENO;
+	if (context->opts.report_file)
+		fd = open(context->opts.report_file, O_WRONLY | O_CREAT | O_APPEND,
+				0644);
+	if (fd < 0 || buf.failed || write(fd, buf.data, buf.len) < 0)
+		perror("pipex_bonus: report");
+	if (fd > STDERR_FILENO)
+		close(fd);
+	free(buf.data);
+}
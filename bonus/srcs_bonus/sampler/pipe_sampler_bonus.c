@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipe_sampler_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:17:59 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:45:04 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Closes the write ends of all pipes in the parent
+ *
+ * The read ends stay open so their fill level can be sampled.
+ * Writers still get EOF semantics because only readers are kept.
+ *
+ * @param context Pointer to the pipex context structure
+ */
+static void	close_write_ends(t_pipex *context)
+{
+	int	i;
+
+	i = 0;
+	while (i < context->pipe_count)
+	{
+		close(context->pipes[i * 2 + 1]);
+		context->pipes[i * 2 + 1] = -1;
+		i++;
+	}
+}
+
+/**
+ * @brief Reaps every child that has exited since the last call
+ *
+ * When a stage exits, the parent drops its copy of the stage's input
+ * pipe (the input of its whole group when it hosts threaded stages) so
+ * the upstream writer gets SIGPIPE just as without sampling.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param pids Array of process IDs of the stages
+ * @return Number of stages reaped
+ */
+static int	reap_stages(t_pipex *context, pid_t *pids)
+{
+	int	i;
+	int	first;
+	int	reaped;
+
+	reaped = 0;
+	i = reap_stage(context, pids, WNOHANG);
+	while (i >= 0)
+	{
+		first = 0;
+		if (i < context->cmd_count)
+			first = group_first(context, i);
+		if (first > 0 && context->pipes[(first - 1) * 2] >= 0)
+		{
+			close(context->pipes[(first - 1) * 2]);
+			context->pipes[(first - 1) * 2] = -1;
+		}
+		if (i < context->cmd_count)
+			reaped += group_size(context, i);
+		i = reap_stage(context, pids, WNOHANG);
+	}
+	if (i == REAP_ERROR)
+		return (context->cmd_count);
+	return (reaped);
+}
+
+/**
+ * @brief Waits for all stages while sampling pipe fill levels
+ *
+ * Replaces close_all_pipes() + wait_children() when --sample-ms is set
+ * and prints the per-pipe histograms once every stage has exited.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param pids Array of process IDs of the stages
+ * @return Exit code of the last command
+ */
+int	sample_pipes(t_pipex *context, pid_t *pids)
+{
+	int	live;
+
+	close_write_ends(context);
+	live = context->cmd_count;
+	while (live > 0)
+	{
+		take_sample(context);
+		usleep(context->opts.sample_ms * 1000);
+		live -= reap_stages(context, pids);
+	}
+	print_backpressure(context);
+	return (pipeline_exit_code(context,
+			context->stages[context->cmd_count - 1].raw_status));
+}
@@ -0,0 +1,126 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sample_pipe_fill_bonus.c                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:17:59 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:17:59 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Returns the capacity of a pipe in bytes
+ *
+ * Falls back to the common 64 KiB default where F_GETPIPE_SZ
+ * is not available.
+ *
+ * @param fd Either end of the pipe
+ * @return Pipe capacity in bytes
+ */
+static int	pipe_capacity(int fd)
+{
+	int	size;
+
+	size = fcntl(fd, F_GETPIPE_SZ);
+	if (size <= 0)
+		return (DEFAULT_PIPE_SIZE);
+	return (size);
+}
+
+/**
+ * @brief Allocates the per-pipe fill histograms
+ *
+ * Must run before the children are forked so that an allocation
+ * failure can still abort the whole pipeline cleanly.
+ *
+ * @param context Pointer to the pipex context structure
+ */
+void	init_sampler(t_pipex *context)
+{
+	t_sampler	*sampler;
+	int			i;
+
+	sampler = &context->sampler;
+	sampler->samples = 0;
+	sampler->hist = ft_calloc(context->pipe_count * SAMPLE_BUCKETS,
+			sizeof(int));
+	sampler->capacity = malloc(sizeof(int) * context->pipe_count);
+	if (!sampler->hist || !sampler->capacity)
+		cleanup_and_exit(context, "malloc failed", 1);
+	i = 0;
+	while (i < context->pipe_count)
+	{
+		sampler->capacity[i] = pipe_capacity(context->pipes[i * 2]);
+		i++;
+	}
+}
+
+/**
+ * @brief Maps a pipe fill level to a histogram bucket
+ *
+ * Bucket 0 is an empty pipe, buckets 1-4 are fill quartiles and
+ * bucket 5 means a PIPE_BUF sized write would block.
+ *
+ * @param bytes Number of unread bytes in the pipe
+ * @param capacity Pipe capacity in bytes
+ * @return Bucket index in [0, SAMPLE_BUCKETS)
+ */
+static int	fill_bucket(int bytes, int capacity)
+{
+	int	bucket;
+
+	if (bytes <= 0)
+		return (0);
+	if (bytes > capacity - PIPE_BUF)
+		return (SAMPLE_BUCKETS - 1);
+	bucket = 1 + (int)((long)bytes * 4 / capacity);
+	if (bucket > SAMPLE_BUCKETS - 2)
+		bucket = SAMPLE_BUCKETS - 2;
+	return (bucket);
+}
+
+/**
+ * @brief Records the current fill level of every pipe still held
+ *
+ * Pipes whose consumer has already exited are skipped.
+ *
+ * @param context Pointer to the pipex context structure
+ */
+void	take_sample(t_pipex *context)
+{
+	t_sampler	*sampler;
+	int			bytes;
+	int			bucket;
+	int			i;
+
+	sampler = &context->sampler;
+	i = 0;
+	while (i < context->pipe_count)
+	{
+		if (context->pipes[i * 2] >= 0
+			&& ioctl(context->pipes[i * 2], FIONREAD, &bytes) == 0)
+		{
+			bucket = fill_bucket(bytes, sampler->capacity[i]);
+			sampler->hist[i * SAMPLE_BUCKETS + bucket]++;
+		}
+		i++;
+	}
+	sampler->samples++;
+}
+
+/**
+ * @brief Frees the sampler histograms
+ *
+ * @param sampler Pointer to the sampler state
+ */
+void	free_sampler(t_sampler *sampler)
+{
+	free(sampler->hist);
+	free(sampler->capacity);
+	sampler->hist = NULL;
+	sampler->capacity = NULL;
+}
@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sampler_report_bonus.c                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:17:59 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 14:45:04 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Prints one histogram bucket as " label NN%"
+ *
+ * @param label Bucket label
+ * @param count Number of samples in the bucket
+ * @param total Number of samples taken for the pipe
+ */
+static void	put_bucket(const char *label, int count, int total)
+{
+	ft_putstr_fd(" ", STDERR_FILENO);
+	ft_putstr_fd((char *)label, STDERR_FILENO);
+	ft_putstr_fd(" ", STDERR_FILENO);
+	ft_putnbr_fd(count * 100 / total, STDERR_FILENO);
+	ft_putstr_fd("%", STDERR_FILENO);
+}
+
+/**
+ * @brief Interprets a pipe fill histogram
+ *
+ * A pipe that is mostly full has a slow consumer, one that is mostly
+ * empty has a slow producer.
+ *
+ * @param row Histogram of one pipe
+ * @param total Number of samples taken for the pipe
+ * @return Short human readable verdict
+ */
+static const char	*verdict(int *row, int total)
+{
+	if (row[SAMPLE_BUCKETS - 1] * 2 >= total)
+		return ("slow consumer");
+	if (row[0] * 2 >= total)
+		return ("slow producer");
+	return ("balanced");
+}
+
+/**
+ * @brief Prints the "pipe N (producer -> consumer):" prefix of an edge
+ *
+ * @param context Pointer to the pipex context structure
+ * @param i Index of the pipe
+ */
+static void	print_edge_name(t_pipex *context, int i)
+{
+	ft_putstr_fd("  pipe ", STDERR_FILENO);
+	ft_putnbr_fd(i + 1, STDERR_FILENO);
+	ft_putstr_fd(" (", STDERR_FILENO);
+	ft_putstr_fd(context->stages[i].cmd_str, STDERR_FILENO);
+	ft_putstr_fd(" -> ", STDERR_FILENO);
+	ft_putstr_fd(context->stages[i + 1].cmd_str, STDERR_FILENO);
+	ft_putstr_fd("):", STDERR_FILENO);
+}
+
+/**
+ * @brief Prints the fill histogram of the pipe between stage i and i + 1
+ *
+ * @param context Pointer to the pipex context structure
+ * @param i Index of the pipe
+ */
+static void	print_edge(t_pipex *context, int i)
+{
+	static const char	*labels[SAMPLE_BUCKETS] = {"empty", "<25%", "<50%",
+		"<75%", "<100%", "full"};
+	int					*row;
+	int					total;
+	int					b;
+
+	row = context->sampler.hist + i * SAMPLE_BUCKETS;
+	total = 0;
+	b = 0;
+	while (b < SAMPLE_BUCKETS)
+		total += row[b++];
+	if (total == 0)
+		return ;
+	print_edge_name(context, i);
+	b = 0;
+	while (b < SAMPLE_BUCKETS)
+	{
+		put_bucket(labels[b], row[b], total);
+		b++;
+	}
+	ft_putstr_fd(" => ", STDERR_FILENO);
+	ft_putendl_fd((char *)verdict(row, total), STDERR_FILENO);
+}
+
+/**
+ * @brief Prints the per-pipe fill histograms collected by the sampler
+ *
+ * Pipes inside a thread group are skipped: the rings replace them.
+ *
+ * @param context Pointer to the pipex context structure
+ */
+void	print_backpressure(t_pipex *context)
+{
+	int	i;
+
+	ft_putstr_fd("pipex_bonus: pipe backpressure over ", STDERR_FILENO);
+	ft_putnbr_fd(context->sampler.samples, STDERR_FILENO);
+	ft_putstr_fd(" samples every ", STDERR_FILENO);
+	ft_putnbr_fd(context->opts.sample_ms, STDERR_FILENO);
+	ft_putendl_fd(" ms", STDERR_FILENO);
+	i = 0;
+	while (i < context->pipe_count)
+	{
+		if (context->stages[i].host != context->stages[i + 1].host)
+			print_edge(context, i);
+		i++;
+	}
+}
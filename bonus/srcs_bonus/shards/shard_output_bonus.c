@@ -0,0 +1,130 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shard_output_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:10:33 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:10:33 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Appends a shard's temporary file to the outfile
+ *
+ * copy_file_range() lets the kernel move (or reflink) the data; an
+ * outfile it refuses (pipe, tty, other file system on old kernels) is
+ * finished with read/write from where the copy stopped.
+ *
+ * @param fd Temporary file of the shard
+ * @param out_fd Outfile descriptor, positioned after the previous shard
+ * @return 0 on success, -1 on error
+ */
+static int	append_shard(int fd, int out_fd)
+{
+	ssize_t	n;
+
+	if (lseek(fd, 0, SEEK_SET) < 0)
+		return (-1);
+	n = 1;
+	while (n != 0)
+	{
+		n = copy_range(fd, out_fd, SHARD_COPY);
+		if (n < 0 && errno != EINTR)
+			return (copy_fd(fd, out_fd));
+	}
+	return (0);
+}
+
+/**
+ * @brief Waits for one shard process
+ *
+ * @param shard Shard to wait for; its status is filled in
+ */
+static void	wait_shard(t_shard *shard)
+{
+	while (waitpid(shard->pid, &shard->status, 0) < 0)
+	{
+		if (errno != EINTR)
+		{
+			shard->status = 1 << 8;
+			return ;
+		}
+	}
+}
+
+/**
+ * @brief Combines the exit codes of the shards
+ *
+ * A failure (neither 0 nor 1) wins. 1 is what a final grep returns for
+ * "no match", so the run returns 1 only if every shard did.
+ *
+ * @param shards Shards, already waited for
+ * @param count Number of shards
+ * @return Exit code of the sharded run
+ */
+static int	shard_exit_code(t_shard *shards, int count)
+{
+	int	ran;
+	int	ones;
+	int	code;
+	int	k;
+
+	ran = 0;
+	ones = 0;
+	k = 0;
+	while (k < count)
+	{
+		if (shards[k].pid > 0)
+		{
+			ran++;
+			code = status_exit_code(shards[k].status);
+			if (code > 1)
+				return (code);
+			ones += code;
+		}
+		k++;
+	}
+	return (ran > 0 && ones == ran);
+}
+
+/**
+ * @brief Waits for the shards in order and concatenates their outputs
+ *
+ * Shard k is appended as soon as it and every shard before it are done,
+ * while later shards are still running.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param shards Started shards
+ * @param count Number of shards
+ * @return Exit code of the sharded run
+ */
+int	collect_shards(t_pipex *context, t_shard *shards, int count)
+{
+	int	failed;
+	int	k;
+
+	failed = 0;
+	k = 0;
+	while (k < count)
+	{
+		if (shards[k].pid > 0)
+			wait_shard(&shards[k]);
+		if (shards[k].fd >= 0)
+		{
+			if (!failed && append_shard(shards[k].fd, context->out_fd) < 0)
+				failed = 1;
+			close(shards[k].fd);
+		}
+		k++;
+	}
+	if (failed)
+	{
+		perror(context->outfile_path);
+		return (1);
+	}
+	return (shard_exit_code(shards, count));
+}
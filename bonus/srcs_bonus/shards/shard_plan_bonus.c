@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shard_plan_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:10:33 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:27:09 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Finds the offset just past the first newline at or after pos
+ *
+ * @param fd Infile descriptor, read with pread() so its offset stays put
+ * @param pos Offset to start scanning from
+ * @param size Size of the infile
+ * @return Offset following the newline, or size if there is none
+ */
+static off_t	line_end(int fd, off_t pos, off_t size)
+{
+	char	buf[4096];
+	ssize_t	n;
+	ssize_t	i;
+
+	while (pos < size)
+	{
+		n = pread(fd, buf, sizeof(buf), pos);
+		if (n < 0 && errno == EINTR)
+			continue ;
+		if (n <= 0)
+			return (size);
+		i = 0;
+		while (i < n && buf[i] != '\n')
+			i++;
+		if (i < n)
+			return (pos + i + 1);
+		pos += n;
+	}
+	return (size);
+}
+
+/**
+ * @brief Decides how many shards the run can use
+ *
+ * Only a single regular infile can be split by offset; here_doc, pipes,
+ * devices, --inputs and --fanout keep the single pipeline. A file
+ * smaller than the shard count gets one shard per byte.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param size Where to store the infile size
+ * @return Number of shards, 1 when sharding does not apply
+ */
+static int	shard_count(t_pipex *context, off_t *size)
+{
+	struct stat	st;
+
+	if (context->opts.shards <= 1 || context->is_heredoc
+		|| context->input_missing || context->infile_count > 1
+		|| context->opts.fanout_count)
+		return (1);
+	if (fstat(context->in_fd, &st) < 0 || !S_ISREG(st.st_mode)
+		|| st.st_size <= 1)
+		return (1);
+	*size = st.st_size;
+	if (st.st_size < context->opts.shards)
+		return ((int)st.st_size);
+	return (context->opts.shards);
+}
+
+/**
+ * @brief Cuts the infile into newline-aligned byte ranges
+ *
+ * Cut points start at equal fractions of the file and move forward to
+ * the next line start, so no line is split between two shards. A line
+ * longer than a range leaves the following shard empty.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param count Where to store the number of shards
+ * @return Array of count shards, or NULL when sharding does not apply
+ */
+t_shard	*plan_shards(t_pipex *context, int *count)
+{
+	t_shard	*shards;
+	off_t	size;
+	off_t	cut;
+	int		k;
+
+	*count = shard_count(context, &size);
+	if (*count <= 1)
+		return (NULL);
+	shards = malloc(sizeof(t_shard) * *count);
+	if (!shards)
+		return (NULL);
+	ft_memset(shards, 0, sizeof(t_shard) * *count);
+	cut = 0;
+	k = 0;
+	while (k < *count)
+	{
+		shards[k].start = cut;
+		shards[k].fd = -1;
+		cut = size;
+		if (k < *count - 1)
+			cut = line_end(context->in_fd, size * (k + 1) / *count - 1, size);
+		shards[k].end = cut;
+		k++;
+	}
+	return (shards);
+}
+
+/**
+ * @brief Prints the shard ranges when --explain is given
+ *
+ * @param context Pointer to the pipex context structure
+ * @param shards Planned shards
+ * @param count Number of shards
+ */
+void	explain_shards(t_pipex *context, t_shard *shards, int count)
+{
+	int	k;
+
+	if (!context->opts.explain)
+		return ;
+	ft_putstr_fd("pipex_bonus: explain: shards:", STDERR_FILENO);
+	k = 0;
+	while (k < count)
+	{
+		ft_putstr_fd(" [", STDERR_FILENO);
+		put_long_fd(shards[k].start, STDERR_FILENO);
+		ft_putstr_fd(",", STDERR_FILENO);
+		put_long_fd(shards[k].end, STDERR_FILENO);
+		ft_putstr_fd(")", STDERR_FILENO);
+		k++;
+	}
+	ft_putstr_fd("\n", STDERR_FILENO);
+}
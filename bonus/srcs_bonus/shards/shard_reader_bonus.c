@@ -0,0 +1,81 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shard_reader_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:10:33 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:10:33 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Copies the shard's byte range of the infile into fd
+ *
+ * pread() leaves the shared infile offset alone, so every shard reader
+ * can use the descriptor inherited from the parent.
+ *
+ * @param in_fd Infile descriptor
+ * @param shard Shard whose range is copied
+ * @param fd Write end of the shard's input pipe
+ * @return 0 once the range is copied, -1 on error
+ */
+static int	feed_range(int in_fd, t_shard *shard, int fd)
+{
+	char	buf[IO_CHUNK];
+	off_t	pos;
+	ssize_t	n;
+	size_t	want;
+
+	pos = shard->start;
+	while (pos < shard->end)
+	{
+		want = IO_CHUNK;
+		if (shard->end - pos < IO_CHUNK)
+			want = shard->end - pos;
+		n = pread(in_fd, buf, want, pos);
+		if (n < 0 && errno == EINTR)
+			continue ;
+		if (n <= 0 || write_all(fd, buf, n) < 0)
+			return (-1);
+		pos += n;
+	}
+	return (0);
+}
+
+/**
+ * @brief Forks the bounded reader of a shard and makes its pipe the input
+ *
+ * The reader stops at the end of the range, so the first stage of the
+ * shard sees EOF there. The parent keeps only the read end; stages
+ * forked afterwards never hold the write end.
+ *
+ * @param context Pointer to the pipex context structure (in the shard)
+ * @param shard Shard whose range is read
+ */
+void	start_shard_reader(t_pipex *context, t_shard *shard)
+{
+	int		fds[2];
+	pid_t	pid;
+
+	if (pipe(fds) < 0)
+		cleanup_and_exit(context, "pipe failed", 1);
+	pid = fork();
+	if (pid < 0)
+		cleanup_and_exit(context, "fork failed", 1);
+	if (pid == 0)
+	{
+		context->is_child = 1;
+		close(fds[0]);
+		if (feed_range(context->in_fd, shard, fds[1]) < 0 && errno != EPIPE)
+			cleanup_and_exit(context, "shard read failed", 1);
+		close(fds[1]);
+		cleanup_and_exit(context, NULL, 0);
+	}
+	close(fds[1]);
+	close(context->in_fd);
+	context->in_fd = fds[0];
+}
@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   shard_run_bonus.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:10:33 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:10:33 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Gives the shard process its own set of stage pipes
+ *
+ * The pipes created by init_context() are shared by every shard, so
+ * each shard closes them and opens fresh ones after forking its reader.
+ *
+ * @param context Pointer to the pipex context structure (in the shard)
+ */
+static void	reopen_pipes(t_pipex *context)
+{
+	int	i;
+
+	i = 0;
+	while (i < context->pipe_count)
+	{
+		if (pipe(context->pipes + (i * 2)) < 0)
+			cleanup_and_exit(context, "pipe failed", 1);
+		i++;
+	}
+}
+
+/**
+ * @brief Runs shard k of the pipeline in the forked shard process
+ *
+ * Shard 0 writes straight to the outfile; the others write to their
+ * temporary file. Only shard 0 explains, samples and reports, so the
+ * exporters describe a single copy of the pipeline.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param shards Planned shards
+ * @param count Number of shards
+ * @param k Index of this shard
+ */
+static void	enter_shard(t_pipex *context, t_shard *shards, int count, int k)
+{
+	int	j;
+
+	close_all_pipe_fds(context);
+	start_shard_reader(context, &shards[k]);
+	reopen_pipes(context);
+	if (k > 0)
+	{
+		close(context->out_fd);
+		context->out_fd = shards[k].fd;
+		context->opts.explain = 0;
+		context->opts.sample_ms = 0;
+		context->opts.metrics_file = NULL;
+		context->opts.report_json = 0;
+	}
+	j = 0;
+	while (j < count)
+	{
+		if (j != k && shards[j].fd >= 0)
+			close(shards[j].fd);
+		j++;
+	}
+	free(shards);
+	cleanup_and_exit(context, NULL, handle_processes(context));
+}
+
+/**
+ * @brief Opens the output of shard k and forks its process
+ *
+ * Empty ranges (left behind by a line longer than a range) are skipped.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param shards Planned shards
+ * @param count Number of shards
+ * @param k Index of the shard to start
+ */
+static void	spawn_shard(t_pipex *context, t_shard *shards, int count, int k)
+{
+	if (shards[k].start == shards[k].end)
+		return ;
+	if (k > 0)
+	{
+		shards[k].fd = open_tmpfile(NULL);
+		if (shards[k].fd < 0)
+			cleanup_and_exit(context, "shard temporary file failed", 1);
+	}
+	shards[k].pid = fork();
+	if (shards[k].pid < 0)
+		cleanup_and_exit(context, "fork failed", 1);
+	if (shards[k].pid == 0)
+		enter_shard(context, shards, count, k);
+}
+
+/**
+ * @brief Runs the pipeline once per infile range and joins the outputs
+ *
+ * Falls back to a single handle_processes() run when the input cannot
+ * be split (see plan_shards()).
+ *
+ * @param context Pointer to the pipex context structure
+ * @return Combined exit code of the shards
+ */
+int	run_shards(t_pipex *context)
+{
+	t_shard	*shards;
+	int		count;
+	int		k;
+	int		exit_code;
+
+	shards = plan_shards(context, &count);
+	if (!shards)
+		return (handle_processes(context));
+	explain_shards(context, shards, count);
+	k = 0;
+	while (k < count)
+	{
+		spawn_shard(context, shards, count, k);
+		k++;
+	}
+	exit_code = collect_shards(context, shards, count);
+	free(shards);
+	return (exit_code);
+}
@@ -0,0 +1,43 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   early_stop_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:03:46 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:30:19 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Stops the stages feeding a stage that has exited on purpose
+ *
+ * Once stage i is gone nothing reads its input pipe any more, so every
+ * earlier stage would die of SIGPIPE on its next write anyway. Sending
+ * it right away keeps a slow producer from running on (or blocking in
+ * a long computation) after a head stage has all it needs, and leaves
+ * the same exit status the shell would report. Only stages not yet
+ * reaped are signalled, so their pids cannot have been reused. A
+ * stage followed by a --fanout still feeds its branch, so neither it
+ * nor the stages before it are stopped (a --tap does not count).
+ *
+ * @param context Pointer to the pipex context structure
+ * @param i Index of the stage that exited
+ */
+void	stop_upstream(t_pipex *context, int i)
+{
+	int	j;
+
+	j = i;
+	while (j > 0 && !(context->stages[j - 1].fanout & FANOUT_BRANCH))
+		j--;
+	while (j < i)
+	{
+		if (!context->stages[j].reaped && context->stages[j].pid > 0)
+			kill(context->stages[j].pid, SIGPIPE);
+		j++;
+	}
+}
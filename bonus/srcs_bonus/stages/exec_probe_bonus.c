@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   exec_probe_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:21:43 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:23:58 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Opens a close-on-exec probe pipe for stage i before it is forked
+ *
+ * The child's copy of the write end disappears at execve(), so the parent
+ * sees EOF on the read end at the moment the stage has been exec'ed.
+ * Probes are only opened when an exporter needs the spawn latency.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param i Index of the stage
+ */
+void	open_exec_probe(t_pipex *context, int i)
+{
+	int	*probe;
+
+	context->stages[i].fork_ns = now_ns(CLOCK_MONOTONIC);
+	if (!context->opts.metrics_file && !context->opts.report_json)
+		return ;
+	probe = context->stages[i].probe;
+	if (pipe(probe) < 0)
+	{
+		probe[0] = -1;
+		probe[1] = -1;
+		return ;
+	}
+	fcntl(probe[0], F_SETFD, FD_CLOEXEC);
+	fcntl(probe[1], F_SETFD, FD_CLOEXEC);
+}
+
+/**
+ * @brief Drops the parent's copy of the probe write end after fork
+ *
+ * @param context Pointer to the pipex context structure
+ * @param i Index of the stage
+ * @param pid Return value of fork()
+ */
+void	close_exec_probe(t_pipex *context, int i, pid_t pid)
+{
+	if (pid == 0 || context->stages[i].probe[1] < 0)
+		return ;
+	close(context->stages[i].probe[1]);
+	context->stages[i].probe[1] = -1;
+}
+
+/**
+ * @brief Collects the probes that are still pending into a pollfd array
+ *
+ * @param context Pointer to the pipex context structure
+ * @param fds Array of at least cmd_count pollfd entries
+ * @param map Stage index of every pollfd entry
+ * @return Number of pending probes
+ */
+static int	fill_pollfds(t_pipex *context, struct pollfd *fds, int *map)
+{
+	int	i;
+	int	n;
+
+	i = 0;
+	n = 0;
+	while (i < context->cmd_count)
+	{
+		if (context->stages[i].probe[0] >= 0)
+		{
+			fds[n].fd = context->stages[i].probe[0];
+			fds[n].events = POLLIN;
+			fds[n].revents = 0;
+			map[n++] = i;
+		}
+		i++;
+	}
+	return (n);
+}
+
+/**
+ * @brief Marks every probe that reported EOF as exec'ed
+ *
+ * @param context Pointer to the pipex context structure
+ * @param fds Polled probe descriptors
+ * @param map Stage index of every pollfd entry
+ * @param n Number of entries
+ */
+static void	collect_probes(t_pipex *context, struct pollfd *fds, int *map,
+		int n)
+{
+	t_stage	*stage;
+	int		k;
+
+	k = 0;
+	while (k < n)
+	{
+		if (fds[k].revents)
+		{
+			stage = &context->stages[map[k]];
+			stage->exec_ns = now_ns(CLOCK_MONOTONIC);
+			close(stage->probe[0]);
+			stage->probe[0] = -1;
+		}
+		k++;
+	}
+}
+
+/**
+ * @brief Waits until every probed stage has exec'ed (or exited)
+ *
+ * @param context Pointer to the pipex context structure
+ */
+void	wait_exec_probes(t_pipex *context)
+{
+	struct pollfd	*fds;
+	int				*map;
+	int				n;
+
+	fds = malloc(sizeof(struct pollfd) * context->cmd_count);
+	map = malloc(sizeof(int) * context->cmd_count);
+	if (fds && map)
+	{
+		n = fill_pollfds(context, fds, map);
+		while (n > 0 && poll(fds, n, -1) >= 0)
+		{
+			collect_probes(context, fds, map, n);
+			n = fill_pollfds(context, fds, map);
+		}
+	}
+	free(fds);
+	free(map);
+	context->stats.execed_ns = now_ns(CLOCK_MONOTONIC);
+}
@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   init_stages_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:21:43 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:27:09 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Tokenizes and resolves every stage in the parent
+ *
+ * Doing this once before forking lets repeated commands share a single
+ * PATH lookup and gives the exporters the resolved argv of every stage.
+ * Stages served by an in-process builtin skip the PATH lookup.
+ * The children still fall back to launch_command_bonus() for error
+ * reporting when a stage could not be resolved.
+ *
+ * @param context Pointer to the pipex context structure
+ */
+void	init_stages(t_pipex *context)
+{
+	int	i;
+
+	context->stages = ft_calloc(context->cmd_count, sizeof(t_stage));
+	if (!context->stages)
+		cleanup_and_exit(context, "malloc failed", 1);
+	if (context->opts.parallel_stage > context->cmd_count)
+		cleanup_and_exit(context, "--parallel: no such stage", 1);
+	i = 0;
+	while (i < context->cmd_count)
+	{
+		context->stages[i].cmd_str = context->cmd_strs[i];
+		context->stages[i].probe[0] = -1;
+		context->stages[i].probe[1] = -1;
+		context->stages[i].host = -1;
+		if (i + 1 == context->opts.parallel_stage)
+			context->stages[i].replicas = context->opts.replicas;
+		context->stages[i].argv = shell_split(context, context->cmd_strs[i]);
+		if (context->opts.no_builtins || !match_builtin(&context->stages[i]))
+			resolve_stage(context, i);
+		i++;
+	}
+}
+
+/**
+ * @brief Releases what a single stage owns and closes its exec probe
+ *
+ * @param stage Stage to clear
+ */
+void	clear_stage(t_stage *stage)
+{
+	free_builtin_state(stage);
+	free_shell_split(stage->argv);
+	stage->argv = NULL;
+	free(stage->path);
+	stage->path = NULL;
+	free(stage->label);
+	stage->label = NULL;
+	if (stage->probe[0] >= 0)
+		close(stage->probe[0]);
+	if (stage->probe[1] >= 0)
+		close(stage->probe[1]);
+	stage->probe[0] = -1;
+	stage->probe[1] = -1;
+}
+
+/**
+ * @brief Frees the stage table and closes any exec probe still open
+ *
+ * @param context Pointer to the pipex context structure
+ */
+void	free_stages(t_pipex *context)
+{
+	int	i;
+
+	free_fanouts(context);
+	if (!context->stages)
+		return ;
+	i = 0;
+	while (i < context->cmd_count)
+	{
+		clear_stage(&context->stages[i]);
+		i++;
+	}
+	free(context->stages);
+	context->stages = NULL;
+}
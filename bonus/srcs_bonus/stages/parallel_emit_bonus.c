@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parallel_emit_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:15:17 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:15:17 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Tells whether stage i runs as replicas (--parallel)
+ *
+ * @param context Pointer to the pipex context structure
+ * @param i Index of the stage, may be out of range
+ * @return 1 if the stage is replicated, 0 otherwise
+ */
+int	parallel_stage(t_pipex *context, int i)
+{
+	return (i >= 0 && i < context->cmd_count
+		&& context->stages[i].replicas > 1);
+}
+
+/**
+ * @brief Reaps the replica of the oldest chunk and frees its slot
+ *
+ * @param par Parallel stage state
+ * @param slot Slot of chunk par->emit, whose output is complete
+ */
+static void	finish_replica(t_parallel *par, t_replica *slot)
+{
+	int	status;
+	int	code;
+
+	if (slot->in_fd >= 0)
+		close(slot->in_fd);
+	slot->in_fd = -1;
+	status = 0;
+	waitpid(slot->pid, &status, 0);
+	code = status_exit_code(status);
+	if (code > 1 && !par->failed)
+		par->failed = code;
+	par->ones += (code == 1);
+	par->ran++;
+	free(slot->input.data);
+	free(slot->output.data);
+	ft_memset(&slot->input, 0, sizeof(t_buf));
+	ft_memset(&slot->output, 0, sizeof(t_buf));
+	slot->pid = 0;
+	par->emit++;
+}
+
+/**
+ * @brief Writes out the chunks whose turn has come
+ *
+ * The oldest chunk's kept output is flushed; once its replica closed
+ * its output, the slot is freed and the next chunk becomes the oldest.
+ *
+ * @param par Parallel stage state
+ * @return 0 on success, -1 on write error
+ */
+int	parallel_advance(t_parallel *par)
+{
+	t_replica	*slot;
+
+	while (1)
+	{
+		slot = &par->slots[par->emit % par->count];
+		if (slot->pid <= 0 || slot->seq != par->emit)
+			return (0);
+		if (slot->output.len && write_all(STDOUT_FILENO, slot->output.data,
+				slot->output.len) < 0)
+			return (-1);
+		slot->output.len = 0;
+		if (slot->out_fd >= 0)
+			return (0);
+		finish_replica(par, slot);
+	}
+}
+
+/**
+ * @brief Exit status of the replicated stage
+ *
+ * A failure (neither 0 nor 1) wins; 1 (grep: no match) only if every
+ * replica returned it.
+ *
+ * @param par Parallel stage state, after the last chunk
+ * @return Exit status of the stage
+ */
+int	parallel_status(t_parallel *par)
+{
+	if (par->failed)
+		return (par->failed);
+	return (par->ran > 0 && par->ones == par->ran);
+}
@@ -0,0 +1,136 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parallel_io_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:15:17 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:15:17 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Reads the stage input into the pending buffer
+ *
+ * @param par Parallel stage state
+ * @return 0 on success, -1 on error
+ */
+static int	read_input(t_parallel *par)
+{
+	char	buf[IO_CHUNK];
+	ssize_t	n;
+
+	n = read(STDIN_FILENO, buf, IO_CHUNK);
+	if (n < 0 && errno == EINTR)
+		return (0);
+	if (n < 0)
+		return (-1);
+	if (n == 0)
+		par->in_eof = 1;
+	buf_append(&par->pending, buf, n);
+	return (-par->pending.failed);
+}
+
+/**
+ * @brief Writes as much of the slot's chunk as its replica accepts
+ *
+ * The input pipe is closed once the chunk is sent, or when the replica
+ * stopped reading (EPIPE), so that it sees EOF.
+ *
+ * @param slot Slot whose input pipe is writable
+ */
+static void	feed_replica(t_replica *slot)
+{
+	ssize_t	n;
+
+	n = write(slot->in_fd, slot->input.data + slot->sent,
+			slot->input.len - slot->sent);
+	if (n > 0)
+		slot->sent += n;
+	if ((n < 0 && errno != EAGAIN && errno != EINTR)
+		|| slot->sent == slot->input.len)
+	{
+		close(slot->in_fd);
+		slot->in_fd = -1;
+		free(slot->input.data);
+		ft_memset(&slot->input, 0, sizeof(t_buf));
+	}
+}
+
+/**
+ * @brief Reads output of a replica
+ *
+ * The replica of the oldest chunk still running writes straight to
+ * stdout; later chunks are kept in their slot until their turn.
+ *
+ * @param par Parallel stage state
+ * @param slot Slot whose output pipe is readable
+ * @return 0 on success, -1 on error
+ */
+static int	drain_replica(t_parallel *par, t_replica *slot)
+{
+	char	buf[IO_CHUNK];
+	ssize_t	n;
+
+	n = read(slot->out_fd, buf, IO_CHUNK);
+	if (n < 0 && errno == EINTR)
+		return (0);
+	if (n <= 0)
+	{
+		close(slot->out_fd);
+		slot->out_fd = -1;
+		return (0);
+	}
+	if (slot->seq == par->emit)
+		return (write_all(STDOUT_FILENO, buf, n));
+	buf_append(&slot->output, buf, n);
+	return (-slot->output.failed);
+}
+
+/**
+ * @brief Serves a descriptor reported ready by poll()
+ *
+ * @param par Parallel stage state
+ * @param fd Ready descriptor: stdin or a pipe of a replica
+ * @return 0 on success, -1 on error
+ */
+static int	dispatch(t_parallel *par, int fd)
+{
+	int	k;
+
+	if (fd == STDIN_FILENO)
+		return (read_input(par));
+	k = 0;
+	while (k < par->count)
+	{
+		if (par->slots[k].in_fd == fd)
+			feed_replica(&par->slots[k]);
+		else if (par->slots[k].out_fd == fd)
+			return (drain_replica(par, &par->slots[k]));
+		k++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Serves every descriptor of the poll set that is ready
+ *
+ * @param par Parallel stage state, after poll()
+ * @return 0 on success, -1 on error
+ */
+int	parallel_serve(t_parallel *par)
+{
+	int	k;
+
+	k = 0;
+	while (k < par->nfds)
+	{
+		if (par->fds[k].revents && dispatch(par, par->fds[k].fd) < 0)
+			return (-1);
+		k++;
+	}
+	return (0);
+}
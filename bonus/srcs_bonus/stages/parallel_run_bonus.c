@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parallel_run_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:15:17 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:15:17 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Appends a descriptor to the poll set
+ *
+ * @param par Parallel stage state
+ * @param fd Descriptor to watch
+ * @param events Events to wait for
+ */
+static void	add_fd(t_parallel *par, int fd, short events)
+{
+	par->fds[par->nfds].fd = fd;
+	par->fds[par->nfds].events = events;
+	par->fds[par->nfds].revents = 0;
+	par->nfds++;
+}
+
+/**
+ * @brief Builds the poll set
+ *
+ * stdin is only read while less than a chunk is buffered or the next
+ * slot is free, so a slow replica holds back the input. It is dropped
+ * once a replica failed, as a single failing copy would stop reading.
+ *
+ * @param par Parallel stage state
+ * @return Number of descriptors to poll, 0 once everything is done
+ */
+static int	build_poll(t_parallel *par)
+{
+	int	k;
+
+	par->nfds = 0;
+	if (!par->in_eof && !par->failed && (par->pending.len < PARALLEL_CHUNK
+			|| par->slots[par->next_seq % par->count].pid == 0))
+		add_fd(par, STDIN_FILENO, POLLIN);
+	k = 0;
+	while (k < par->count)
+	{
+		if (par->slots[k].in_fd >= 0)
+			add_fd(par, par->slots[k].in_fd, POLLOUT);
+		if (par->slots[k].out_fd >= 0)
+			add_fd(par, par->slots[k].out_fd, POLLIN);
+		k++;
+	}
+	return (par->nfds);
+}
+
+/**
+ * @brief Allocates the slots and the poll set
+ *
+ * @param par Parallel stage state to fill
+ * @param context Pointer to the pipex context structure
+ * @param i Index of the replicated stage
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	parallel_open(t_parallel *par, t_pipex *context, int i)
+{
+	int	k;
+
+	ft_memset(par, 0, sizeof(t_parallel));
+	par->context = context;
+	par->stage = i;
+	par->count = context->stages[i].replicas;
+	par->slots = ft_calloc(par->count, sizeof(t_replica));
+	par->fds = malloc(sizeof(struct pollfd) * (2 * par->count + 1));
+	if (!par->slots || !par->fds)
+		return (-1);
+	k = 0;
+	while (k < par->count)
+	{
+		par->slots[k].in_fd = -1;
+		par->slots[k].out_fd = -1;
+		k++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Releases the slots, the poll set and the pending input
+ *
+ * @param par Parallel stage state
+ */
+static void	parallel_close(t_parallel *par)
+{
+	free(par->slots);
+	free(par->fds);
+	free(par->pending.data);
+}
+
+/**
+ * @brief Runs stage i as replicas over chunks of its input
+ *
+ * The process reads stdin, cuts it into newline-aligned chunks and hands
+ * them to the slots round robin; each chunk is run by a fresh replica,
+ * since an unmodified command gives no way to tell where the output of
+ * one chunk ends when it is fed several. Outputs are written in chunk
+ * order, so the next stage sees the same bytes as with a single copy.
+ * Only line-independent commands give the same result.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param i Index of the replicated stage
+ * @return Exit status of the stage
+ */
+int	run_parallel(t_pipex *context, int i)
+{
+	t_parallel	par;
+	int			ret;
+
+	signal(SIGPIPE, SIG_IGN);
+	ret = parallel_open(&par, context, i);
+	while (ret == 0)
+	{
+		ret = parallel_advance(&par);
+		parallel_schedule(&par);
+		if (ret < 0 || build_poll(&par) == 0)
+			break ;
+		if (poll(par.fds, par.nfds, -1) < 0)
+			ret = -(errno != EINTR);
+		else
+			ret = parallel_serve(&par);
+	}
+	if (ret == 0)
+		ret = parallel_status(&par);
+	else
+		ret = builtin_error("parallel", "I/O error");
+	parallel_close(&par);
+	return (ret);
+}
@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parallel_slot_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:15:17 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:15:17 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Runs one replica of the stage in the forked child
+ *
+ * The replica must not hold the pipes of the other replicas, or their
+ * input would never reach EOF.
+ *
+ * @param par Parallel stage state (of the parent)
+ * @param in Input pipe of the replica
+ * @param out Output pipe of the replica
+ */
+static void	replica_child(t_parallel *par, int in[2], int out[2])
+{
+	int	k;
+
+	par->context->is_child = 1;
+	signal(SIGPIPE, SIG_DFL);
+	dup2(in[0], STDIN_FILENO);
+	dup2(out[1], STDOUT_FILENO);
+	close(in[0]);
+	close(in[1]);
+	close(out[0]);
+	close(out[1]);
+	k = 0;
+	while (k < par->count)
+	{
+		if (par->slots[k].in_fd >= 0)
+			close(par->slots[k].in_fd);
+		if (par->slots[k].out_fd >= 0)
+			close(par->slots[k].out_fd);
+		k++;
+	}
+	par->context->stages[par->stage].replicas = 0;
+	execute_command(par->context, par->stage);
+}
+
+/**
+ * @brief Forks a replica for the chunk held in slot->input
+ *
+ * The replica exec's the stage (or runs its builtin) as if it were the
+ * only copy. Its input pipe is made non-blocking on our side.
+ *
+ * @param par Parallel stage state
+ * @param slot Slot that runs the chunk
+ */
+static void	start_replica(t_parallel *par, t_replica *slot)
+{
+	int	in[2];
+	int	out[2];
+
+	if (pipe(in) < 0 || pipe(out) < 0)
+		cleanup_and_exit(par->context, "pipe failed", 1);
+	slot->pid = fork();
+	if (slot->pid < 0)
+		cleanup_and_exit(par->context, "fork failed", 1);
+	if (slot->pid == 0)
+		replica_child(par, in, out);
+	close(in[0]);
+	close(out[1]);
+	slot->in_fd = in[1];
+	slot->out_fd = out[0];
+	fcntl(slot->in_fd, F_SETFL, O_NONBLOCK);
+	slot->seq = par->next_seq++;
+	slot->sent = 0;
+}
+
+/**
+ * @brief Moves the next newline-aligned chunk of the input into a slot
+ *
+ * A chunk is cut once PARALLEL_CHUNK bytes are buffered, after the last
+ * complete line; at EOF the rest is taken as is. The buffer is handed
+ * over and only the partial line after the cut is copied back. An empty
+ * input still gets one replica, as a single copy of the stage would.
+ *
+ * @param par Parallel stage state
+ * @param slot Free slot receiving the chunk
+ * @return 1 if a chunk was taken, 0 if more input is needed
+ */
+static int	take_chunk(t_parallel *par, t_replica *slot)
+{
+	size_t	cut;
+
+	if (!par->in_eof && par->pending.len < PARALLEL_CHUNK)
+		return (0);
+	if (par->in_eof && !par->pending.len && par->next_seq > 0)
+		return (0);
+	cut = par->pending.len;
+	while (!par->in_eof && cut > 0 && par->pending.data[cut - 1] != '\n')
+		cut--;
+	if (!par->in_eof && cut == 0)
+		return (0);
+	slot->input = par->pending;
+	ft_memset(&par->pending, 0, sizeof(t_buf));
+	buf_append(&par->pending, slot->input.data + cut, slot->input.len - cut);
+	slot->input.len = cut;
+	return (1);
+}
+
+/**
+ * @brief Starts replicas while the next slot in turn is free and a chunk
+ * is ready
+ *
+ * Chunk n always goes to slot n % count, so the slots are used round
+ * robin and free up in chunk order. No chunk is started after a replica
+ * failed.
+ *
+ * @param par Parallel stage state
+ */
+void	parallel_schedule(t_parallel *par)
+{
+	t_replica	*slot;
+
+	slot = &par->slots[par->next_seq % par->count];
+	while (!par->failed && slot->pid == 0 && take_chunk(par, slot))
+	{
+		start_replica(par, slot);
+		slot = &par->slots[par->next_seq % par->count];
+	}
+}
@@ -0,0 +1,140 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   resolve_stage_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:21:43 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:21:43 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Returns the first PATH directory entry that is executable
+ *
+ * @param context Pointer to the pipex context structure
+ * @param dirs Array of PATH directories
+ * @param name Command name
+ * @return Allocated full path or NULL if not found
+ */
+static char	*first_executable(t_pipex *context, char **dirs, const char *name)
+{
+	char	*dir_slash;
+	char	*path;
+	int		i;
+
+	i = 0;
+	while (dirs[i])
+	{
+		dir_slash = ft_strjoin(dirs[i], "/");
+		path = NULL;
+		if (dir_slash)
+			path = ft_strjoin(dir_slash, name);
+		free(dir_slash);
+		if (!path)
+		{
+			free_tab(dirs);
+			cleanup_and_exit(context, "malloc failed", 1);
+		}
+		if (access(path, X_OK) == 0)
+			return (path);
+		free(path);
+		i++;
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Resolves a command name the same way the child would
+ *
+ * @param context Pointer to the pipex context structure
+ * @param name Command name or path
+ * @return Allocated executable path or NULL if it can't be resolved
+ */
+static char	*lookup_command(t_pipex *context, const char *name)
+{
+	char	*path_env;
+	char	**dirs;
+	char	*path;
+
+	if (ft_strchr(name, '/'))
+	{
+		if (access(name, X_OK) != 0)
+			return (NULL);
+		path = ft_strdup(name);
+		if (!path)
+			cleanup_and_exit(context, "malloc failed", 1);
+		return (path);
+	}
+	path_env = find_path_env(context->env_vars);
+	if (!path_env)
+		return (NULL);
+	dirs = ft_split(path_env, ':');
+	if (!dirs)
+		cleanup_and_exit(context, "malloc failed", 1);
+	path = first_executable(context, dirs, name);
+	free_tab(dirs);
+	return (path);
+}
+
+/**
+ * @brief Finds an earlier stage whose PATH lookup found the same command
+ *
+ * Builtin stages are never looked up, and a failed lookup is not worth
+ * keeping, so neither is reused.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param i Index of the stage being resolved
+ * @return Index of the earlier stage, or -1 if none
+ */
+static int	find_cached(t_pipex *context, int i)
+{
+	const char	*name;
+	int			j;
+
+	name = context->stages[i].argv[0];
+	j = 0;
+	while (j < i)
+	{
+		if (!context->stages[j].builtin && context->stages[j].path
+			&& ft_strncmp(context->stages[j].argv[0], name,
+				ft_strlen(name) + 1) == 0)
+			return (j);
+		j++;
+	}
+	return (-1);
+}
+
+/**
+ * @brief Resolves the executable path of stage i
+ *
+ * Stages repeating an already resolved command reuse its result
+ * (a command-resolution cache hit) instead of scanning PATH again.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param i Index of the stage
+ */
+void	resolve_stage(t_pipex *context, int i)
+{
+	t_stage	*stage;
+	int		j;
+
+	stage = &context->stages[i];
+	if (!stage->argv || !stage->argv[0] || !stage->argv[0][0])
+		return ;
+	j = find_cached(context, i);
+	if (j < 0)
+	{
+		context->stats.cache_misses++;
+		stage->path = lookup_command(context, stage->argv[0]);
+		return ;
+	}
+	context->stats.cache_hits++;
+	stage->cache_hit = 1;
+	stage->path = ft_strdup(context->stages[j].path);
+	if (!stage->path)
+		cleanup_and_exit(context, "malloc failed", 1);
+}
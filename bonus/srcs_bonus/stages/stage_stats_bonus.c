@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stage_stats_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:21:43 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:27:09 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Reads a clock in nanoseconds
+ *
+ * @param clock CLOCK_MONOTONIC for durations, CLOCK_REALTIME for timestamps
+ * @return Current time of the clock in nanoseconds
+ */
+long	now_ns(clockid_t clock)
+{
+	struct timespec	ts;
+
+	clock_gettime(clock, &ts);
+	return (ts.tv_sec * 1000000000L + ts.tv_nsec);
+}
+
+/**
+ * @brief Converts a raw wait status to a shell style exit code
+ *
+ * @param raw_status Status as filled by waitpid/wait4
+ * @return Exit status, or 128 + signal number if the process was killed
+ */
+int	status_exit_code(int raw_status)
+{
+	if (WIFEXITED(raw_status))
+		return (WEXITSTATUS(raw_status));
+	if (WIFSIGNALED(raw_status))
+		return (128 + WTERMSIG(raw_status));
+	return (0);
+}
+
+/**
+ * @brief Reaps one child and records its status, rusage and exit time
+ *
+ * A builtin that exits once it has read enough (head) also gets the
+ * stages upstream of it stopped. A --fanout branch or driver reaped
+ * here gets its status recorded.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param pids Array of process IDs of the stages
+ * @param options Options passed on to wait4 (0 or WNOHANG)
+ * @return Index of the reaped stage (cmd_count for an unknown child),
+ * REAP_NONE if nothing was ready or REAP_ERROR if no child is left
+ */
+int	reap_stage(t_pipex *context, pid_t *pids, int options)
+{
+	struct rusage	usage;
+	pid_t			pid;
+	int				status;
+	int				i;
+
+	pid = wait4(-1, &status, options, &usage);
+	if (pid == 0)
+		return (REAP_NONE);
+	if (pid < 0)
+		return (REAP_ERROR);
+	fanout_reaped(context, pid, status);
+	i = 0;
+	while (i < context->cmd_count && pids[i] != pid)
+		i++;
+	if (i == context->cmd_count)
+		return (i);
+	context->stages[i].raw_status = status;
+	context->stages[i].usage = usage;
+	context->stages[i].exit_ns = now_ns(CLOCK_MONOTONIC);
+	context->stages[i].reaped = 1;
+	reap_members(context, i);
+	if (context->stages[i].builtin
+		&& context->stages[i].builtin->stops_upstream)
+		stop_upstream(context, i);
+	return (i);
+}
+
+/**
+ * @brief Records the run start time and the initial outfile size
+ *
+ * @param context Pointer to the pipex context structure
+ */
+void	begin_run_stats(t_pipex *context)
+{
+	struct stat	st;
+
+	context->stats.start_ns = now_ns(CLOCK_MONOTONIC);
+	context->stats.start_epoch_ns = now_ns(CLOCK_REALTIME);
+	context->stats.out_size_before = 0;
+	if (fstat(context->out_fd, &st) == 0)
+		context->stats.out_size_before = st.st_size;
+}
+
+/**
+ * @brief Records the run end time and the bytes read and written
+ *
+ * The infile offset is shared with the first stage, so it tells how much
+ * of the infile was actually consumed. Unknown sizes are stored as -1.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param exit_code Exit code of the pipeline
+ */
+void	end_run_stats(t_pipex *context, int exit_code)
+{
+	struct stat	st;
+	t_run_stats	*stats;
+
+	stats = &context->stats;
+	stats->end_ns = now_ns(CLOCK_MONOTONIC);
+	stats->exit_code = exit_code;
+	stats->bytes_in = stats->heredoc_bytes;
+	if (!context->is_heredoc)
+		stats->bytes_in = lseek(context->in_fd, 0, SEEK_CUR);
+	stats->bytes_out = -1;
+	if (fstat(context->out_fd, &st) == 0 && S_ISREG(st.st_mode))
+		stats->bytes_out = st.st_size - stats->out_size_before;
+}
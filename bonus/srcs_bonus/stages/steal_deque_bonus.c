@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   steal_deque_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:05:46 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:05:46 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Appends a task at the back of a deque
+ *
+ * @param d Deque
+ * @param task Task to queue
+ * @return 0 on success, -1 if the deque is full
+ */
+static int	deque_push(t_steal_deque *d, t_steal_task *task)
+{
+	int	full;
+
+	pthread_mutex_lock(&d->lock);
+	full = (d->tail - d->head >= STEAL_DEQUE);
+	if (!full)
+	{
+		d->tasks[d->tail % STEAL_DEQUE] = task;
+		d->tail++;
+	}
+	pthread_mutex_unlock(&d->lock);
+	return (-full);
+}
+
+/**
+ * @brief Removes a task from one end of a deque
+ *
+ * The owner takes the oldest task, at the front, so that blocks finish
+ * roughly in the order their output is needed; thieves take the newest
+ * one, at the back, and so rarely contend with the owner.
+ *
+ * @param d Deque
+ * @param back 1 to take from the back, 0 from the front
+ * @return The task, or NULL if the deque is empty
+ */
+static t_steal_task	*deque_pop(t_steal_deque *d, int back)
+{
+	t_steal_task	*task;
+
+	task = NULL;
+	pthread_mutex_lock(&d->lock);
+	if (d->head != d->tail && back)
+	{
+		d->tail--;
+		task = d->tasks[d->tail % STEAL_DEQUE];
+	}
+	else if (d->head != d->tail)
+	{
+		task = d->tasks[d->head % STEAL_DEQUE];
+		d->head++;
+	}
+	pthread_mutex_unlock(&d->lock);
+	return (task);
+}
+
+/**
+ * @brief Queues a task on the pool and wakes a sleeping worker
+ *
+ * Tasks are dealt to the workers' deques in turn; idle workers steal
+ * from the busy ones.
+ *
+ * @param pool Worker pool
+ * @param task Task to run
+ * @return 0 on success, -1 if every deque is full (the caller then runs
+ * the task itself)
+ */
+int	steal_submit(t_steal_pool *pool, t_steal_task *task)
+{
+	unsigned int	start;
+	int				k;
+
+	start = __atomic_fetch_add(&pool->next, 1, __ATOMIC_RELAXED);
+	k = 0;
+	while (k < pool->count && deque_push(
+			&pool->workers[(start + k) % pool->count].deque, task) < 0)
+		k++;
+	if (k == pool->count)
+		return (-1);
+	pthread_mutex_lock(&pool->lock);
+	__atomic_add_fetch(&pool->pending, 1, __ATOMIC_RELEASE);
+	pthread_cond_signal(&pool->wake);
+	pthread_mutex_unlock(&pool->lock);
+	return (0);
+}
+
+/**
+ * @brief Finds the next task of a worker: its own oldest one, or else
+ * the newest one of another worker
+ *
+ * @param pool Worker pool
+ * @param worker Index of the worker
+ * @return The task, or NULL if every deque is empty
+ */
+t_steal_task	*steal_take(t_steal_pool *pool, int worker)
+{
+	t_steal_task	*task;
+	int				k;
+
+	task = deque_pop(&pool->workers[worker].deque, 0);
+	k = 1;
+	while (!task && k < pool->count)
+	{
+		task = deque_pop(&pool->workers[(worker + k) % pool->count].deque,
+				1);
+		k++;
+	}
+	if (task)
+		__atomic_sub_fetch(&pool->pending, 1, __ATOMIC_RELEASE);
+	return (task);
+}
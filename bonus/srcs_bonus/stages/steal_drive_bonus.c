@@ -0,0 +1,166 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   steal_drive_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:05:46 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:05:46 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Hands a filled block to the pool
+ *
+ * @param seg Segment
+ * @param task Filled task
+ */
+static void	steal_post(t_steal_seg *seg, t_steal_task *task)
+{
+	task->run = steal_block;
+	task->ctx = seg;
+	task->fallback = 0;
+	task->done = 0;
+	if (steal_submit(seg->pool, task) < 0)
+		steal_block(task, -1);
+}
+
+/**
+ * @brief Waits for the oldest block in flight and passes its output on
+ *
+ * Outputs are taken back in input order: into the stateful stages of
+ * the segment if there are any, else to the output, and what the block
+ * counted is moved to the chain of all stages. From a block marked to
+ * redo on, the inputs go through that chain instead.
+ *
+ * @param seg Segment
+ * @param task Oldest task in flight
+ * @return 0 on success, -2 on write error
+ */
+static int	steal_consume(t_steal_seg *seg, t_steal_task *task)
+{
+	t_fuse_op	*ops;
+	int			failed;
+	int			k;
+
+	pthread_mutex_lock(&seg->lock);
+	while (!task->done)
+		pthread_cond_wait(&seg->done, &seg->lock);
+	pthread_mutex_unlock(&seg->lock);
+	seg->serial |= task->fallback;
+	ops = seg->inst[task - seg->window];
+	k = 0;
+	while (!seg->serial && k < seg->prefix)
+	{
+		if (ops[k].kind->merge)
+			ops[k].kind->merge(&seg->ops[k], &ops[k]);
+		k++;
+	}
+	if (seg->serial)
+		failed = fuse_push(seg->ops, task->in.data, task->in.len) < 0;
+	else if (seg->prefix < seg->count)
+		failed = fuse_push(&seg->ops[seg->prefix], task->out.data,
+				task->out.len) < 0;
+	else
+		failed = write_all(seg->out_fd, task->out.data, task->out.len) < 0;
+	return (-2 * failed);
+}
+
+/**
+ * @brief Keeps up to a window of blocks in flight and takes them back
+ * in order until the input ends, a stage stops it or an error occurs
+ *
+ * @param seg Segment
+ * @return 0 on success, -1 on read error, -2 on write error
+ */
+static int	steal_drive(t_steal_seg *seg)
+{
+	long	next;
+	long	done;
+	int		status;
+	int		step;
+
+	next = 0;
+	done = 0;
+	status = 0;
+	step = 1;
+	while (step > 0 || done < next)
+	{
+		step = 0;
+		if (status == 0 && !seg->serial && !seg->eof
+			&& next - done < seg->slots && !fuse_stopped(seg->ops, seg->count))
+			step = steal_fill(seg, &seg->window[next % seg->slots]);
+		if (step > 0)
+			steal_post(seg, &seg->window[next++ % seg->slots]);
+		else if (step == 0 && done < next)
+			step = steal_consume(seg, &seg->window[done++ % seg->slots]);
+		if (step < 0 && status == 0)
+			status = step;
+	}
+	if (status == 0 && seg->serial)
+		status = steal_rest(seg);
+	return (status);
+}
+
+/**
+ * @brief Reports a failed drive and ends every stage in order
+ *
+ * @param seg Segment, with no block in flight
+ * @param status Result of the drive
+ * @return Exit status of the last stage
+ */
+static int	steal_finish(t_steal_seg *seg, int status)
+{
+	int	k;
+	int	last;
+
+	if (status == -1)
+		builtin_error(seg->stages->argv[0], "read error");
+	else if (status < 0)
+		builtin_error(seg->stages[seg->count - 1].argv[0], "write error");
+	last = 0;
+	k = 0;
+	while (k < seg->count)
+		last = fuse_end(&seg->ops[k++]);
+	if (status < 0 && last == 0)
+		return (1);
+	return (last);
+}
+
+/**
+ * @brief Runs a segment of a --steal group
+ *
+ * Its leading stateless stages run as tasks of one block each, spread
+ * over the whole pool; the driver (the segment's thread) reads the
+ * blocks, keeps a window of them in flight and takes the outputs back
+ * in order into the stateful stages that follow. Other segments run as
+ * usual.
+ *
+ * @param t Thread of the segment
+ * @return Exit status of the last stage
+ */
+int	steal_segment(t_stage_thread *t)
+{
+	t_steal_seg	*seg;
+	int			prefix;
+	int			status;
+	int			state;
+
+	prefix = steal_prefix(t->stage, t->count);
+	if (prefix == 0)
+		return (run_segment(t->stage, t->count, t->in_fd, t->out_fd));
+	pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, &state);
+	seg = steal_open(t, prefix);
+	if (!seg)
+		status = builtin_error(t->stage->argv[0], "malloc");
+	else
+	{
+		status = steal_finish(seg, steal_drive(seg));
+		steal_close(seg);
+	}
+	pthread_setcancelstate(state, NULL);
+	return (status);
+}
@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   steal_input_bonus.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:02:57 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 16:02:57 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Reads the input of a segment
+ *
+ * The driver ignores cancellation while it holds the segment, except
+ * while it waits here for input.
+ *
+ * @param seg Segment
+ * @return Number of bytes read, 0 at end of input, -1 on error
+ */
+ssize_t	steal_read(t_steal_seg *seg)
+{
+	ssize_t	n;
+	int		state;
+
+	pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, &state);
+	n = io_read(seg->in_fd, seg->rbuf, FUSE_BUFSIZE);
+	while (n < 0 && errno == EINTR)
+		n = io_read(seg->in_fd, seg->rbuf, FUSE_BUFSIZE);
+	pthread_setcancelstate(state, NULL);
+	return (n);
+}
+
+/**
+ * @brief Ends the filling of a block
+ *
+ * A block that ends with neither a newline nor the input is given back
+ * to the segment, which then goes on in order.
+ *
+ * @param seg Segment
+ * @param task Task holding the bytes read so far
+ * @param nl Last newline read, or NULL
+ * @return 1 if the block is ready, 0 if there is none, -1 on error
+ */
+static int	steal_cut(t_steal_seg *seg, t_steal_task *task, const char *nl)
+{
+	t_buf	kept;
+
+	if (task->in.failed || seg->carry.failed)
+		return (-1);
+	if (nl || seg->eof)
+		return (task->in.len > 0);
+	kept = seg->carry;
+	seg->carry = task->in;
+	task->in = kept;
+	seg->serial = 1;
+	return (0);
+}
+
+/**
+ * @brief Fills a task with the next block of whole lines
+ *
+ * A block ends at the last newline read; the rest is carried over to
+ * the next block. Only the last block can end without a newline. A line
+ * longer than STEAL_BLOCK_MAX has no block boundary to wait for: what
+ * was read is carried back and the segment goes on in order.
+ *
+ * @param seg Segment
+ * @param task Task to fill
+ * @return 1 if a block was filled, 0 at end of input or when the
+ * segment turned serial, -1 on error
+ */
+int	steal_fill(t_steal_seg *seg, t_steal_task *task)
+{
+	const char	*nl;
+	ssize_t		n;
+	size_t		len;
+
+	task->in.len = 0;
+	buf_append(&task->in, seg->carry.data, seg->carry.len);
+	seg->carry.len = 0;
+	nl = NULL;
+	while (!nl && !seg->eof && task->in.len < STEAL_BLOCK_MAX)
+	{
+		n = steal_read(seg);
+		if (n < 0)
+			return (-1);
+		seg->eof = (n == 0);
+		nl = memrchr(seg->rbuf, '\n', n);
+		len = n;
+		if (nl)
+			len = nl + 1 - seg->rbuf;
+		buf_append(&task->in, seg->rbuf, len);
+		buf_append(&seg->carry, seg->rbuf + len, n - len);
+	}
+	return (steal_cut(seg, task, nl));
+}
+
+/**
+ * @brief Runs the rest of the input through the chain of all stages,
+ * after a block had to be redone in order or a line did not fit in one
+ *
+ * @param seg Segment
+ * @return 0 on success, -1 on read error, -2 on write error
+ */
+int	steal_rest(t_steal_seg *seg)
+{
+	ssize_t	n;
+
+	if (seg->carry.len > 0
+		&& fuse_push(seg->ops, seg->carry.data, seg->carry.len) < 0)
+		return (-2);
+	seg->carry.len = 0;
+	while (!seg->eof && !fuse_stopped(seg->ops, seg->count))
+	{
+		n = steal_read(seg);
+		if (n < 0)
+			return (-1);
+		seg->eof = (n == 0);
+		if (n > 0 && fuse_push(seg->ops, seg->rbuf, n) < 0)
+			return (-2);
+	}
+	return (0);
+}
@@ -0,0 +1,171 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   steal_pool_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:05:46 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:05:46 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Body of a pool worker: runs tasks from its own deque, steals
+ * from the others when it is empty, and sleeps when no task is queued
+ *
+ * Between tasks the worker checks for shutdown under the pool lock,
+ * which it first takes before looking at any deque: spawn_workers()
+ * holds it until the pool is complete, so every worker sees the final
+ * count.
+ *
+ * @param arg The t_steal_worker
+ * @return NULL once the pool is stopped and no task is left
+ */
+static void	*steal_worker(void *arg)
+{
+	t_steal_worker	*w;
+	t_steal_pool	*p;
+	t_steal_task	*task;
+
+	w = arg;
+	p = w->pool;
+	pthread_mutex_lock(&p->lock);
+	while (1)
+	{
+		pthread_mutex_unlock(&p->lock);
+		task = steal_take(p, w->index);
+		if (task)
+			task->run(task, w->index);
+		else if (__atomic_load_n(&p->pending, __ATOMIC_ACQUIRE) > 0)
+			sched_yield();
+		pthread_mutex_lock(&p->lock);
+		while (!task && __atomic_load_n(&p->pending, __ATOMIC_ACQUIRE) <= 0
+			&& !p->shutdown)
+			pthread_cond_wait(&p->wake, &p->lock);
+		if (!task && p->shutdown
+			&& __atomic_load_n(&p->pending, __ATOMIC_ACQUIRE) <= 0)
+			break ;
+	}
+	pthread_mutex_unlock(&p->lock);
+	return (NULL);
+}
+
+/**
+ * @brief Starts up to cpus workers, stopping at the first one that
+ * cannot be created
+ *
+ * The workers wait for the pool lock, held here until count is final.
+ *
+ * @param pool Pool with room for cpus workers
+ * @param cpus Number of workers wanted
+ */
+static void	spawn_workers(t_steal_pool *pool, long cpus)
+{
+	t_steal_worker	*w;
+
+	pthread_mutex_lock(&pool->lock);
+	while (pool->count < cpus)
+	{
+		w = &pool->workers[pool->count];
+		w->pool = pool;
+		w->index = pool->count;
+		pthread_mutex_init(&w->deque.lock, NULL);
+		if (pthread_create(&w->thread, NULL, steal_worker, w) != 0)
+		{
+			pthread_mutex_destroy(&w->deque.lock);
+			break ;
+		}
+		w->started = 1;
+		pool->count++;
+	}
+	pthread_mutex_unlock(&pool->lock);
+}
+
+/**
+ * @brief Starts the worker pool of a --steal group, one worker per
+ * online CPU
+ *
+ * @param context Pointer to the pipex context structure
+ * @return The pool, or NULL without --steal or if no worker could start
+ * (the group then runs one thread per segment)
+ */
+t_steal_pool	*steal_start(t_pipex *context)
+{
+	t_steal_pool	*pool;
+	long			cpus;
+
+	if (!context->opts.steal)
+		return (NULL);
+	cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	if (cpus < 1)
+		cpus = 1;
+	if (cpus > STEAL_MAX)
+		cpus = STEAL_MAX;
+	pool = ft_calloc(1, sizeof(t_steal_pool));
+	if (!pool)
+		return (NULL);
+	pool->workers = ft_calloc(cpus, sizeof(t_steal_worker));
+	pthread_mutex_init(&pool->lock, NULL);
+	pthread_cond_init(&pool->wake, NULL);
+	if (pool->workers)
+		spawn_workers(pool, cpus);
+	if (pool->count > 0)
+		return (pool);
+	steal_stop(pool);
+	return (NULL);
+}
+
+/**
+ * @brief Lets the workers finish the queued tasks, joins them and
+ * releases the pool
+ *
+ * The deques are only destroyed once every worker is joined, as an idle
+ * worker may still look into the deque of one that has already ended.
+ *
+ * @param pool Pool to stop, or NULL
+ */
+void	steal_stop(t_steal_pool *pool)
+{
+	int	w;
+
+	if (!pool)
+		return ;
+	pthread_mutex_lock(&pool->lock);
+	__atomic_store_n(&pool->shutdown, 1, __ATOMIC_RELEASE);
+	pthread_cond_broadcast(&pool->wake);
+	pthread_mutex_unlock(&pool->lock);
+	w = 0;
+	while (w < pool->count)
+		pthread_join(pool->workers[w++].thread, NULL);
+	while (w-- > 0)
+		pthread_mutex_destroy(&pool->workers[w].deque.lock);
+	pthread_mutex_destroy(&pool->lock);
+	pthread_cond_destroy(&pool->wake);
+	free(pool->workers);
+	free(pool);
+}
+
+/**
+ * @brief Tells whether --steal runs stage i as block tasks on the pool
+ *
+ * That is the case for the stages at the head of a fused segment that
+ * keep no state across lines.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param i Index of the stage
+ * @return 1 if it does, 0 otherwise
+ */
+int	steal_stage(t_pipex *context, int i)
+{
+	int	k;
+
+	if (!context->opts.steal)
+		return (0);
+	k = i;
+	while (k > 0 && context->stages[k - 1].fused)
+		k--;
+	return (steal_prefix(&context->stages[k], i - k + 1) == i - k + 1);
+}
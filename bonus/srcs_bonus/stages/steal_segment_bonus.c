@@ -0,0 +1,154 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   steal_segment_bonus.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:05:46 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:05:46 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Block function of the operator closing a slot's chain: keeps
+ * the output of the block for the driver
+ *
+ * @param op Keep operator
+ * @param p Bytes
+ * @param len Number of bytes
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	steal_keep(t_fuse_op *op, const char *p, size_t len)
+{
+	buf_append(&op->scratch, p, len);
+	return (-op->scratch.failed);
+}
+
+/**
+ * @brief Builds the chain of operators each slot of the window runs its
+ * blocks through: the parallel stages, then a keep operator
+ *
+ * @param seg Segment with a zeroed table of chains
+ * @return 0 on success, -1 on allocation failure
+ */
+static int	open_instances(t_steal_seg *seg)
+{
+	static const t_fuse_kind	keep = {"keep", NULL, NULL, steal_keep, NULL,
+		FUSE_BYTES, 1, NULL, NULL};
+	t_fuse_op					*ops;
+	int							w;
+
+	w = 0;
+	while (w < seg->slots)
+	{
+		ops = ft_calloc(seg->prefix + 1, sizeof(t_fuse_op));
+		if (!ops)
+			return (-1);
+		seg->inst[w++] = ops;
+		ops[seg->prefix].kind = &keep;
+		ops[seg->prefix].out_fd = -1;
+		ops[seg->prefix - 1].next = &ops[seg->prefix];
+		if (fuse_open(ops, seg->stages, seg->prefix, -1) < 0)
+			return (-1);
+	}
+	return (0);
+}
+
+/**
+ * @brief Sets up a segment run on the pool
+ *
+ * Every slot of the window of blocks in flight has its own chain of
+ * the parallel stages, so that what a block counts stays apart until
+ * the block is taken back in order, into the chain of all stages.
+ *
+ * @param t Thread of the segment
+ * @param prefix Number of leading stages run as block tasks
+ * @return The segment, or NULL on allocation failure
+ */
+t_steal_seg	*steal_open(t_stage_thread *t, int prefix)
+{
+	t_steal_seg	*seg;
+
+	seg = ft_calloc(1, sizeof(t_steal_seg));
+	if (!seg)
+		return (NULL);
+	pthread_mutex_init(&seg->lock, NULL);
+	pthread_cond_init(&seg->done, NULL);
+	seg->pool = t->pool;
+	seg->stages = t->stage;
+	seg->count = t->count;
+	seg->prefix = prefix;
+	seg->in_fd = t->in_fd;
+	seg->out_fd = t->out_fd;
+	seg->slots = STEAL_WINDOW * t->pool->count + 2;
+	seg->window = ft_calloc(seg->slots, sizeof(t_steal_task));
+	seg->rbuf = malloc(FUSE_BUFSIZE);
+	seg->ops = ft_calloc(seg->count, sizeof(t_fuse_op));
+	seg->inst = ft_calloc(seg->slots, sizeof(t_fuse_op *));
+	if (seg->window && seg->rbuf && seg->ops && seg->inst
+		&& fuse_open(seg->ops, seg->stages, seg->count, seg->out_fd) == 0
+		&& open_instances(seg) == 0)
+		return (seg);
+	steal_close(seg);
+	return (NULL);
+}
+
+/**
+ * @brief Releases a segment once no block of it is in flight
+ *
+ * @param seg Segment
+ */
+void	steal_close(t_steal_seg *seg)
+{
+	int	k;
+
+	k = 0;
+	while (seg->inst && k < seg->slots)
+	{
+		if (seg->inst[k])
+			fuse_free(seg->inst[k], seg->prefix + 1);
+		k++;
+	}
+	k = 0;
+	while (seg->window && k < seg->slots)
+	{
+		free(seg->window[k].in.data);
+		free(seg->window[k++].out.data);
+	}
+	if (seg->ops)
+		fuse_free(seg->ops, seg->count);
+	free(seg->inst);
+	free(seg->window);
+	free(seg->rbuf);
+	free(seg->carry.data);
+	pthread_mutex_destroy(&seg->lock);
+	pthread_cond_destroy(&seg->done);
+	free(seg);
+}
+
+/**
+ * @brief Counts the leading stages of a segment that can run on
+ * separate blocks at once
+ *
+ * @param stages First stage of the segment
+ * @param count Number of stages
+ * @return Number of such stages, 0 if the segment runs as usual
+ */
+int	steal_prefix(t_stage *stages, int count)
+{
+	const t_fuse_kind	*kind;
+	int					k;
+
+	k = 0;
+	while (k < count)
+	{
+		kind = fuse_kind(&stages[k]);
+		if (!kind || !kind->parallel || !kind->parallel(&stages[k]))
+			return (k);
+		k++;
+	}
+	return (k);
+}
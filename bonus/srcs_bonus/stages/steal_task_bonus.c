@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   steal_task_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:05:46 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:05:46 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Pushes what the operators of a chain still hold into the next
+ * ones: the last line if it has no newline, and their writers
+ *
+ * @param ops Chain
+ * @param count Number of operators to drain
+ * @return 0 on success, -1 on error
+ */
+static int	steal_drain(t_fuse_op *ops, int count)
+{
+	size_t	len;
+	int		k;
+
+	k = 0;
+	while (k < count)
+	{
+		if (ops[k].carry.len > 0 && !ops[k].stop)
+		{
+			len = ops[k].carry.len;
+			ops[k].carry.len = 0;
+			if (ops[k].kind->block(&ops[k], ops[k].carry.data, len) < 0)
+				return (-1);
+		}
+		if (ops[k].out && out_flush(ops[k].out) < 0)
+			return (-1);
+		k++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Task body: runs one block through the chain of its slot
+ *
+ * The output is swapped into the task. A chain that wants to stop (grep
+ * on binary input) or fails marks the block for the driver to redo in
+ * order, together with everything after it.
+ *
+ * @param task Block task
+ * @param worker Index of the worker running it (unused)
+ */
+void	steal_block(t_steal_task *task, int worker)
+{
+	t_steal_seg	*seg;
+	t_fuse_op	*ops;
+	t_buf		kept;
+	int			failed;
+
+	(void)worker;
+	seg = task->ctx;
+	ops = seg->inst[task - seg->window];
+	ops[seg->prefix].scratch.len = 0;
+	failed = (fuse_push(ops, task->in.data, task->in.len) < 0
+			|| steal_drain(ops, seg->prefix) < 0);
+	if (failed)
+		ops->stop = 1;
+	task->fallback = fuse_stopped(ops, seg->prefix);
+	kept = ops[seg->prefix].scratch;
+	ops[seg->prefix].scratch = task->out;
+	task->out = kept;
+	pthread_mutex_lock(&seg->lock);
+	task->done = 1;
+	pthread_cond_broadcast(&seg->done);
+	pthread_mutex_unlock(&seg->lock);
+}
@@ -0,0 +1,141 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   thread_group_bonus.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:45:04 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:30:19 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Decides which process runs every stage
+ *
+ * With --threaded, each run of adjacent builtin stages is hosted by the
+ * process of its last stage, where the stages run as threads. With
+ * --fuse, adjacent streaming builtins are also hosted together and run
+ * in one loop (a fused segment). Other stages, stages run as
+ * replicas (--parallel) and stages followed by a --fanout host
+ * themselves. When ring descriptors could clash with kernel ones,
+ * --threaded is dropped and the builtins keep their kernel pipes.
+ *
+ * @param context Pointer to the pipex context structure
+ */
+void	plan_thread_groups(t_pipex *context)
+{
+	int	i;
+	int	j;
+
+	if (!ring_fds_usable())
+		context->opts.threaded = 0;
+	i = 0;
+	while (i < context->cmd_count)
+	{
+		j = i;
+		while (j - i < RING_MAX && !group_break(context, j)
+			&& (fuse_next(context, j)
+				|| (context->opts.threaded && j + 1 < context->cmd_count
+					&& context->stages[j].builtin
+					&& context->stages[j + 1].builtin)))
+			j++;
+		while (i <= j)
+		{
+			context->stages[i].fused = (i < j && fuse_next(context, i));
+			context->stages[i++].host = j;
+		}
+	}
+	if (context->opts.threaded || context->opts.fuse)
+		explain_plan(context, "groups");
+}
+
+/**
+ * @brief Finds the first stage hosted by a process
+ *
+ * @param context Pointer to the pipex context structure
+ * @param host Index of the hosting stage
+ * @return Index of the first stage of the group
+ */
+int	group_first(t_pipex *context, int host)
+{
+	int	k;
+
+	k = host;
+	while (k > 0 && context->stages[k - 1].host == host)
+		k--;
+	return (k);
+}
+
+/**
+ * @brief Counts the stages hosted by a process
+ *
+ * @param context Pointer to the pipex context structure
+ * @param host Index of the hosting stage
+ * @return Number of stages run by that process (1 without threads)
+ */
+int	group_size(t_pipex *context, int host)
+{
+	return (host - group_first(context, host) + 1);
+}
+
+/**
+ * @brief Gives the threaded stages of a group the status of their host
+ *
+ * Their times and exit status are those of the hosting process; the
+ * resource usage stays with the host so that totals are not counted
+ * twice.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param host Index of the hosting stage, just reaped
+ */
+void	reap_members(t_pipex *context, int host)
+{
+	t_stage	*stage;
+	int		k;
+
+	k = group_first(context, host);
+	while (k < host)
+	{
+		stage = &context->stages[k];
+		stage->raw_status = context->stages[host].raw_status;
+		stage->fork_ns = context->stages[host].fork_ns;
+		stage->exec_ns = context->stages[host].exec_ns;
+		stage->exit_ns = context->stages[host].exit_ns;
+		stage->reaped = 1;
+		k++;
+	}
+}
+
+/**
+ * @brief Tag shown after a stage by --explain
+ *
+ * @param context Pointer to the pipex context structure
+ * @param i Index of the stage
+ * @return " [parallel]" for a stage run as replicas, " [fanout]" for a
+ * stage followed by a branch, " [tap]" for a tapped stage, " [task]"
+ * for a stage run as block tasks (--steal), " [fused]" for another
+ * stage of a fused segment, " [thread]" for another stage of a group,
+ * " [builtin]" for another builtin, "" otherwise
+ */
+const char	*stage_tag(t_pipex *context, int i)
+{
+	if (parallel_stage(context, i))
+		return (" [parallel]");
+	if (context->stages[i].fanout & FANOUT_BRANCH)
+		return (" [fanout]");
+	if (context->stages[i].fanout)
+		return (" [tap]");
+	if (steal_stage(context, i))
+		return (" [task]");
+	if (context->stages[i].fused || (i > 0 && context->stages[i - 1].fused))
+		return (" [fused]");
+	if (context->stages[i].host >= 0
+		&& group_size(context, context->stages[i].host) > 1)
+		return (" [thread]");
+	if (context->stages[i].builtin)
+		return (" [builtin]");
+	return ("");
+}
@@ -0,0 +1,200 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   thread_run_bonus.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 14:45:04 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:05:46 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Body of a stage thread
+ *
+ * The thread runs one segment: a builtin, or several fused ones. When
+ * it returns, its output ring gets end of input and its input ring is
+ * abandoned. A segment that stops early (head) also cancels the threads
+ * upstream of it, as the parent does with stop_upstream() for
+ * processes, in case one of them is blocked reading.
+ *
+ * @param arg The t_stage_thread of the segment
+ * @return Exit status of its last stage
+ */
+static void	*stage_thread(void *arg)
+{
+	t_stage_thread	*t;
+	int				status;
+	int				stops;
+	int				k;
+
+	t = arg;
+	if (t->pool)
+		status = steal_segment(t);
+	else
+		status = run_segment(t->stage, t->count, t->in_fd, t->out_fd);
+	ring_close(t->out_fd);
+	ring_abandon(t->in_fd);
+	stops = 0;
+	k = 0;
+	while (k < t->count)
+		stops |= t->stage[k++].builtin->stops_upstream;
+	k = 0;
+	while (stops && k < t->index)
+	{
+		if (t->first[k].started)
+			pthread_cancel(t->first[k].thread);
+		k++;
+	}
+	return ((void *)(intptr_t)status);
+}
+
+/**
+ * @brief Splits a group into segments and wires them with rings
+ *
+ * A segment is a run of fused stages, or a single stage. The first one
+ * reads stdin and the last one writes stdout; those are the real pipes
+ * (or files) shared with the external neighbours.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param threads At least one entry per stage of the group
+ * @param first Index of the first stage
+ * @param count Number of stages
+ * @return Number of segments, or -1 if a ring could not be created
+ */
+static int	wire_threads(t_pipex *context, t_stage_thread *threads,
+		int first, int count)
+{
+	int	in;
+	int	k;
+	int	n;
+
+	in = STDIN_FILENO;
+	n = 0;
+	k = first;
+	while (k < first + count)
+	{
+		threads[n].stage = &context->stages[k];
+		threads[n].first = threads;
+		threads[n].index = n;
+		threads[n].count = 1;
+		while (context->stages[k++].fused)
+			threads[n].count++;
+		threads[n].in_fd = in;
+		threads[n].out_fd = STDOUT_FILENO;
+		if (k < first + count)
+			threads[n].out_fd = ring_open(in);
+		if (threads[n].out_fd < 0)
+			return (-1);
+		in = threads[n++].out_fd;
+	}
+	return (n);
+}
+
+/**
+ * @brief Starts one thread per segment
+ *
+ * A segment whose thread cannot be created behaves like one that failed
+ * at once: its neighbours see end of input and a closed reader.
+ *
+ * @param threads One entry per segment of the group
+ * @param count Number of segments
+ * @param pool Worker pool of a --steal group, or NULL
+ */
+static void	start_threads(t_stage_thread *threads, int count,
+		t_steal_pool *pool)
+{
+	int	k;
+
+	k = 0;
+	while (k < count)
+	{
+		threads[k].pool = pool;
+		if (pthread_create(&threads[k].thread, NULL, stage_thread,
+				&threads[k]) == 0)
+			threads[k].started = 1;
+		else
+		{
+			builtin_error(threads[k].stage->argv[0], "cannot start thread");
+			ring_close(threads[k].out_fd);
+			ring_abandon(threads[k].in_fd);
+		}
+		k++;
+	}
+}
+
+/**
+ * @brief Joins every segment thread and releases the rings
+ *
+ * A segment stopped by its reader (or cancelled) counts as killed by
+ * SIGPIPE, like the process it replaces.
+ *
+ * @param threads One entry per segment of the group
+ * @param count Number of segments
+ * @return Exit status of the last stage
+ */
+static int	join_threads(t_stage_thread *threads, int count)
+{
+	void	*ret;
+	int		status;
+	int		k;
+
+	status = 1;
+	k = 0;
+	while (k < count)
+	{
+		ret = (void *)(intptr_t)1;
+		if (threads[k].started)
+			pthread_join(threads[k].thread, &ret);
+		status = (int)(intptr_t)ret;
+		if (ret == PTHREAD_CANCELED)
+			status = 128 + SIGPIPE;
+		k++;
+	}
+	while (k-- > 0)
+		ring_free(threads[k].out_fd);
+	return (status);
+}
+
+/**
+ * @brief Runs the stages of a group in the hosting process
+ *
+ * Each segment runs as a thread, and adjacent segments pass fixed-size
+ * buffers over lock-free rings instead of pipes, so no data crosses the
+ * kernel between them. With --steal, the segments share a pool of
+ * workers that run their stateless stages block by block. The process
+ * exits with the status of the last stage.
+ *
+ * @param context Pointer to the pipex context structure
+ * @param host Index of the hosting (last) stage
+ * @return Exit status of the last stage
+ */
+int	run_thread_group(t_pipex *context, int host)
+{
+	t_stage_thread	*threads;
+	t_steal_pool	*pool;
+	int				first;
+	int				count;
+	int				status;
+
+	first = group_first(context, host);
+	threads = ft_calloc(host - first + 1, sizeof(t_stage_thread));
+	if (!threads)
+		return (builtin_error("threads", "malloc"));
+	count = wire_threads(context, threads, first, host - first + 1);
+	if (count < 0)
+	{
+		join_threads(threads, host - first + 1);
+		free(threads);
+		return (builtin_error("threads", "cannot create ring"));
+	}
+	pool = steal_start(context);
+	start_threads(threads, count, pool);
+	status = join_threads(threads, count);
+	steal_stop(pool);
+	free(threads);
+	return (status);
+}
@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   buffer_bonus.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:23:58 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 12:23:58 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Grows the buffer so that extra bytes fit
+ *
+ * On allocation failure the buffer is marked as failed and further
+ * appends are ignored.
+ *
+ * @param buf Buffer to grow
+ * @param extra Number of bytes about to be appended
+ * @return 1 if the bytes fit, 0 otherwise
+ */
+static int	buf_reserve(t_buf *buf, size_t extra)
+{
+	char	*data;
+	size_t	cap;
+
+	if (buf->failed)
+		return (0);
+	if (buf->len + extra <= buf->cap)
+		return (1);
+	cap = buf->cap * 2 + extra + 256;
+	data = malloc(cap);
+	if (!data)
+	{
+		buf->failed = 1;
+		return (0);
+	}
+	if (buf->data)
+		ft_memcpy(data, buf->data, buf->len);
+	free(buf->data);
+	buf->data = data;
+	buf->cap = cap;
+	return (1);
+}
+
+/**
+ * @brief Appends raw bytes to the buffer
+ *
+ * @param buf Buffer to append to
+ * @param data Bytes to append
+ * @param len Number of bytes
+ */
+void	buf_append(t_buf *buf, const char *data, size_t len)
+{
+	if (!buf_reserve(buf, len))
+		return ;
+	ft_memcpy(buf->data + buf->len, data, len);
+	buf->len += len;
+}
+
+/**
+ * @brief Appends a NUL terminated string to the buffer
+ *
+ * @param buf Buffer to append to
+ * @param str String to append
+ */
+void	buf_puts(t_buf *buf, const char *str)
+{
+	buf_append(buf, str, ft_strlen(str));
+}
+
+/**
+ * @brief Appends a signed 64-bit integer in decimal
+ *
+ * @param buf Buffer to append to
+ * @param n Number to append
+ */
+void	buf_long(t_buf *buf, long n)
+{
+	char			digits[21];
+	int				i;
+	unsigned long	u;
+
+	u = (unsigned long)n;
+	if (n < 0)
+		u = -(unsigned long)n;
+	i = 21;
+	digits[--i] = '0' + u % 10;
+	u /= 10;
+	while (u > 0)
+	{
+		digits[--i] = '0' + u % 10;
+		u /= 10;
+	}
+	if (n < 0)
+		digits[--i] = '-';
+	buf_append(buf, digits + i, 21 - i);
+}
@@ -6,7 +6,7 @@
 /*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/09 04:39:53 by lakdogan          #+#    #+#             */
-/*   Updated: 2025/05/10 04:32:57 by lakdogan         ###   ########.fr       */
+/*   Updated: 2026/10/19 15:44:12 by lakdogan         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -71,6 +71,8 @@ static void	free_resources(t_pipex *ctx)
 		free_tab(ctx->paths);
 	if (ctx->limiter)
 		free(ctx->limiter);
+	free_sampler(&ctx->sampler);
+	free_stages(ctx);
 	if (!ctx->is_child)
 		free(ctx);
 }
@@ -96,10 +98,10 @@ static void	display_error(const char *msg)
 /**
  * @brief Handles cleanup of resources and exits with a specific error code
  *
- * Performs a complete cleanup of all resources allocated by the program,
- * including closing file descriptors, closing pipes, and freeing memory.
- * Then displays an error message (if provided)
- * and exits with the specified code.
+ * Displays the error message (if provided) first, as it may point into
+ * the context. Then performs a complete cleanup of all resources
+ * allocated by the program, including closing file descriptors, closing
+ * pipes, and freeing memory, and exits with the specified code.
  * The cleanup is performed only once per context to avoid double free issues.
  *
  * @param ctx Pointer to the pipex context structure
@@ -108,6 +110,7 @@ static void	display_error(const char *msg)
  */
 void	cleanup_and_exit(t_pipex *ctx, const char *msg, int code)
 {
+	display_error(msg);
 	if (ctx && !ctx->cleaned)
 	{
 		ctx->cleaned = 1;
@@ -115,6 +118,5 @@ void	cleanup_and_exit(t_pipex *ctx, const char *msg, int code)
 		close_pipes(ctx);
 		free_resources(ctx);
 	}
-	display_error(msg);
 	exit(code);
 }
@@ -6,7 +6,7 @@
 /*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/09 04:31:47 by lakdogan          #+#    #+#             */
-/*   Updated: 2025/05/10 04:16:27 by lakdogan         ###   ########.fr       */
+/*   Updated: 2026/10/19 12:21:43 by lakdogan         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -60,6 +60,8 @@ static void	free_allocated_memory(t_pipex *context)
 		free_tab(context->paths);
 	if (context->limiter)
 		free(context->limiter);
+	free_sampler(&context->sampler);
+	free_stages(context);
 }
 
 /**
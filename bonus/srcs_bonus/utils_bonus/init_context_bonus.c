@@ -6,7 +6,7 @@
 /*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/09 04:19:29 by lakdogan          #+#    #+#             */
-/*   Updated: 2025/05/10 04:33:17 by lakdogan         ###   ########.fr       */
+/*   Updated: 2026/10/19 15:18:35 by lakdogan         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,13 +15,17 @@
 /**
  * @brief Allocates and initializes basic context structure
  * 
+ * The first inputs arguments are infiles; the first one is opened as
+ * the input of the pipeline.
+ *
  * @param argc Number of command line arguments
  * @param argv Array of command line arguments
  * @param envp Array of environment variables
+ * @param inputs Number of infiles (--inputs)
  * @return t_pipex* Pointer to the initialized 
  * context structure or NULL on failure
  */
-static t_pipex	*setup_context(int argc, char **argv, char **envp)
+static t_pipex	*setup_context(int argc, char **argv, char **envp, int inputs)
 {
 	t_pipex	*context;
 
@@ -31,15 +35,18 @@ static t_pipex	*setup_context(int argc, char **argv, char **envp)
 	ft_memset(context, 0, sizeof(t_pipex));
 	context->env_vars = envp;
 	context->infile_path = argv[1];
+	context->infile_paths = argv + 1;
+	context->infile_count = inputs;
 	context->outfile_path = argv[argc - 1];
 	context->is_child = 0;
 	context->cleaned = 0;
 	context->is_heredoc = 0;
 	context->limiter = NULL;
-	context->cmd_count = argc - 3;
+	context->cmd_count = argc - 2 - inputs;
 	context->pipe_count = context->cmd_count - 1;
 	context->paths = NULL;
 	context->args = NULL;
+	context->cmd_strs = argv + 1 + inputs;
 	return (context);
 }
 
@@ -128,14 +135,15 @@ static void	cleanup_context(t_pipex *context)
  * @param argc Number of command line arguments
  * @param argv Array of command line arguments
  * @param envp Array of environment variables
+ * @param inputs Number of infiles (--inputs)
  * @return t_pipex* Pointer to the fully initialized 
  * context structure or NULL on failure
  */
-t_pipex	*init_context(int argc, char **argv, char **envp)
+t_pipex	*init_context(int argc, char **argv, char **envp, int inputs)
 {
 	t_pipex	*context;
 
-	context = setup_context(argc, argv, envp);
+	context = setup_context(argc, argv, envp, inputs);
 	if (!context)
 		return (NULL);
 	if (!setup_pipes(context))
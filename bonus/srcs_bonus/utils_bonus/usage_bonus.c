@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   usage_bonus.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 15:39:20 by lakdogan          #+#    #+#             */
+/*   Updated: 2026/10/19 15:42:20 by lakdogan         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc_bonus/pipex_bonus.h"
+
+/**
+ * @brief Prints the options that export run data
+ */
+static void	print_output_options(void)
+{
+	ft_putstr_fd("   --sample-ms N         pipe fill histograms\n",
+		STDERR_FILENO);
+	ft_putstr_fd("   --metrics-file PATH   OpenMetrics textfile\n",
+		STDERR_FILENO);
+	ft_putstr_fd("   --pipeline-name NAME  metrics/report label\n",
+		STDERR_FILENO);
+	ft_putstr_fd("   --report=json         JSON run record on stderr\n",
+		STDERR_FILENO);
+	ft_putstr_fd("   --report-file PATH    append the record to PATH\n",
+		STDERR_FILENO);
+}
+
+/**
+ * @brief Prints the options that shape the plan
+ */
+static void	print_plan_options(void)
+{
+	ft_putstr_fd("   --no-builtins         always exec external commands\n",
+		STDERR_FILENO);
+	ft_putstr_fd("   --no-rewrite NAME     disable a rewrite (or all)\n",
+		STDERR_FILENO);
+	ft_putstr_fd("   --explain             print the rewritten plan\n",
+		STDERR_FILENO);
+	ft_putstr_fd("   --unordered           output line order does not matter\n",
+		STDERR_FILENO);
+}
+
+/**
+ * @brief Prints the options that change how stages run
+ */
+static void	print_run_options(void)
+{
+	ft_putstr_fd("   --threaded            run adjacent builtins as threads\n",
+		STDERR_FILENO);
+	ft_putstr_fd("   --fuse                fuse adjacent streaming builtins\n",
+		STDERR_FILENO);
+	ft_putstr_fd("   --steal               stateless builtins as block tasks\n",
+		STDERR_FILENO);
+	ft_putstr_fd("   --shards N            run over N infile line ranges\n",
+		STDERR_FILENO);
+	ft_putstr_fd("   --parallel i=N        run stage i as N replicas\n",
+		STDERR_FILENO);
+}
+
+/**
+ * @brief Prints the options for several inputs and outputs
+ */
+static void	print_graph_options(void)
+{
+	ft_putstr_fd("   --inputs N            the first N arguments are infiles\n",
+		STDERR_FILENO);
+	ft_putstr_fd("   --fanout 'i=CMDS > F' also feed stage i to CMDS > F\n",
+		STDERR_FILENO);
+	ft_putstr_fd("   --tap i=FILE          copy stage i's output to FILE\n",
+		STDERR_FILENO);
+	ft_putstr_fd("   --tap-policy block|drop  a full tap waits or drops\n",
+		STDERR_FILENO);
+}
+
+/**
+ * @brief Prints usage instructions to stderr
+ *
+ * @param exit_code The exit code to return
+ * @return The exit code provided
+ */
+int	print_usage(int exit_code)
+{
+	write(STDERR_FILENO, "Usage: ./pipex file1 cmd1 cmd2 ... cmdn file2\n", 47);
+	write(STDERR_FILENO, "   or: ./pipex here_doc LIMITER cmd1 cmd2 file\n",
+		47);
+	ft_putstr_fd("options (before file1/here_doc):\n", STDERR_FILENO);
+	print_output_options();
+	print_plan_options();
+	print_run_options();
+	print_graph_options();
+	return (exit_code);
+}
@@ -6,7 +6,7 @@
 /*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/08 01:43:45 by lakdogan          #+#    #+#             */
-/*   Updated: 2025/05/10 07:18:01 by lakdogan         ###   ########.fr       */
+/*   Updated: 2026/10/19 12:23:58 by lakdogan         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -58,19 +58,20 @@ static void	perform_cleanup(t_pipex *ctx)
 /**
  * @brief Performs complete cleanup and exits with specified code
  *
+ * The message is printed as "pipex: <msg>" before the context is freed.
+ *
  * @param ctx The pipex context structure containing resources to clean up
  * @param msg Error message to display (can be NULL for no message)
  * @param code Exit code to use when terminating
  */
 void	cleanup_and_exit(t_pipex *ctx, const char *msg, int code)
 {
-	perform_cleanup(ctx);
 	if (msg)
 	{
-		write(STDERR_FILENO, "pipex_bonus: command not found: ", 32);
-		if (ctx && ctx->args && ctx->args[0])
-			write(STDERR_FILENO, ctx->args[0], ft_strlen(ctx->args[0]));
+		write(STDERR_FILENO, "pipex: ", 7);
+		write(STDERR_FILENO, msg, ft_strlen(msg));
 		write(STDERR_FILENO, "\n", 1);
 	}
+	perform_cleanup(ctx);
 	exit(code);
 }
@@ -6,7 +6,7 @@
 /*   By: lakdogan <lakdogan@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/09 02:02:12 by lakdogan          #+#    #+#             */
-/*   Updated: 2025/05/10 05:28:06 by lakdogan         ###   ########.fr       */
+/*   Updated: 2026/10/19 12:23:58 by lakdogan         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -50,7 +50,7 @@ char	**split_path_dirs(t_pipex *context, const char *path_env)
 		return (NULL);
 	paths = ft_split((char *)path_env, ':');
 	if (!paths)
-		cleanup_and_exit(context, "pipex: failed to split PATH", 1);
+		cleanup_and_exit(context, "failed to split PATH", 1);
 	return (paths);
 }
 